@@ -2,14 +2,24 @@
 #define MAIN_H
 
 // Lib includes
-#include "M5StickC.h"
 #include "OneButton.h"
+#include <vector>
 
 // local Includes
 #include "core/Defines.hpp"
+#include "core/Events.hpp"
 #include "core/Feature.hpp"
+#include "core/FeatureDataStore.hpp"
 #include "core/FeatureFactory.hpp"
+#include "core/FeatureStandby.hpp"
+#include "core/FramePacer.hpp"
+#include "core/Hal.hpp"
+#include "core/Journal.hpp"
 #include "core/Led.hpp"
+#include "core/Log.hpp"
+#include "core/NetworkTask.hpp"
+#include "core/Profiler.hpp"
+#include "core/Scheduler.hpp"
 #include "core/Screen.hpp"
 #include "core/SmartWifi.hpp"
 #include "core/Time.hpp"
@@ -41,16 +51,32 @@ void sleep();
 void wakeUp();
 
 /**
- * Initialise feature saved data from the server
+ * Initialise feature saved data from its local copy and from journaled updates
+ * Server saved data is reconciled later by reconcileFeatureData
  */
 void initialiseFeatureData();
 
 /**
- * Sends feature saved data to the server
+ * Requests server feature data once first frame is drawn, response is handled by onFeatureDataResponse
+ */
+void reconcileFeatureData();
+
+/**
+ * Reconciles local feature data with server feature data
+ * Server saved data replaces local one that did not change since last sync, otherwise local saved data wins and journal sends it
+ * Current feature is restarted when its saved data is replaced
  *
- * @param waitForConnection if true method will call SmartWifi::waitUntilReconnect() method in the begining
+ * @param status       http status
+ * @param responseBody server feature data
+ * @param context      unused
  */
-void saveFeatureDataToServer(boolean waitForConnection);
+void onFeatureDataResponse(const int status, JsonDocument& responseBody, void* context);
+
+/**
+ * Journals feature saved data that changed since it was last stored to the server
+ * Never waits for the network, journal sends it once wifi is connected
+ */
+void saveFeatureData();
 
 /**
  * Sets up alwaysLoop = true features
@@ -63,17 +89,17 @@ void setUpPermanentFeatures();
 void shutdownPermanentFeatures();
 
 /**
- * Deletes all feature factories
+ * Increments feature index until featureFactories.size() than reinitialise it at 0
  */
-void shutdownFeatureFactories();
+void nextFeature();
 
 /**
- * Increments feature index until featureFactories.size() than reinitialise it at 0
+ * Lets factory of feature that follows current one prefetch its data
  */
-void nextFeature();
+void prefetchNextFeature();
 
 /**
- * Starts new feature from featureFactories
+ * Starts new feature from featureFactories, resumes it if it is suspended
  *
  * @param featureIndex featureFactories index of feature to start
  * @return started feature
@@ -85,6 +111,32 @@ CrowOs::Core::Feature* startFeature(const int featureIndex);
  */
 void killCurrentFeature();
 
+/**
+ * Suspends current feature if it can be suspended and kills it otherwise
+ * Least recently suspended feature is stopped when standby is full
+ */
+void suspendCurrentFeature();
+
+/**
+ * Stops feature, saves state of its factory and deletes it
+ *
+ * @param featureFactorySavedDataPair factory of feature and its saved data
+ * @param feature                     to stop
+ */
+void stopFeature(CrowOs::Core::FeatureRegistry::Entry& featureFactorySavedDataPair, CrowOs::Core::Feature* feature);
+
+/**
+ * Stops all suspended features
+ */
+void stopSuspendedFeatures();
+
+/**
+ * Serializes factory state into saved data if it changed, then journals it, journal writes local copy once
+ *
+ * @param featureFactorySavedDataPair factory and its saved data
+ */
+void updateFeatureSavedData(CrowOs::Core::FeatureRegistry::Entry& featureFactorySavedDataPair);
+
 /**
  * Sets up all buttons
  */
@@ -95,6 +147,28 @@ void setUpButtons();
  */
 void tickButtons();
 
+/**
+ * Drains main loop events and blocks until next frame deadline or next event
+ */
+void waitNextFrame();
+
+/**
+ * Gets frame rate main loop should run at
+ * Highest rate wanted by looped features, during input bursts at least INPUT_FPS
+ *
+ * @return frame rate
+ */
+const double getFrameRate();
+
+/**
+ * Gets frame rate wanted by feature
+ *
+ * @param feature to get frame rate for
+ * @param input   true during input bursts
+ * @return MAX_FPS during input bursts if feature asks for it, target fps if feature needs frames, min fps otherwise
+ */
+const double getFeatureFrameRate(const CrowOs::Core::Feature* feature, const bool input);
+
 /**
  * Called on home button click
  */
@@ -0,0 +1,93 @@
+#ifndef ASSET_H
+#define ASSET_H
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Asset pixel encoding, see tools/asset_converter.py
+		 */
+		enum AssetFormat {
+			ASSET_FORMAT_RLE = 0x00,
+			ASSET_FORMAT_PALETTE = 0x01
+		};
+
+		/**
+		 * Compressed image stored in flash
+		 */
+		struct Asset {
+
+			/** Asset name */
+			const char* name;
+
+			/** Image width */
+			uint16_t width;
+
+			/** Image height */
+			uint16_t height;
+
+			/** Pixel encoding */
+			AssetFormat format;
+
+			/** RGB565 palette or NULL */
+			const uint16_t* palette;
+
+			/** Number of palette colors */
+			uint16_t paletteSize;
+
+			/** Run length encoded rows */
+			const uint8_t* data;
+
+			/** Bytes used in flash by data and palette */
+			uint32_t flashSize;
+		};
+
+		/**
+		 * Asset reader
+		 *
+		 * Decodes asset one row at a time so that no full image buffer is needed
+		 */
+		class AssetReader {
+
+		private:
+			/** Asset to decode */
+			const Asset& asset;
+
+			/** Next byte to read in asset data */
+			uint32_t offset;
+
+			/** Next row to decode */
+			uint16_t row;
+
+			/**
+			 * Reads next color from asset data
+			 *
+			 * @return RGB565 color
+			 */
+			uint16_t readColor();
+
+		public:
+			/**
+			 * Initialise reader at the first row of asset
+			 *
+			 * @param asset to decode
+			 */
+			AssetReader(const Asset& asset);
+
+			/**
+			 * Decodes next row
+			 *
+			 * @param line buffer of asset width pixels to decode into
+			 * @return false if every row has already been decoded
+			 */
+			bool readLine(uint16_t* line);
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
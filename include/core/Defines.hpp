@@ -1,16 +1,89 @@
 #ifndef DEFINES_H
 #define DEFINES_H
 
-#define LOG_DEBUG true
-#define LOG_INFO true
+// Default log level : LOG_LEVEL_NONE, LOG_LEVEL_INFO or LOG_LEVEL_DEBUG
+#define LOG_LEVEL LOG_LEVEL_INFO
+
+// Log level of each module, every module that logs needs one
+#define LOG_LEVEL_Main LOG_LEVEL
+#define LOG_LEVEL_Hal LOG_LEVEL
+#define LOG_LEVEL_Log LOG_LEVEL
+#define LOG_LEVEL_Screen LOG_LEVEL
+#define LOG_LEVEL_Time LOG_LEVEL
+#define LOG_LEVEL_Led LOG_LEVEL
+#define LOG_LEVEL_Events LOG_LEVEL
+#define LOG_LEVEL_FramePacer LOG_LEVEL
+#define LOG_LEVEL_Profiler LOG_LEVEL
+#define LOG_LEVEL_Scheduler LOG_LEVEL
+#define LOG_LEVEL_JsonPool LOG_LEVEL
+#define LOG_LEVEL_SmartWifi LOG_LEVEL
+#define LOG_LEVEL_HttpCache LOG_LEVEL
+#define LOG_LEVEL_HttpService LOG_LEVEL
+#define LOG_LEVEL_NetworkTask LOG_LEVEL
+#define LOG_LEVEL_WebClient LOG_LEVEL
+#define LOG_LEVEL_Journal LOG_LEVEL
+#define LOG_LEVEL_FeatureDataStore LOG_LEVEL
+#define LOG_LEVEL_SavedDataRecord LOG_LEVEL
+#define LOG_LEVEL_Feature LOG_LEVEL
+#define LOG_LEVEL_FeatureFactory LOG_LEVEL
+#define LOG_LEVEL_FeatureRegistry LOG_LEVEL
+#define LOG_LEVEL_FeatureStandby LOG_LEVEL
+#define LOG_LEVEL_Battery LOG_LEVEL
+#define LOG_LEVEL_BatteryFactory LOG_LEVEL
+#define LOG_LEVEL_PrinterFeature LOG_LEVEL
+#define LOG_LEVEL_PrinterFeatureFactory LOG_LEVEL
+#define LOG_LEVEL_Libelle LOG_LEVEL
+#define LOG_LEVEL_LibelleFactory LOG_LEVEL
+#define LOG_LEVEL_OmniLevel LOG_LEVEL
+#define LOG_LEVEL_OmniLevelFactory LOG_LEVEL
+
 #define DEBOUNCE_TICKS 40
 
+// Main loop keeps running frames for INPUT_BURST_TIME ms after a button event so that buttons can detect clicks
+#define INPUT_BURST_TIME 1000
+
+// Frame rates : main loop never runs above MAX_FPS, features run at their target fps while they need frames and at their min fps otherwise
+#define MAX_FPS 60
+#define DEFAULT_TARGET_FPS 30
+#define DEFAULT_MIN_FPS 1
+
+// Lowest frame rate during input bursts so that OneButton gets its debounce and click timings
+#define INPUT_FPS 30
+
+// Frame rate while device sleeps, power button is polled at this rate if PMIC irq does not wake the device
+#define SLEEP_FPS 2
+
 // https://arduinojson.org/v6/assistant/
 // Use arduinojson assistent to determine maximum json size
 #define MAX_JSON_DOCUMENT_SIZE 1024
 
-#define BACKEND_HOST "192.168.0.1"
-#define BACKEND_PORT 80
+// Most JsonPool documents a registered factory readState or writeState may lease while its caller holds the saved data one
+#define JSON_STATE_LEASES 1
+
+// Most JsonPool documents leased at once, FeatureFactory::setSavedData, FeatureFactory::updateSavedData and Journal::replay each hold one lease for the call, readState and writeState nest theirs inside it
+#define JSON_POOL_PEAK_LEASES (1 + JSON_STATE_LEASES)
+
+// Number of MAX_JSON_DOCUMENT_SIZE documents preallocated by JsonPool, can be overridden from build flags but never below JSON_POOL_PEAK_LEASES
+#ifndef JSON_POOL_SIZE
+	#define JSON_POOL_SIZE JSON_POOL_PEAK_LEASES
+#endif
+
+// Maximum number of registered feature factories of each kind, switched features and alwaysLoop = true features
+#define MAX_FEATURE_FACTORIES 8
+
+// Number of suspended feature instances kept warm, least recently suspended one is stopped when another one is suspended
+#define FEATURE_STANDBY_SIZE 2
+
+// Delay before requesting server feature data again after a failure in ms
+#define FEATURE_DATA_RETRY_DELAY 30000
+
+// Backend host and port can be overridden from build flags, e.g. to run the native build against tools/mock_backend.py
+#ifndef BACKEND_HOST
+	#define BACKEND_HOST "192.168.0.1"
+#endif
+#ifndef BACKEND_PORT
+	#define BACKEND_PORT 80
+#endif
 #define BACKEND_BASE_PATH "/"
 
 #define BACKEND_USER_USERNAME "defineme"
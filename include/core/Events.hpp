@@ -0,0 +1,102 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+#include "Scheduler.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Main loop event queue
+		 *
+		 * Interrupts, timers and background tasks post events, the main loop drains them and blocks in wait while there is nothing to do
+		 * Posting is safe from interrupts, queue is a fixed ring so posting never allocates
+		 */
+		class Events {
+
+		public:
+			/**
+			 * Event types
+			 */
+			enum EventType {
+				EVENT_BUTTON,
+				EVENT_POWER_BUTTON,
+				EVENT_TIMER,
+				EVENT_NETWORK
+			};
+
+		private:
+			/** Number of queued events, must be a power of two */
+			static const uint8_t QUEUE_SIZE = 16;
+
+			/** Queued events */
+			static EventType queue[QUEUE_SIZE];
+
+			/** Index of next event to post, free running */
+			static uint8_t head;
+
+			/** Index of next event to poll, free running */
+			static uint8_t tail;
+
+			/** Number of events dropped because queue was full */
+			static uint32_t droppedCount;
+
+			/**
+			 * Queues event without waking main loop
+			 *
+			 * @param type of queued event
+			 */
+			static void push(const EventType type);
+
+			/**
+			 * Posts wake source as event, called from interrupt context on device
+			 *
+			 * @param source that fired
+			 */
+			static void onWake(const Hal::WakeSource source);
+
+		public:
+			/**
+			 * Arms hardware wake sources, must be called from the main loop task
+			 */
+			static void begin();
+
+			/**
+			 * Posts event and wakes main loop, callable from interrupts and other tasks
+			 *
+			 * @param type of posted event
+			 */
+			static void post(const EventType type);
+
+			/**
+			 * Gets and removes oldest event
+			 *
+			 * @param type of polled event
+			 * @return false if queue is empty
+			 */
+			static bool poll(EventType& type);
+
+			/**
+			 * Blocks until an event is posted, next timer deadline or timeout, returns at once if an event is queued
+			 * EVENT_TIMER is posted when a timer deadline ends the wait
+			 *
+			 * @param timeout    maximum time to block in ms
+			 * @param lightSleep if true device light sleeps, only allowed while wifi is off
+			 */
+			static void wait(const uint32_t timeout, const bool lightSleep);
+
+			/**
+			 * Gets number of events dropped because queue was full
+			 *
+			 * @return dropped events count
+			 */
+			static uint32_t getDroppedCount();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
@@ -3,11 +3,12 @@
 
 // Lib includes
 #include "ArduinoJson.h"
-#include "M5StickC.h"
 
 // local Includes
 #include "Defines.hpp"
+#include "Hal.hpp"
 #include "Led.hpp"
+#include "Scheduler.hpp"
 #include "Screen.hpp"
 #include "Time.hpp"
 
@@ -40,22 +41,46 @@ namespace CrowOs {
 
 			/**
 			 * Called after Feature creation before loop when state changes to this feature
-			 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+			 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 			 *
 			 * @param screenHelper Screen helper used to manage screen
 			 * @param timeHelper   Time helper used to manage upTime and sleepTime
 			 * @param ledHelper    Led helper used to manage Led state
-			 * @param savedData    pointer to feature persistent data
 			 */
-			virtual void onStart(Screen* screenHelper, Time* timeHelper, Led* ledHelper, DynamicJsonDocument* savedData) = 0;
+			virtual void onStart(Screen* screenHelper, Time* timeHelper, Led* ledHelper) = 0;
 
 			/**
 			 * Called before Feature destroying after loop when state changes from this feature to another
-			 * You should destroy all your variables here and save the persistent one into savedData pointer
+			 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
+			 */
+			virtual void onStop() = 0;
+
+			/**
+			 * Indicates if feature can be suspended instead of being destroyed when state changes from this feature to another
+			 * Default implementation returns false
 			 *
-			 * @param savedData pointer to feature persistent data
+			 * @return true if feature implements onSuspend and onResume
+			 */
+			virtual const bool canSuspend() const;
+
+			/**
+			 * Called after loop instead of onStop when state changes from this feature to another and feature can be suspended
+			 * You should release what must not run in background here, such as pending requests, and keep what your view needs to be shown again
+			 * A suspended feature may be stopped with onStop and destroyed without being resumed
+			 * Default implementation does nothing
 			 */
-			virtual void onStop(DynamicJsonDocument* savedData) = 0;
+			virtual void onSuspend();
+
+			/**
+			 * Called instead of onStart when state changes back to this suspended feature
+			 * You should show your view again from kept variables here, persistent ones are read from state given by the feature factory
+			 * Default implementation does nothing
+			 *
+			 * @param screenHelper Screen helper used to manage screen
+			 * @param timeHelper   Time helper used to manage upTime and sleepTime
+			 * @param ledHelper    Led helper used to manage Led state
+			 */
+			virtual void onResume(Screen* screenHelper, Time* timeHelper, Led* ledHelper);
 
 			/**
 			 * Main Feature loop
@@ -73,6 +98,39 @@ namespace CrowOs {
 			 */
 			virtual void onHomeDoubleClick() = 0;
 
+			/**
+			 * Indicates if feature has something to draw at next frame
+			 * When no feature needs a frame main loop blocks until next button, timer or network event
+			 * Default implementation always returns true
+			 *
+			 * @return true if loop should be called again as soon as possible
+			 */
+			virtual const bool needsFrame() const;
+
+			/**
+			 * Gets frame rate wanted while feature needs frames
+			 * Default implementation returns DEFAULT_TARGET_FPS
+			 *
+			 * @return target fps
+			 */
+			virtual const double getTargetFps() const;
+
+			/**
+			 * Gets frame rate feature is looped at while it does not need frames
+			 * Default implementation returns DEFAULT_MIN_FPS
+			 *
+			 * @return minimum fps
+			 */
+			virtual const double getMinFps() const;
+
+			/**
+			 * Indicates if main loop should run at MAX_FPS during input bursts instead of target fps
+			 * Default implementation returns false
+			 *
+			 * @return true if feature wants a frame rate burst on input
+			 */
+			virtual const bool burstOnInput() const;
+
 			/**
 			 * Gets the name of this feature
 			 *
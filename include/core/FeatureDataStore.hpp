@@ -0,0 +1,85 @@
+#ifndef FEATURE_DATA_STORE_H
+#define FEATURE_DATA_STORE_H
+
+// local Includes
+#include "Defines.hpp"
+#include "FeatureFactory.hpp"
+#include "Hal.hpp"
+#include "SavedDataRecord.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Local copy of feature saved data
+		 *
+		 * Saved data of every factory is mirrored to Hal::Storage so that features start from it at boot without waiting for wifi
+		 * Each record is stamped with the content hash of server saved data it is based on, so after load a factory is dirty only if it changed locally since last sync
+		 * Records are written only when saved data, its stamp or its id changed
+		 * A record whose saved data differs from its stamp is not stored on server yet, Journal replays it instead of writing a record of its own
+		 */
+		class FeatureDataStore {
+
+		private:
+			/** Maximum number of stored factories */
+			static const uint8_t MAX_ENTRIES = 8;
+
+			/** Storage key prefix of local copy records */
+			static const char KEY_PREFIX = 'm';
+
+			/**
+			 * Last written record of one factory
+			 */
+			struct Entry {
+				/** Stored factory */
+				FeatureFactory* factory;
+				/** Content hash of stored saved data */
+				uint32_t savedDataHash;
+				/** Stored version */
+				uint32_t version;
+				/** Stored id */
+				int32_t id;
+			};
+
+			/** Store entries */
+			static Entry entries[MAX_ENTRIES];
+
+			/** Number of used entries */
+			static uint8_t entryCount;
+
+			/**
+			 * Builds storage key of factory
+			 *
+			 * @param factory stored factory
+			 * @param key     filled with SavedDataRecord::KEY_SIZE characters and terminating zero
+			 */
+			static void getKey(const FeatureFactory* factory, char* key);
+
+			/**
+			 * Finds entry of factory and creates it if needed
+			 *
+			 * @param factory stored factory
+			 * @return entry or NULL if store is full
+			 */
+			static Entry* findEntry(FeatureFactory* factory);
+
+		public:
+			/**
+			 * Loads local copy into saved data, id and synced hash of feature factories
+			 * Must be called after feature factories were initialised
+			 *
+			 * @return number of restored factories
+			 */
+			static uint8_t load();
+
+			/**
+			 * Writes actual saved data of factory if it changed since it was last stored
+			 *
+			 * @param factory feature factory
+			 */
+			static void store(FeatureFactory* factory);
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
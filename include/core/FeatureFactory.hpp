@@ -1,20 +1,11 @@
 #ifndef FEATURE_FACTORY_H
 #define FEATURE_FACTORY_H
 
-// Lib includes
-#include <vector>
-
 // local Includes
 #include "Defines.hpp"
 #include "Feature.hpp"
-
-// Methods
-
-/**
- * Initialise all feature factories
- * You should implement this method in order to declare feature factories to the os
- */
-void initialiseFeatureFactories();
+#include "FeatureRegistry.hpp"
+#include "JsonPool.hpp"
 
 namespace CrowOs {
 	namespace Core {
@@ -33,23 +24,48 @@ namespace CrowOs {
 			/** Feature factory name */
 			const char* featureFactoryName;
 
+			/** Hash of feature factory name */
+			const uint32_t nameHash;
+
 			/** Indicates if feature made by this factory should be always in a main loop */
 			const bool alwaysLoop;
 
+			/** Content hash of actual saved data */
+			uint32_t savedDataHash;
+
+			/** Content hash of saved data last stored on server */
+			uint32_t syncedHash;
+
+			/** Content hash of state when saved data was last written or read */
+			uint32_t stateHash;
+
 			/**
-			 * Verifies if given featureFactory has same name as this one
+			 * Hashes state bytes with FNV-1a
 			 *
-			 * @param  featureFactory to verify
-			 * @return true if featureFactory.name is same
+			 * @return content hash of state, same for every factory without state
 			 */
-			const bool hasSameName(const FeatureFactory* featureFactory) const;
+			const uint32_t hashState() const;
+
+			/**
+			 * Sets feature factory id in database
+			 * Use FeatureRegistry::setFeatureFactoryId so that factory is found by its id
+			 *
+			 * @param id to be set
+			 */
+			void setFeatureFactoryId(long id);
+
+			friend class FeatureRegistry;
 
 		public:
-			/** Feature factories static holder */
-			static std::vector<std::pair<FeatureFactory*, String>> featureFactories;
+			/** Factories of features switched by the user and their saved data, built from FEATURE_DESCRIPTORS */
+			static FeatureRegistry featureFactories;
+
+			/** Factories of alwaysLoop = true features, built from PERMANENT_FEATURE_DESCRIPTORS */
+			static FeatureRegistry permanentFactories;
 
 			/**
 			 * Initialise Feature factory
+			 * Factories are static objects, they are known to the os once described in a descriptor table
 			 *
 			 * @param featureFactoryName indicates name of this feature factory
 			 * @param alwaysLoop         indicates if feature made by this factory should be always in a main loop default false
@@ -73,18 +89,54 @@ namespace CrowOs {
 			virtual Feature* createFeature() = 0;
 
 			/**
-			 * Gets the feature factory id from database
+			 * Gets state kept in memory between activations of features made by this factory
+			 * Features read and write it directly, it is converted to json only when saved data is read or written
+			 * Default implementation returns NULL, use StatefulFeatureFactory to give features a typed state
 			 *
-			 * @return feature FeatureFactory id
+			 * @return pointer to plain old data state or NULL if features have no state
 			 */
-			const long getFeatureFactoryId() const;
+			virtual const void* getState() const;
 
 			/**
-			 * Sets feature factory id in database
+			 * Gets size of state
+			 * Default implementation returns 0
 			 *
-			 * @param id to be set
+			 * @return state size in bytes
 			 */
-			void setFeatureFactoryId(long id);
+			virtual const size_t getStateSize() const;
+
+			/**
+			 * Restores state from saved data, missing fields should keep their actual value
+			 * May lease up to JSON_STATE_LEASES JsonPool documents
+			 * Default implementation does nothing
+			 *
+			 * @param savedData parsed saved data
+			 */
+			virtual void readState(const JsonDocument& savedData);
+
+			/**
+			 * Writes state into saved data
+			 * May lease up to JSON_STATE_LEASES JsonPool documents
+			 * Default implementation does nothing
+			 *
+			 * @param savedData to fill
+			 */
+			virtual void writeState(JsonDocument& savedData) const;
+
+			/**
+			 * Warms data of next feature made by this factory in background, called on main loop while the feature shown before it runs and wifi is connected
+			 * Must never wait, submit requests to NetworkTask and keep their results in factory so that feature shows them on its first frame
+			 * Called on every frame, implementation has to hold off its own requests
+			 * Default implementation does nothing
+			 */
+			virtual void prefetch();
+
+			/**
+			 * Gets the feature factory id from database
+			 *
+			 * @return feature FeatureFactory id
+			 */
+			const long getFeatureFactoryId() const;
 
 			/**
 			 * Gets feature factory name
@@ -93,12 +145,76 @@ namespace CrowOs {
 			 */
 			const char* getFeatureFactoryName() const;
 
+			/**
+			 * Gets hash of feature factory name
+			 *
+			 * @return FeatureRegistry::hashName of featureFactoryName
+			 */
+			const uint32_t getNameHash() const;
+
 			/**
 			 * Indicates if feature made by this factory should be always in a main loop
 			 *
 			 * @return alwayLoop boolean
 			 */
 			const bool isAlwaysLoop() const;
+
+			/**
+			 * Updates content hash of saved data and restores state from it, must be called each time saved data of this factory is replaced
+			 *
+			 * @param savedData new saved data
+			 */
+			void setSavedData(const String& savedData);
+
+			/**
+			 * Serializes state into saved data if it changed since saved data was last written or read
+			 *
+			 * @param savedData saved data of this factory, rewritten only if state changed
+			 * @return true if saved data was rewritten
+			 */
+			const bool updateSavedData(String& savedData);
+
+			/**
+			 * Indicates if saved data changed since it was last stored on server
+			 *
+			 * @return true if saved data has to be sent to server
+			 */
+			const bool isDirty() const;
+
+			/**
+			 * Marks actual saved data as stored on server
+			 */
+			void markSynced();
+
+			/**
+			 * Marks saved data of given content hash as stored on server
+			 * Saved data written after it was sent stays dirty
+			 *
+			 * @param hash content hash of stored saved data
+			 */
+			void markSynced(const uint32_t hash);
+
+			/**
+			 * Gets content hash of actual saved data
+			 *
+			 * @return content hash
+			 */
+			const uint32_t getSavedDataHash() const;
+
+			/**
+			 * Gets content hash of saved data last stored on server
+			 *
+			 * @return content hash
+			 */
+			const uint32_t getSyncedHash() const;
+
+			/**
+			 * Hashes saved data with FNV-1a
+			 *
+			 * @param savedData to hash
+			 * @return content hash
+			 */
+			static uint32_t hashSavedData(const String& savedData);
 		};
 
 	} // namespace Core
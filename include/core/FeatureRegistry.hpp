@@ -0,0 +1,215 @@
+#ifndef FEATURE_REGISTRY_H
+#define FEATURE_REGISTRY_H
+
+// Lib includes
+#include <utility>
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+#include "Hash.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		class FeatureFactory;
+
+		/**
+		 * Compile time description of a static feature factory
+		 */
+		struct FeatureDescriptor {
+			/** Feature factory name, same as the one given to its constructor */
+			const char* name;
+			/** FNV-1a hash of name */
+			uint32_t nameHash;
+			/** Static feature factory */
+			FeatureFactory* factory;
+		};
+
+		/**
+		 * Fixed size registry of feature factories and their saved data built over a constexpr descriptor table
+		 *
+		 * Descriptors and their name hashes are computed at compile time, entries and name index are built from them during static initialisation so nothing is registered at run time
+		 * Entries are found in O(1) by name through an open addressing index of name hashes and by database id through an index updated each time an id is set
+		 */
+		class FeatureRegistry {
+
+		public:
+			/** Registered factory and its saved data */
+			typedef std::pair<FeatureFactory*, String> Entry;
+
+			/** Maximum number of registered factories */
+			static const uint8_t MAX_FACTORIES = MAX_FEATURE_FACTORIES;
+
+		private:
+			/** Index size, power of two at least twice MAX_FACTORIES so that probes stay short */
+			static const uint8_t INDEX_SIZE = 16;
+
+			/** Empty index slot */
+			static const uint8_t NO_ENTRY = 0xFF;
+
+			static_assert((INDEX_SIZE & (INDEX_SIZE - 1)) == 0 && INDEX_SIZE >= 2 * MAX_FACTORIES, "INDEX_SIZE must be a power of two at least twice MAX_FACTORIES");
+
+			/** Descriptors of entries, in entries order */
+			const FeatureDescriptor* descriptors;
+
+			/** Registered entries in descriptors order */
+			Entry entries[MAX_FACTORIES];
+
+			/** Number of registered entries */
+			uint8_t entryCount;
+
+			/** Entry index of each name hash slot */
+			uint8_t nameIndex[INDEX_SIZE];
+
+			/** Entry index of each database id slot */
+			uint8_t idIndex[INDEX_SIZE];
+
+			/**
+			 * Finds name index slot of hash
+			 *
+			 * @param nameHash factory name hash
+			 * @param name     factory name compared on hash collisions
+			 * @return slot holding name or first empty slot of its probe sequence
+			 */
+			uint8_t findNameSlot(const uint32_t nameHash, const char* name) const;
+
+			/**
+			 * Finds id index slot of database id
+			 *
+			 * @param id feature factory id in database
+			 * @return slot holding id or first empty slot of its probe sequence
+			 */
+			uint8_t findIdSlot(const long id) const;
+
+			/**
+			 * Rebuilds id index from ids of registered factories
+			 */
+			void indexIds();
+
+		public:
+			/**
+			 * Builds registry from descriptor table
+			 * Only descriptors are read, factories may not be constructed yet
+			 *
+			 * @param descriptors     static descriptor table
+			 * @param descriptorCount number of descriptors, at most MAX_FACTORIES are registered
+			 */
+			FeatureRegistry(const FeatureDescriptor* descriptors, const size_t descriptorCount);
+
+			/**
+			 * Hashes feature factory name with FNV-1a, evaluated at compile time for literals
+			 *
+			 * @param name to hash
+			 * @param hash hash of preceding characters
+			 * @return name hash, same as Hash::fnv1a and FeatureFactory::hashSavedData of name
+			 */
+			constexpr static uint32_t hashName(const char* name, const uint32_t hash = Hash::FNV1A_OFFSET_BASIS) {
+				return *name == '\0' ? hash : hashName(name + 1, (hash ^ (uint8_t)*name) * Hash::FNV1A_PRIME);
+			}
+
+			/**
+			 * Describes static feature factory at compile time
+			 *
+			 * @param name    feature factory name
+			 * @param factory static feature factory
+			 * @return descriptor of factory
+			 */
+			constexpr static FeatureDescriptor describe(const char* name, FeatureFactory* factory) {
+				return FeatureDescriptor{name, hashName(name), factory};
+			}
+
+			/**
+			 * Finds entry by factory name
+			 *
+			 * @param name factory name
+			 * @return entry or NULL if name is not registered
+			 */
+			Entry* find(const char* name);
+
+			/**
+			 * Finds entry by feature factory id in database
+			 *
+			 * @param id feature factory id
+			 * @return entry or NULL if no registered factory has this id
+			 */
+			Entry* find(const long id);
+
+			/**
+			 * Finds entry of factory
+			 *
+			 * @param factory registered factory
+			 * @return entry or NULL if factory is not registered
+			 */
+			Entry* find(const FeatureFactory* factory);
+
+			/**
+			 * Sets feature factory id in database and indexes it
+			 *
+			 * @param entry entry of this registry
+			 * @param id    to be set
+			 */
+			void setFeatureFactoryId(Entry* entry, const long id);
+
+			/**
+			 * Gets index of entry
+			 *
+			 * @param entry entry of this registry
+			 * @return entry index
+			 */
+			const int indexOf(const Entry* entry) const;
+
+			/**
+			 * Gets number of registered factories
+			 *
+			 * @return registered factories count
+			 */
+			const size_t size() const;
+
+			/**
+			 * Gets entry by index
+			 *
+			 * @param index entry index, must be lower than size
+			 * @return entry
+			 */
+			Entry& operator[](const size_t index);
+
+			/**
+			 * Gets first entry
+			 *
+			 * @return first entry
+			 */
+			Entry* begin();
+
+			/**
+			 * Gets end of entries
+			 *
+			 * @return entry after the last one
+			 */
+			Entry* end();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+// Descriptor tables
+
+/**
+ * Descriptors of features switched by the user in switching order
+ * You should define this table in order to declare feature factories to the os, see FeatureInitialiser.cpp
+ */
+extern const CrowOs::Core::FeatureDescriptor FEATURE_DESCRIPTORS[];
+
+/** Number of FEATURE_DESCRIPTORS */
+extern const size_t FEATURE_DESCRIPTORS_SIZE;
+
+/**
+ * Descriptors of alwaysLoop = true features
+ * You should define this table in order to declare permanent feature factories to the os, see FeatureInitialiser.cpp
+ */
+extern const CrowOs::Core::FeatureDescriptor PERMANENT_FEATURE_DESCRIPTORS[];
+
+/** Number of PERMANENT_FEATURE_DESCRIPTORS */
+extern const size_t PERMANENT_FEATURE_DESCRIPTORS_SIZE;
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef FEATURE_STANDBY_H
+#define FEATURE_STANDBY_H
+
+// local Includes
+#include "Defines.hpp"
+#include "Feature.hpp"
+#include "FeatureFactory.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Suspended feature instances kept warm between activations
+		 *
+		 * Features that can be suspended are kept here instead of being deleted when user switches away from them, switching back resumes them with their view and caches
+		 * At most MAX_SUSPENDED instances are kept, the least recently suspended one has to be evicted and stopped before another one is suspended
+		 */
+		class FeatureStandby {
+
+		public:
+			/** Maximum number of suspended features */
+			static const uint8_t MAX_SUSPENDED = FEATURE_STANDBY_SIZE;
+
+			/**
+			 * Suspended feature and its factory
+			 */
+			struct Entry {
+				/** Factory that made feature */
+				FeatureFactory* factory;
+				/** Suspended feature */
+				Feature* feature;
+			};
+
+		private:
+			/** Suspended entries from least to most recently suspended */
+			static Entry entries[MAX_SUSPENDED];
+
+			/** Number of suspended entries */
+			static uint8_t entryCount;
+
+			/**
+			 * Removes entry and shifts more recent ones
+			 *
+			 * @param index of removed entry
+			 */
+			static void removeEntry(const uint8_t index);
+
+		public:
+			/**
+			 * Keeps suspended feature as most recently suspended one
+			 * Standby must not be full
+			 *
+			 * @param factory that made feature
+			 * @param feature suspended feature
+			 */
+			static void suspend(FeatureFactory* factory, Feature* feature);
+
+			/**
+			 * Takes suspended feature of factory out of standby
+			 *
+			 * @param factory feature factory
+			 * @return suspended feature or NULL if none of factory features is suspended
+			 */
+			static Feature* take(const FeatureFactory* factory);
+
+			/**
+			 * Takes least recently suspended feature out of standby
+			 *
+			 * @param entry filled with evicted feature and its factory
+			 * @return false if standby is empty
+			 */
+			static const bool evict(Entry& entry);
+
+			/**
+			 * Indicates if a feature has to be evicted before another one is suspended
+			 *
+			 * @return true if MAX_SUSPENDED features are suspended
+			 */
+			static const bool isFull();
+
+			/**
+			 * Gets number of suspended features
+			 *
+			 * @return suspended features count
+			 */
+			static uint8_t getSuspendedCount();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
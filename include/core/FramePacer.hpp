@@ -0,0 +1,110 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+// local Includes
+#include "Defines.hpp"
+#include "Events.hpp"
+#include "Hal.hpp"
+#include "Profiler.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Frame pacer
+		 *
+		 * Starts frames on a fixed cadence : each deadline is the previous deadline plus one period so that late frames do not drift the rate
+		 * Waiting goes through Events::wait so buttons, timers and network completions start a frame at once
+		 * A frame starting more than one period late resyncs the cadence and counts the skipped deadlines as missed
+		 */
+		class FramePacer {
+
+		private:
+			/** Statistics are reported once per REPORT_PERIOD us */
+			static const uint32_t REPORT_PERIOD = 5000000;
+
+			/** Frame rate upper bound */
+			const double maxFps;
+
+			/** Current frame rate */
+			double frameRate;
+
+			/** Current frame period in us */
+			uint64_t period;
+
+			/** Clock time of last frame start in us */
+			uint64_t lastFrameTime;
+
+			/** Clock time of next frame deadline in us */
+			uint64_t nextFrameTime;
+
+			/** Clock time of last report in us */
+			uint64_t reportTime;
+
+			/** Number of frames since reportTime */
+			uint32_t frames;
+
+			/** Number of missed deadlines since reportTime */
+			uint32_t missedDeadlines;
+
+			/** Worst frame start lateness since reportTime in us */
+			uint64_t maxLateness;
+
+			/** Number of missed deadlines since boot */
+			uint32_t totalMissedDeadlines;
+
+			/**
+			 * Logs fps and missed deadlines once per REPORT_PERIOD
+			 *
+			 * @param now clock time in us
+			 */
+			void report(const uint64_t now);
+
+		public:
+			/**
+			 * Initialise frame pacer
+			 *
+			 * @param maxFps frame rate upper bound
+			 */
+			FramePacer(const double maxFps);
+
+			/**
+			 * Sets frame rate, cadence restarts from last frame so that rate changes are never counted as missed deadlines
+			 *
+			 * @param fps frame rate, clamped to maxFps
+			 */
+			void setFrameRate(const double fps);
+
+			/**
+			 * Blocks until next frame deadline or next event
+			 *
+			 * @param lightSleep if true device light sleeps while waiting, only allowed while wifi is off
+			 */
+			void waitNextFrame(const bool lightSleep);
+
+			/**
+			 * Gets current frame rate
+			 *
+			 * @return frame rate
+			 */
+			double getFrameRate() const;
+
+			/**
+			 * Gets frame rate upper bound
+			 *
+			 * @return max fps
+			 */
+			double getMaxFps() const;
+
+			/**
+			 * Gets number of missed frame deadlines since boot
+			 *
+			 * @return missed deadlines count
+			 */
+			uint32_t getMissedDeadlines() const;
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
@@ -0,0 +1,969 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Lib includes
+#include "Arduino.h"
+#ifndef CROWOS_NATIVE
+	#include "HTTPClient.h"
+	#include "M5StickC.h"
+	#include "WiFi.h"
+#endif
+
+// local Includes
+#include "Defines.hpp"
+#include "Log.hpp"
+
+#ifdef CROWOS_NATIVE
+	// M5StickC definitions used by the os that are not available off device
+	#define TFT_WIDTH 80
+	#define TFT_HEIGHT 160
+
+	#define TFT_BLACK 0x0000
+	#define TFT_WHITE 0xFFFF
+	#define TFT_RED 0xF800
+	#define TFT_GREEN 0x07E0
+	#define TFT_BLUE 0x001F
+	#define TFT_CYAN 0x07FF
+	#define BLACK TFT_BLACK
+	#define WHITE TFT_WHITE
+	#define RED TFT_RED
+	#define GREEN TFT_GREEN
+	#define BLUE TFT_BLUE
+
+	#define M5_LED 10
+	#define BUTTON_A_PIN 37
+	#define BUTTON_B_PIN 39
+	#define G36 36
+	#define IRAM_ATTR
+
+typedef struct {
+	uint8_t Hours;
+	uint8_t Minutes;
+	uint8_t Seconds;
+} RTC_TimeTypeDef;
+#endif
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Hardware abstraction layer
+		 *
+		 * Core and features talk to the device only through this layer
+		 * Esp32 backend forwards to M5StickC, WiFi and HTTPClient, native backend emulates the device on Linux
+		 */
+		namespace Hal {
+
+			/**
+			 * Wifi connection status
+			 */
+			enum WifiStatus {
+				WIFI_IDLE,
+				WIFI_NO_SSID_AVAILABLE,
+				WIFI_SCAN_COMPLETED,
+				WIFI_CONNECTED,
+				WIFI_DISCONNECTED,
+				WIFI_ERROR
+			};
+
+			/**
+			 * Power button events as reported by the PMIC
+			 */
+			enum PowerButtonEvent {
+				POWER_BUTTON_NONE = 0x00,
+				POWER_BUTTON_LONG_CLICK = 0x01,
+				POWER_BUTTON_CLICK = 0x02
+			};
+
+			/**
+			 * Initialise the board
+			 */
+			void begin();
+
+			/**
+			 * Off screen RGB565 drawing surface
+			 *
+			 * Drawing never touches the bus, pixels reach the lcd only through Display::pushCanvas
+			 * Esp32 backend is a TFT_eSprite, native backend rasterizes into a plain buffer
+			 */
+			class Canvas {
+
+			private:
+				/** Canvas pixels in panel byte order, NULL until created */
+				uint16_t* buffer;
+
+				/** Canvas width */
+				int32_t width;
+
+				/** Canvas height */
+				int32_t height;
+
+#ifndef CROWOS_NATIVE
+				/** Sprite owning the pixels */
+				TFT_eSprite sprite;
+#else
+				/** Text cursor x position */
+				int32_t cursorX;
+
+				/** Text cursor y position */
+				int32_t cursorY;
+
+				/** Text foreground color */
+				uint16_t textForegroundColor;
+
+				/** Text background color */
+				uint16_t textBackgroundColor;
+
+				/**
+				 * Writes one pixel clipping it to the canvas
+				 *
+				 * @param x     pixel x position
+				 * @param y     pixel y position
+				 * @param color to write
+				 */
+				void writePixel(const int32_t x, const int32_t y, const uint16_t color);
+#endif
+
+			public:
+				/**
+				 * Initialise empty canvas
+				 */
+				Canvas();
+
+				/**
+				 * Frees canvas pixels
+				 */
+				~Canvas();
+
+				/**
+				 * Allocates canvas pixels, previous content is lost
+				 *
+				 * @param width  canvas width
+				 * @param height canvas height
+				 * @return true if pixels are allocated
+				 */
+				bool create(const int32_t width, const int32_t height);
+
+				/**
+				 * Gets canvas width
+				 *
+				 * @return canvas width
+				 */
+				int32_t getWidth() const;
+
+				/**
+				 * Gets canvas height
+				 *
+				 * @return canvas height
+				 */
+				int32_t getHeight() const;
+
+				/**
+				 * Gets canvas pixels
+				 *
+				 * @return canvas pixels in panel byte order or NULL if canvas is not created
+				 */
+				const uint16_t* getBuffer() const;
+
+				/**
+				 * Gets text cursor x position
+				 *
+				 * @return cursor x position
+				 */
+				int32_t getCursorX();
+
+				/**
+				 * Gets text cursor y position
+				 *
+				 * @return cursor y position
+				 */
+				int32_t getCursorY();
+
+				/**
+				 * Fills whole canvas with color
+				 *
+				 * @param color to fill with
+				 */
+				void fillScreen(const uint16_t color);
+
+				/**
+				 * Fills rectangle
+				 *
+				 * @param x     rectangle x position
+				 * @param y     rectangle y position
+				 * @param w     rectangle width
+				 * @param h     rectangle height
+				 * @param color to fill with
+				 */
+				void fillRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t color);
+
+				/**
+				 * Fills rounded rectangle
+				 *
+				 * @param x      rectangle x position
+				 * @param y      rectangle y position
+				 * @param w      rectangle width
+				 * @param h      rectangle height
+				 * @param radius corner radius
+				 * @param color  to fill with
+				 */
+				void fillRoundRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const int32_t radius, const uint16_t color);
+
+				/**
+				 * Draws rectangle outline
+				 *
+				 * @param x     rectangle x position
+				 * @param y     rectangle y position
+				 * @param w     rectangle width
+				 * @param h     rectangle height
+				 * @param color to draw with
+				 */
+				void drawRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t color);
+
+				/**
+				 * Draws line
+				 *
+				 * @param x0    start x position
+				 * @param y0    start y position
+				 * @param x1    end x position
+				 * @param y1    end y position
+				 * @param color to draw with
+				 */
+				void drawLine(const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1, const uint16_t color);
+
+				/**
+				 * Draws circle outline
+				 *
+				 * @param x      center x position
+				 * @param y      center y position
+				 * @param radius circle radius
+				 * @param color  to draw with
+				 */
+				void drawCircle(const int32_t x, const int32_t y, const int32_t radius, const uint16_t color);
+
+				/**
+				 * Fills circle
+				 *
+				 * @param x      center x position
+				 * @param y      center y position
+				 * @param radius circle radius
+				 * @param color  to fill with
+				 */
+				void fillCircle(const int32_t x, const int32_t y, const int32_t radius, const uint16_t color);
+
+				/**
+				 * Draws RGB565 image
+				 *
+				 * @param x    image x position
+				 * @param y    image y position
+				 * @param w    image width
+				 * @param h    image height
+				 * @param data image pixels
+				 */
+				void pushImage(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t* data);
+
+				/**
+				 * Draws RGB565 image skipping transparent pixels
+				 *
+				 * @param x           image x position
+				 * @param y           image y position
+				 * @param w           image width
+				 * @param h           image height
+				 * @param data        image pixels
+				 * @param transparent color that is not drawn
+				 */
+				void pushImage(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t* data, const uint16_t transparent);
+
+				/**
+				 * Copies top left area of another canvas
+				 *
+				 * @param x      destination x position
+				 * @param y      destination y position
+				 * @param source canvas to copy from
+				 * @param w      area width
+				 * @param h      area height
+				 */
+				void pushCanvas(const int32_t x, const int32_t y, const Canvas& source, const int32_t w, const int32_t h);
+
+				/**
+				 * Sets text colors
+				 *
+				 * @param foregroundColor text foreground color
+				 * @param backgroundColor text background color
+				 */
+				void setTextColor(const uint16_t foregroundColor, const uint16_t backgroundColor);
+
+				/**
+				 * Sets text cursor
+				 *
+				 * @param x cursor x position
+				 * @param y cursor y position
+				 */
+				void setCursor(const int32_t x, const int32_t y);
+
+				/**
+				 * Prints text at cursor position wrapping at canvas width
+				 *
+				 * @param text to print
+				 */
+				void print(const char* text);
+			};
+
+			/**
+			 * Lcd display
+			 */
+			class Display {
+
+			public:
+				/**
+				 * Initialise display
+				 */
+				static void begin();
+
+				/**
+				 * Sets display rotation
+				 *
+				 * @param rotation to set
+				 */
+				static void setRotation(const uint8_t rotation);
+
+				/**
+				 * Pushes canvas area at the same position on the display in one bus transaction
+				 *
+				 * @param canvas to push from, must have the display size for current rotation
+				 * @param x      area x position
+				 * @param y      area y position
+				 * @param w      area width
+				 * @param h      area height
+				 */
+				static void pushCanvas(const Canvas& canvas, const int32_t x, const int32_t y, const int32_t w, const int32_t h);
+			};
+
+			/**
+			 * AXP192 power management chip
+			 */
+			class Pmic {
+
+			public:
+				/**
+				 * Initialise power management
+				 */
+				static void begin();
+
+				/**
+				 * Sets screen back light brightness
+				 *
+				 * @param brightness between 7 and 15
+				 */
+				static void setScreenBrightness(const uint8_t brightness);
+
+				/**
+				 * Gets battery voltage
+				 *
+				 * @return battery voltage in V
+				 */
+				static float getBatteryVoltage();
+
+				/**
+				 * Gets battery current
+				 *
+				 * @return battery current in mA, positive while charging
+				 */
+				static float getBatteryCurrent();
+
+				/**
+				 * Gets and clears last power button event
+				 *
+				 * @return power button event
+				 */
+				static PowerButtonEvent getPowerButtonEvent();
+
+				/**
+				 * Puts screen and peripherals on sleep
+				 */
+				static void sleep();
+
+				/**
+				 * Powers the device off
+				 */
+				static void powerOff();
+			};
+
+			/**
+			 * Real time clock
+			 */
+			class Rtc {
+
+			public:
+				/**
+				 * Sets rtc time
+				 *
+				 * @param time to set
+				 */
+				static void setTime(const RTC_TimeTypeDef& time);
+
+				/**
+				 * Gets rtc time
+				 *
+				 * @param time to store into
+				 */
+				static void getTime(RTC_TimeTypeDef& time);
+			};
+
+			/**
+			 * MPU6886 inertial measurement unit
+			 */
+			class Imu {
+
+			public:
+				/**
+				 * Initialise imu
+				 */
+				static void begin();
+
+				/**
+				 * Gets accelerometer data
+				 *
+				 * @param x acceleration on x axis in g
+				 * @param y acceleration on y axis in g
+				 * @param z acceleration on z axis in g
+				 */
+				static void getAccelData(float* x, float* y, float* z);
+			};
+
+			/**
+			 * Analog to digital converter
+			 */
+			class Adc {
+
+			public:
+				/**
+				 * Reads analog pin
+				 *
+				 * @param pin to read
+				 * @return 12 bits value
+				 */
+				static int read(const uint8_t pin);
+			};
+
+			/**
+			 * Physical buttons
+			 *
+			 * Home and up buttons are plain gpio read by OneButton, power button goes through Pmic
+			 */
+			class Buttons {
+
+			public:
+				/**
+				 * Polls button sources that are not plain gpio
+				 */
+				static void poll();
+
+				/**
+				 * Indicates if home button is actually pressed
+				 *
+				 * @return true if home button is pressed
+				 */
+				static bool isHomePressed();
+			};
+
+			/**
+			 * Monotonic clock
+			 */
+			class Clock {
+
+			public:
+				/**
+				 * Gets time since boot from the cpu timer, never wraps and costs no bus transaction
+				 *
+				 * @return microseconds since boot
+				 */
+				static uint64_t getMicroseconds();
+			};
+
+			/**
+			 * Cpu cycle counter
+			 */
+			class Cpu {
+
+			public:
+				/**
+				 * Gets cpu cycle counter, wraps around so only differences are meaningful
+				 *
+				 * @return cycle counter
+				 */
+				static uint32_t getCycleCount();
+
+				/**
+				 * Gets number of cycles per microsecond
+				 *
+				 * @return cycles per microsecond
+				 */
+				static uint32_t getCyclesPerMicrosecond();
+			};
+
+			/**
+			 * Heap statistics
+			 */
+			class Memory {
+
+			public:
+				/**
+				 * Gets number of allocated heap bytes
+				 *
+				 * @return allocated heap bytes
+				 */
+				static uint32_t getHeapUsed();
+
+				/**
+				 * Gets number of free heap bytes
+				 *
+				 * @return free heap bytes
+				 */
+				static uint32_t getHeapFree();
+
+				/**
+				 * Gets largest block that can be allocated, approximated natively by the free space at top of the heap
+				 *
+				 * @return largest free block in bytes
+				 */
+				static uint32_t getLargestFreeBlock();
+
+				/**
+				 * Gets heap fragmentation, share of free heap that is not in the largest free block
+				 *
+				 * @return fragmentation in percent
+				 */
+				static uint8_t getFragmentation();
+			};
+
+			/**
+			 * Persistent key value storage
+			 *
+			 * NVS on device, one file per key in crowos_storage directory natively
+			 * Values are written atomically, a power loss leaves either the old or the new value
+			 */
+			class Storage {
+
+			public:
+				/** Maximum key length, NVS limit */
+				static const size_t MAX_KEY_SIZE = 15;
+
+				/**
+				 * Opens storage
+				 *
+				 * @return true if storage is usable
+				 */
+				static bool begin();
+
+				/**
+				 * Gets value length
+				 *
+				 * @param key value key
+				 * @return value length in bytes, 0 if key does not exist
+				 */
+				static size_t getLength(const char* key);
+
+				/**
+				 * Reads value
+				 *
+				 * @param key    value key
+				 * @param data   to fill
+				 * @param length maximum number of bytes to read
+				 * @return number of read bytes, 0 if key does not exist
+				 */
+				static size_t read(const char* key, void* data, const size_t length);
+
+				/**
+				 * Writes value, replaces previous one
+				 *
+				 * @param key    value key
+				 * @param data   to write
+				 * @param length number of bytes to write
+				 * @return true if value is written
+				 */
+				static bool write(const char* key, const void* data, const size_t length);
+
+				/**
+				 * Removes value
+				 *
+				 * @param key value key
+				 */
+				static void remove(const char* key);
+
+				/**
+				 * Removes every value
+				 */
+				static void clear();
+			};
+
+			/**
+			 * Background tasks
+			 *
+			 * FreeRTOS tasks on device, detached threads natively
+			 */
+			class Task {
+
+			public:
+				/**
+				 * Starts function in a new task
+				 *
+				 * @param function  task body, must never return
+				 * @param parameter passed to function
+				 * @param name      task name
+				 * @param stackSize task stack size in bytes
+				 * @param priority  task priority, main loop runs at 1, ignored natively
+				 * @param core      core the task is pinned to, main loop runs on core 1, ignored natively
+				 * @return true if task is started
+				 */
+				static bool start(void (*function)(void*), void* parameter, const char* name, const uint32_t stackSize, const uint8_t priority, const uint8_t core);
+			};
+
+			/**
+			 * Sources that wake the main loop from Idle::wait
+			 */
+			enum WakeSource {
+				WAKE_BUTTON,
+				WAKE_POWER_BUTTON
+			};
+
+			/**
+			 * Main loop idling
+			 *
+			 * Button gpio and PMIC interrupts on device, stdin natively, are reported to a handler that may wake the main loop
+			 * Esp32 backend blocks on a task notification or light sleeps, native backend blocks on a condition variable
+			 */
+			class Idle {
+
+			public:
+				/**
+				 * Arms wake sources, must be called from the main loop task
+				 *
+				 * @param handler called from interrupt context on device when a wake source fires
+				 */
+				static void begin(void (*handler)(const WakeSource source));
+
+				/**
+				 * Blocks main loop until wake is called or timeout expires
+				 *
+				 * @param timeout    maximum time to block in ms
+				 * @param lightSleep if true device light sleeps, only allowed while wifi is off as light sleep drops the association
+				 * @return true if woken before timeout
+				 */
+				static bool wait(const uint32_t timeout, const bool lightSleep);
+
+				/**
+				 * Wakes main loop, callable from interrupts and other tasks
+				 */
+				static void wake();
+
+				/**
+				 * Enters critical section shared with interrupts
+				 */
+				static void lock();
+
+				/**
+				 * Leaves critical section shared with interrupts
+				 */
+				static void unlock();
+			};
+
+			/**
+			 * Wifi station
+			 */
+			class Wifi {
+
+			public:
+				/**
+				 * Connects using stored credentials
+				 */
+				static void begin();
+
+				/**
+				 * Starts smart config
+				 */
+				static void beginSmartConfig();
+
+				/**
+				 * Indicates if smart config is done
+				 *
+				 * @return true if smart config is done
+				 */
+				static bool smartConfigDone();
+
+				/**
+				 * Reconnects to the access point
+				 */
+				static void reconnect();
+
+				/**
+				 * Disconnects from the access point
+				 *
+				 * @param wifiOff if true wifi radio is turned off
+				 */
+				static void disconnect(const bool wifiOff = false);
+
+				/**
+				 * Gets connection status
+				 *
+				 * @return connection status
+				 */
+				static WifiStatus status();
+
+				/**
+				 * Gets connected network SSID
+				 *
+				 * @return SSID
+				 */
+				static String ssid();
+
+				/**
+				 * Gets local ip address
+				 *
+				 * @return local ip address
+				 */
+				static String localIp();
+			};
+
+			/**
+			 * Timings of last http request in us
+			 */
+			struct HttpTimings {
+
+				/** Time spent opening tcp connection, 0 if connection was reused */
+				uint32_t connect;
+
+				/** Time from request sent until response headers were received */
+				uint32_t firstByte;
+
+				/** Time spent receiving response body */
+				uint32_t transfer;
+
+				/** True if request was sent over an already opened connection */
+				bool reused;
+			};
+
+			/**
+			 * Http connection
+			 *
+			 * Subset of esp32 HTTPClient used by WebClient, tcp connection is kept alive between requests to the same host
+			 * Response body is read straight from the connection through read and readBytes so it can be parsed without buffering it whole,
+			 * this makes the connection usable as ArduinoJson custom reader
+			 */
+			class HttpConnection {
+
+			private:
+				/** Size of receive buffer */
+				static const size_t BUFFER_SIZE = 256;
+
+				/** Number of response headers kept */
+				static const uint8_t COLLECTED_HEADERS_SIZE = 4;
+
+				/** Response headers kept for header, every other header is dropped while parsing */
+				static const char* COLLECTED_HEADERS[COLLECTED_HEADERS_SIZE];
+
+				/** Host of opened tcp connection */
+				String connectedHost;
+
+				/** Port of opened tcp connection */
+				uint16_t connectedPort;
+
+				/** Timings of last request */
+				HttpTimings timings;
+
+				/** Received bytes */
+				char buffer[BUFFER_SIZE];
+
+				/** Position of next unread byte in buffer */
+				size_t bufferPosition;
+
+				/** Number of received bytes in buffer */
+				size_t bufferLength;
+
+				/** Bytes left in body or in current chunk, -1 if body ends when connection closes */
+				int32_t bodyRemaining;
+
+				/** True if body uses chunked transfer encoding */
+				bool chunked;
+
+				/** True once whole body was read */
+				bool bodyComplete;
+
+				/** Time when body reading started */
+				uint64_t bodyStartTime;
+
+#ifndef CROWOS_NATIVE
+				/** Esp32 Http client instance */
+				HTTPClient http;
+
+				/** Tcp client shared by all requests */
+				WiFiClient client;
+#else
+				/** Opened socket or -1 */
+				int fd;
+
+				/** Host to connect to */
+				String host;
+
+				/** Port to connect to */
+				uint16_t port;
+
+				/** Requested uri */
+				String uri;
+
+				/** Additional request headers */
+				String headers;
+
+				/** True if server keeps connection open after response */
+				bool keepAlive;
+
+				/** Values of COLLECTED_HEADERS in last response */
+				String collectedHeaders[COLLECTED_HEADERS_SIZE];
+#endif
+
+				/**
+				 * Receives bytes from connection, implemented by each backend
+				 *
+				 * @param data   to fill
+				 * @param length maximum number of bytes to receive
+				 * @return number of received bytes, 0 if connection was closed or timed out
+				 */
+				size_t receive(char* data, const size_t length);
+
+				/**
+				 * Reads one byte from connection through receive buffer
+				 *
+				 * @return read byte or -1 if connection was closed or timed out
+				 */
+				int readRaw();
+
+				/**
+				 * Reads one CRLF terminated line from connection
+				 *
+				 * @param line filled with line content without CRLF
+				 * @return true if a whole line was read
+				 */
+				bool readLine(String& line);
+
+				/**
+				 * Starts reading response body
+				 *
+				 * @param length  body length, -1 if unknown
+				 * @param chunked true if body uses chunked transfer encoding
+				 */
+				void beginBody(const int32_t length, const bool chunked);
+
+				/**
+				 * Reads next chunk size line
+				 *
+				 * @return true if a chunk with data follows
+				 */
+				bool nextChunk();
+
+				/**
+				 * Marks body as read and stores transfer time
+				 */
+				void completeBody();
+
+				/**
+				 * Reads and drops what is left of the body
+				 *
+				 * @return true if whole body was read
+				 */
+				bool skipBody();
+
+			public:
+				/**
+				 * Initialise new http connection
+				 */
+				HttpConnection();
+
+				/**
+				 * Prepares request
+				 *
+				 * @param host to connect to
+				 * @param port to connect to
+				 * @param uri  to request
+				 * @return true if request is prepared
+				 */
+				bool begin(const char* host, const uint16_t port, const char* uri);
+
+				/**
+				 * Adds request header
+				 *
+				 * @param name  header name
+				 * @param value header value
+				 */
+				void addHeader(const char* name, const char* value);
+
+				/**
+				 * Sets basic authorization
+				 *
+				 * @param username server username
+				 * @param password server password
+				 */
+				void setAuthorization(const char* username, const char* password);
+
+				/**
+				 * Sends request and receives response headers
+				 *
+				 * @param method  http method
+				 * @param payload request body or NULL
+				 * @return http status or negative value on connection error
+				 */
+				int sendRequest(const char* method, const char* payload = NULL);
+
+				/**
+				 * Gets response header, only Transfer-Encoding, ETag, Last-Modified and Cache-Control are kept
+				 *
+				 * @param name header name
+				 * @return header value or empty string if response has no such header
+				 */
+				String header(const char* name);
+
+				/**
+				 * Reads one byte of response body
+				 *
+				 * @return read byte or -1 at end of body
+				 */
+				int read();
+
+				/**
+				 * Reads response body
+				 *
+				 * @param data   to fill
+				 * @param length maximum number of bytes to read
+				 * @return number of read bytes, less than length only at end of body
+				 */
+				size_t readBytes(char* data, const size_t length);
+
+				/**
+				 * Reads whole response body
+				 *
+				 * @return response body
+				 */
+				String getString();
+
+				/**
+				 * Gets timings of last request
+				 *
+				 * @return timings of last request
+				 */
+				const HttpTimings& getTimings() const;
+
+				/**
+				 * Ends request, unread body is dropped and tcp connection is kept open for next request
+				 */
+				void end();
+
+				/**
+				 * Closes tcp connection
+				 */
+				void close();
+			};
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
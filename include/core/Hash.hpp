@@ -0,0 +1,37 @@
+#ifndef HASH_H
+#define HASH_H
+
+// Lib includes
+#include "Arduino.h"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * FNV-1a 32 bits hashing shared by saved data, feature states, feature factory names, log messages and cached uris
+		 *
+		 * Compile time hashes of literals are constexpr recursions over FNV1A_OFFSET_BASIS and FNV1A_PRIME, runtime ones go through fnv1a so both give the same hash
+		 */
+		class Hash {
+
+		public:
+			/** FNV-1a offset basis, hash of no byte */
+			static const uint32_t FNV1A_OFFSET_BASIS = 2166136261u;
+
+			/** FNV-1a prime */
+			static const uint32_t FNV1A_PRIME = 16777619u;
+
+			/**
+			 * Hashes bytes with FNV-1a
+			 *
+			 * @param data   bytes to hash
+			 * @param length number of bytes
+			 * @param seed   hash of previous bytes default FNV1A_OFFSET_BASIS
+			 * @return hash of seed followed by data
+			 */
+			static uint32_t fnv1a(const void* data, const size_t length, const uint32_t seed = FNV1A_OFFSET_BASIS);
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
@@ -0,0 +1,131 @@
+#ifndef HTTP_CACHE_H
+#define HTTP_CACHE_H
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+#include "Hash.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Http response validators cache
+		 *
+		 * Keeps ETag, Last-Modified and Cache-Control max-age of GET responses keyed by uri hash so that the next GET of the same uri is conditional
+		 * Response bodies are not kept, a NOT_MODIFIED status tells the caller that the body it parsed last time is still valid
+		 * Each WebClient owns its cache so that only a caller that already received the body can get NOT_MODIFIED, caches are not thread safe and are only used from the main loop
+		 */
+		class HttpCache {
+
+		public:
+			/** Http status of an unchanged response, returned without request while max-age is not elapsed */
+			static const int NOT_MODIFIED = 304;
+
+			/** ETag capacity, longer ETags are not kept */
+			static const size_t ETAG_SIZE = 48;
+
+			/** Last-Modified capacity, an http date is 29 characters */
+			static const size_t LAST_MODIFIED_SIZE = 32;
+
+			/**
+			 * Validators of one uri
+			 */
+			struct Entry {
+				/** Uri hash, 0 for an unused entry */
+				uint32_t key;
+				/** ETag of last response or empty */
+				char etag[ETAG_SIZE];
+				/** Last-Modified of last response or empty */
+				char lastModified[LAST_MODIFIED_SIZE];
+				/** Time in ms until which response is fresh, 0 if it must be revalidated */
+				uint64_t expires;
+				/** Last use order, least recently used entry is evicted first */
+				uint32_t lastUsed;
+			};
+
+		private:
+			/** Maximum number of cached uris */
+			static const uint8_t MAX_ENTRIES = 4;
+
+			/** Cached validators */
+			Entry entries[MAX_ENTRIES];
+
+			/** Next use order */
+			uint32_t useCount;
+
+			/**
+			 * Hashes uri with FNV-1a
+			 *
+			 * @param uri to hash
+			 * @return uri hash, never 0
+			 */
+			static uint32_t hash(const char* uri);
+
+			/**
+			 * Finds entry of uri hash
+			 *
+			 * @param key uri hash
+			 * @return entry or NULL if uri is not cached
+			 */
+			Entry* find(const uint32_t key);
+
+		public:
+			/**
+			 * Initialise new empty http cache
+			 */
+			HttpCache();
+
+			/**
+			 * Gets validators of uri
+			 *
+			 * @param uri requested uri
+			 * @return copy of cached validators, empty validators if uri is not cached
+			 */
+			Entry get(const char* uri);
+
+			/**
+			 * Stores validators, evicts least recently used uri if cache is full
+			 * Entries without any validator are removed since they can not make a request conditional
+			 *
+			 * @param entry validators returned by get and updated by the request
+			 */
+			void store(const Entry& entry);
+
+			/**
+			 * Removes uri, used when a request may have changed it
+			 *
+			 * @param uri to remove
+			 */
+			void remove(const char* uri);
+
+			/**
+			 * Checks if entry may be used without request
+			 *
+			 * @param entry to check
+			 * @return true if max-age is not elapsed
+			 */
+			static bool isFresh(const Entry& entry);
+
+			/**
+			 * Updates entry from response headers
+			 *
+			 * @param entry        to update
+			 * @param status       http status
+			 * @param etag         ETag header
+			 * @param lastModified Last-Modified header
+			 * @param cacheControl Cache-Control header
+			 */
+			static void update(Entry& entry, const int status, const String& etag, const String& lastModified, const String& cacheControl);
+
+			/**
+			 * Clears validators of entry, next request is not conditional
+			 *
+			 * @param entry to clear
+			 */
+			static void clear(Entry& entry);
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
@@ -0,0 +1,152 @@
+#ifndef HTTP_SERVICE_H
+#define HTTP_SERVICE_H
+
+// Lib includes
+#include "ArduinoJson.h"
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+#include "HttpCache.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Shared http service
+		 *
+		 * Owns the single http connection of the device so that every WebClient reuses the same keep alive tcp connection
+		 * A request sent over a reused connection that fails before any response is retried once on a fresh connection
+		 * Response body is left on the connection after request so that callers parse it straight from the socket, end closes the request
+		 * Requests of the main loop and of the network task are serialized, request blocks until the other task called end
+		 * Requests given an HttpCache entry send its validators and skip parsing of a 304 response
+		 */
+		class HttpService {
+
+		public:
+			/**
+			 * Connection statistics, durations in us
+			 */
+			struct Metrics {
+				/** Number of requests */
+				uint32_t requests;
+				/** Number of opened tcp connections */
+				uint32_t connections;
+				/** Number of requests retried on a fresh connection */
+				uint32_t retries;
+				/** Number of requests that failed without response */
+				uint32_t failures;
+				/** Number of requests answered from cache without request */
+				uint32_t cacheHits;
+				/** Number of conditional requests answered with 304 */
+				uint32_t notModified;
+				/** Sum of connect times */
+				uint64_t connectTotal;
+				/** Longest connect time */
+				uint32_t connectMaximum;
+				/** Sum of times to first byte */
+				uint64_t firstByteTotal;
+				/** Longest time to first byte */
+				uint32_t firstByteMaximum;
+				/** Heap allocated during last request in bytes */
+				uint32_t heapPeak;
+				/** Largest heap allocated during a request in bytes */
+				uint32_t heapPeakMaximum;
+			};
+
+		private:
+			/** Connection shared by all clients */
+			static Hal::HttpConnection http;
+
+			/** Connection statistics */
+			static Metrics metrics;
+
+			/** Status of current request */
+			static int status;
+
+			/** Allocated heap when request started */
+			static uint32_t heapStart;
+
+			/** Most heap allocated since request started */
+			static uint32_t heapHighWater;
+
+			/**
+			 * Samples allocated heap
+			 */
+			static void sampleHeap();
+
+			/**
+			 * Adds timings of last request to metrics
+			 */
+			static void record();
+
+			/**
+			 * Indicates if request may be sent again without changing what server did with the first one
+			 *
+			 * @param method http method
+			 * @return true for GET, HEAD, PUT and DELETE
+			 */
+			static const bool isIdempotent(const char* method);
+
+		public:
+			/**
+			 * Sends request over shared connection, every request must be closed with end
+			 *
+			 * @param method     http method
+			 * @param host       server host
+			 * @param port       server port
+			 * @param uri        requested uri
+			 * @param username   server username
+			 * @param password   server password
+			 * @param payload    request body or NULL
+			 * @param cacheEntry validators that make request conditional or NULL
+			 * @return http status or negative value on connection error
+			 */
+			static int request(const char* method, const char* host, const uint16_t port, const char* uri, const char* username, const char* password, const char* payload, const HttpCache::Entry* cacheEntry = NULL);
+
+			/**
+			 * Sends request over shared connection and parses json response
+			 *
+			 * @param method       http method
+			 * @param host         server host
+			 * @param port         server port
+			 * @param uri          requested uri
+			 * @param username     server username
+			 * @param password     server password
+			 * @param payload      request body or NULL
+			 * @param responseBody filled with parsed response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
+			 * @param cacheEntry   validators of uri updated from response or NULL, a fresh entry is answered with HttpCache::NOT_MODIFIED without request
+			 * @return http status or negative value on connection error, HttpCache::NOT_MODIFIED leaves responseBody empty
+			 */
+			static int request(const char* method, const char* host, const uint16_t port, const char* uri, const char* username, const char* password, const char* payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter, HttpCache::Entry* cacheEntry = NULL);
+
+			/**
+			 * Gets response body of current request, readable as ArduinoJson custom reader
+			 *
+			 * @return connection positioned on response body
+			 */
+			static Hal::HttpConnection& getBody();
+
+			/**
+			 * Ends current request, unread body is dropped
+			 */
+			static void end();
+
+			/**
+			 * Closes shared connection, next request opens a new one
+			 * Never waits for a running request, its connection is then left to it
+			 */
+			static void close();
+
+			/**
+			 * Gets connection statistics
+			 *
+			 * @return connection statistics
+			 */
+			static const Metrics& getMetrics();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
@@ -0,0 +1,147 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+// Lib includes
+#include "ArduinoJson.h"
+
+// local Includes
+#include "Defines.hpp"
+#include "FeatureDataStore.hpp"
+#include "FeatureFactory.hpp"
+#include "Hal.hpp"
+#include "JsonPool.hpp"
+#include "NetworkTask.hpp"
+#include "Scheduler.hpp"
+#include "WebClient.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Write behind journal of feature saved data
+		 *
+		 * Saved data that is not stored on server yet is kept pending in memory and record returns without touching the network
+		 * The persistent record of a pending update is its FeatureDataStore local copy, stamped with the last synced hash, so one update costs one flash write
+		 * Each factory has one entry so a newer update replaces the older one
+		 * Pending saved data is replayed as one batched PUT on the NetworkTask once wifi is up, an update recorded meanwhile is kept for next replay
+		 * Local copies that differ from their stamp after a shutdown or a power loss are pending again from begin
+		 */
+		class Journal {
+
+		private:
+			/** Maximum number of journaled factories */
+			static const uint8_t MAX_ENTRIES = 8;
+
+			/** Delay before replaying again after a failed replay in ms */
+			static const uint32_t RETRY_DELAY = 30000;
+
+			/**
+			 * Journal state of one factory
+			 */
+			struct Entry {
+				/** Journaled factory */
+				FeatureFactory* factory;
+				/** Content hash of journaled saved data */
+				uint32_t hash;
+				/** Sequence of journaled update */
+				uint32_t sequence;
+				/** Sequence of update sent by running replay, 0 if not sent */
+				uint32_t sentSequence;
+				/** True while update is not accepted by server */
+				bool pending;
+				/** Content hash of saved data too large to be replayed, it is neither journaled nor logged again */
+				uint32_t droppedHash;
+			};
+
+			/** Journal entries */
+			static Entry entries[MAX_ENTRIES];
+
+			/** Number of used entries */
+			static uint8_t entryCount;
+
+			/** Last recorded sequence */
+			static uint32_t sequence;
+
+			/** Client used to replay records */
+			static WebClient* webClient;
+
+			/** Running replay */
+			static RequestId replayRequest;
+
+			/** Replay hold off after a failure */
+			static TimerId retryTimer;
+
+			/**
+			 * Finds entry of factory
+			 *
+			 * @param factory journaled factory
+			 * @param create  adds entry if factory has none
+			 * @return entry or NULL if factory has none and it could not be added
+			 */
+			static Entry* findEntry(FeatureFactory* factory, const bool create);
+
+			/**
+			 * Indicates if saved data fits alone in a replay payload
+			 *
+			 * @param savedDataLength saved data length
+			 * @return false if saved data can never be replayed
+			 */
+			static const bool fitsReplay(const size_t savedDataLength);
+
+			/**
+			 * Gets size taken by one record in replay payload
+			 *
+			 * @param savedDataLength saved data length
+			 * @return record size in json document
+			 */
+			static size_t getPayloadSize(const size_t savedDataLength);
+
+			/**
+			 * Drops update that can never be replayed, saved data stays dirty in memory and in local copy
+			 *
+			 * @param entry journal entry of update
+			 */
+			static void drop(Entry& entry);
+
+			/**
+			 * Called on main loop when replay request completes
+			 *
+			 * @param status       http status
+			 * @param responseBody ids and names of stored feature data
+			 * @param context      unused
+			 */
+			static void onReplayResponse(const int status, JsonDocument& responseBody, void* context);
+
+		public:
+			/**
+			 * Journals saved data of feature factories that local copy holds and server does not
+			 * Must be called after local saved data was loaded
+			 *
+			 * @param webClient client used to replay records
+			 */
+			static void begin(WebClient* webClient);
+
+			/**
+			 * Journals saved data of factory if it is not stored on server nor already journaled, its local copy is written first
+			 *
+			 * @param factory   feature factory
+			 * @param savedData actual saved data of factory
+			 */
+			static void record(FeatureFactory* factory, const String& savedData);
+
+			/**
+			 * Sends pending records to server if no replay is running, must be called from main loop while wifi is connected
+			 */
+			static void replay();
+
+			/**
+			 * Gets number of records not accepted by server yet
+			 *
+			 * @return pending records count
+			 */
+			static uint8_t getPendingCount();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
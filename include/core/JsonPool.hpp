@@ -0,0 +1,131 @@
+#ifndef JSON_POOL_H
+#define JSON_POOL_H
+
+// Lib includes
+#include "ArduinoJson.h"
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Preallocated json documents
+		 *
+		 * Documents live in static memory and are leased through JsonPool::Lease so that parsing and serializing saved data or payloads never touches the heap
+		 * Pool size covers the deepest nesting of leases on the main loop, a lease taken while every document is used is empty and counted as a failure
+		 */
+		class JsonPool {
+
+		public:
+			/** Number of documents */
+			static const uint8_t POOL_SIZE = JSON_POOL_SIZE;
+
+			/** Capacity of each document */
+			static const size_t DOCUMENT_SIZE = MAX_JSON_DOCUMENT_SIZE;
+
+			static_assert(POOL_SIZE >= JSON_POOL_PEAK_LEASES, "JSON_POOL_SIZE must cover JSON_POOL_PEAK_LEASES");
+
+			/**
+			 * Lease of one pooled document, returned to the pool when it goes out of scope
+			 */
+			class Lease {
+
+			private:
+				/** Leased document index or NO_DOCUMENT */
+				uint8_t index;
+
+			public:
+				/**
+				 * Leases a cleared document
+				 */
+				Lease();
+
+				/**
+				 * Returns document to the pool
+				 */
+				~Lease();
+
+				Lease(const Lease&) = delete;
+				Lease& operator=(const Lease&) = delete;
+
+				/**
+				 * Indicates if a document was leased
+				 *
+				 * @return false if every document was used
+				 */
+				const bool isValid() const;
+
+				/**
+				 * Gets leased document, lease must be valid
+				 *
+				 * @return leased document
+				 */
+				JsonDocument& operator*();
+
+				/**
+				 * Gets leased document, lease must be valid
+				 *
+				 * @return leased document
+				 */
+				JsonDocument* operator->();
+			};
+
+		private:
+			/** Document that is not leased */
+			static const uint8_t NO_DOCUMENT = 0xFF;
+
+			/** Pooled documents */
+			static StaticJsonDocument<DOCUMENT_SIZE> documents[POOL_SIZE];
+
+			/** Leased documents */
+			static bool leased[POOL_SIZE];
+
+			/** Most documents leased at once */
+			static uint8_t highWater;
+
+			/** Number of leases that found no free document */
+			static uint32_t failedCount;
+
+			/**
+			 * Leases first free document
+			 *
+			 * @return document index or NO_DOCUMENT
+			 */
+			static uint8_t acquire();
+
+			/**
+			 * Returns document to the pool
+			 *
+			 * @param index document index
+			 */
+			static void release(const uint8_t index);
+
+		public:
+			/**
+			 * Gets number of documents actually leased
+			 *
+			 * @return leased documents count
+			 */
+			static uint8_t getLeasedCount();
+
+			/**
+			 * Gets most documents leased at once
+			 *
+			 * @return leased documents high water
+			 */
+			static uint8_t getHighWater();
+
+			/**
+			 * Gets number of leases that found no free document
+			 *
+			 * @return failed leases count
+			 */
+			static uint32_t getFailedCount();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
@@ -1,11 +1,10 @@
 #ifndef LED_H
 #define LED_H
 
-// Lib includes
-#include "M5StickC.h"
-
 // local Includes
 #include "Defines.hpp"
+#include "Hal.hpp"
+#include "Scheduler.hpp"
 
 namespace CrowOs {
 	namespace Core {
@@ -24,8 +23,18 @@ namespace CrowOs {
 			/** Actual led state */
 			bool state;
 
-			/** Last time blink */
-			unsigned long lastTimeBlink;
+			/** Blink timer */
+			TimerId blinkTimer;
+
+			/** Delay of running blink */
+			int blinkDelay;
+
+			/**
+			 * Toggles led, called by blinkTimer
+			 *
+			 * @param led to toggle
+			 */
+			static void onBlinkTimer(void* led);
 
 			/**
 			 * Set led state
@@ -46,12 +55,12 @@ namespace CrowOs {
 			void setUp();
 
 			/**
-			 * Turns on led
+			 * Turns on led and stops blinking
 			 */
 			void on();
 
 			/**
-			 * Turns off led
+			 * Turns off led and stops blinking
 			 */
 			void off();
 
@@ -61,7 +70,7 @@ namespace CrowOs {
 			void toggle();
 
 			/**
-			 * Blink the led
+			 * Blink the led until on or off is called
 			 *
 			 * @param delay between two blinks
 			 */
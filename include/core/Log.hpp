@@ -0,0 +1,242 @@
+#ifndef LOG_H
+#define LOG_H
+
+// Lib includes
+#include "Arduino.h"
+#include <type_traits>
+
+// local Includes
+#include "Defines.hpp"
+#include "Hash.hpp"
+
+/** Log levels, a module logs every message whose level is lower or equal to its LOG_LEVEL_<module> */
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_DEBUG 2
+
+#ifdef LOG_TOKENIZED
+	/**
+	 * Writes tokenized message : only the hash of the message literal and the raw arguments are sent
+	 * Literal is not referenced so it does not reach flash, tools/log_decoder.py rebuilds the text from tools/log_tokens.json
+	 *
+	 * @param literal whole message literal
+	 */
+	#define LOG_WRITE(literal, ...) \
+		do { \
+			(void)sizeof(CrowOs::Core::Log::checkFormat(literal, ##__VA_ARGS__)); \
+			CrowOs::Core::Log::writeToken(std::integral_constant<uint32_t, CrowOs::Core::Log::hash(literal)>::value, ##__VA_ARGS__); \
+		} while(0)
+#else
+	/**
+	 * Writes formatted message
+	 *
+	 * @param literal whole message literal
+	 */
+	#define LOG_WRITE(literal, ...) CrowOs::Core::Log::write(literal, ##__VA_ARGS__)
+#endif
+
+/**
+ * Logs info message of module
+ * Compiles to nothing if LOG_LEVEL_<module> is lower than LOG_LEVEL_INFO, format is a literal so it stays in flash
+ *
+ * @param module module name as written in log lines, LOG_LEVEL_<module> must be defined in Defines.hpp
+ * @param format printf format without trailing new line
+ */
+#define LOG_INFO(module, format, ...) \
+	do { \
+		if(LOG_LEVEL_##module >= LOG_LEVEL_INFO) LOG_WRITE("Info : [" #module "] " format "\n", ##__VA_ARGS__); \
+	} while(0)
+
+/**
+ * Logs debug message of module
+ * Compiles to nothing if LOG_LEVEL_<module> is lower than LOG_LEVEL_DEBUG, format is a literal so it stays in flash
+ *
+ * @param module module name as written in log lines, LOG_LEVEL_<module> must be defined in Defines.hpp
+ * @param format printf format without trailing new line
+ */
+#define LOG_DEBUG(module, format, ...) \
+	do { \
+		if(LOG_LEVEL_##module >= LOG_LEVEL_DEBUG) LOG_WRITE("Debug : [" #module "] " format "\n", ##__VA_ARGS__); \
+	} while(0)
+
+/**
+ * Indicates at compile time if module logs messages of given level, used to skip work done only to build log arguments
+ *
+ * @param module module name
+ * @param level  LOG_LEVEL_INFO or LOG_LEVEL_DEBUG
+ */
+#define LOG_ENABLED(module, level) (LOG_LEVEL_##module >= level)
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Log writer
+		 *
+		 * Messages are formatted into a RAM ring buffer and never wait for the serial port
+		 * A low priority task drains the ring buffer to Serial, messages that do not fit are dropped and counted
+		 *
+		 * With LOG_TOKENIZED messages are written as binary records instead of text :
+		 * 0xA5, record length, message token on 4 bytes little endian, then every argument
+		 * Integers and enums are zigzag varints, floating point values are 4 bytes floats and strings are one length byte followed by the characters
+		 */
+		class Log {
+
+		private:
+			/** First byte of a tokenized record */
+			static const uint8_t RECORD_MAGIC = 0xA5;
+
+			/** Longest tokenized record, longer strings are truncated */
+			static const uint8_t MAX_RECORD_SIZE = 128;
+
+			/** Size of record header : magic, length and token */
+			static const uint8_t RECORD_HEADER_SIZE = 6;
+
+			/**
+			 * Ends arguments encoding, record and length are left as they are
+			 */
+			static void encode(uint8_t*, uint8_t&) {
+			}
+
+			/**
+			 * Encodes arguments one by one
+			 *
+			 * @param record    being encoded
+			 * @param length    actual record length
+			 * @param first     argument to encode
+			 * @param arguments remaining arguments
+			 */
+			template<typename First, typename... Arguments>
+			static void encode(uint8_t* record, uint8_t& length, const First first, const Arguments... arguments) {
+
+				encodeArgument(record, length, first);
+				encode(record, length, arguments...);
+			}
+
+			/**
+			 * Encodes integer or enum argument
+			 *
+			 * @param record being encoded
+			 * @param length actual record length
+			 * @param value  to encode
+			 */
+			template<typename Integer>
+			static typename std::enable_if<std::is_integral<Integer>::value || std::is_enum<Integer>::value>::type encodeArgument(uint8_t* record, uint8_t& length, const Integer value) {
+				encodeInteger(record, length, (int64_t)value);
+			}
+
+			/**
+			 * Encodes integer as zigzag varint
+			 *
+			 * @param record being encoded
+			 * @param length actual record length
+			 * @param value  to encode
+			 */
+			static void encodeInteger(uint8_t* record, uint8_t& length, const int64_t value);
+
+			/**
+			 * Encodes floating point argument as 4 bytes float
+			 *
+			 * @param record being encoded
+			 * @param length actual record length
+			 * @param value  to encode
+			 */
+			static void encodeArgument(uint8_t* record, uint8_t& length, const double value);
+
+			/**
+			 * Encodes string argument
+			 *
+			 * @param record being encoded
+			 * @param length actual record length
+			 * @param text   to encode
+			 */
+			static void encodeArgument(uint8_t* record, uint8_t& length, const char* text);
+
+			/**
+			 * Copies record or message into the ring buffer
+			 *
+			 * @param data   to copy
+			 * @param length of data
+			 */
+			static void push(const void* data, const uint32_t length);
+
+			/**
+			 * Drain task body
+			 *
+			 * @param parameter unused
+			 */
+			static void drainTask(void* parameter);
+
+			/**
+			 * Writes ring buffer content to Serial
+			 */
+			static void drain();
+
+		public:
+			/**
+			 * Starts drain task, Serial must be initialised
+			 * Messages logged before are kept in the ring buffer
+			 */
+			static void begin();
+
+			/**
+			 * Formats message into the ring buffer
+			 *
+			 * @param format printf format
+			 */
+			static void write(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+			/**
+			 * Writes tokenized record into the ring buffer
+			 *
+			 * @param token     hash of message literal
+			 * @param arguments message arguments
+			 */
+			template<typename... Arguments>
+			static void writeToken(const uint32_t token, const Arguments... arguments) {
+
+				uint8_t record[MAX_RECORD_SIZE] = {RECORD_MAGIC, 0, (uint8_t)token, (uint8_t)(token >> 8), (uint8_t)(token >> 16), (uint8_t)(token >> 24)};
+				uint8_t length = RECORD_HEADER_SIZE;
+
+				encode(record, length, arguments...);
+				record[1] = length - 2;
+				push(record, length);
+			}
+
+			/**
+			 * Declares message format so that the compiler checks arguments of tokenized messages, never called
+			 *
+			 * @param format printf format
+			 * @return nothing, only used in sizeof
+			 */
+			static int checkFormat(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+			/**
+			 * Computes message token, FNV-1a hash of the message literal
+			 * tools/log_tokenizer.py computes the same hash to build the string table
+			 *
+			 * @param text  to hash
+			 * @param value hash of preceding characters
+			 * @return message token
+			 */
+			static constexpr uint32_t hash(const char* text, const uint32_t value = Hash::FNV1A_OFFSET_BASIS) {
+				return *text == '\0' ? value : hash(text + 1, (value ^ (uint8_t)*text) * Hash::FNV1A_PRIME);
+			}
+
+			/**
+			 * Writes every pending message to Serial and waits until it is sent, used before power off
+			 */
+			static void flush();
+
+			/**
+			 * Gets number of messages dropped because ring buffer was full
+			 *
+			 * @return dropped messages count
+			 */
+			static unsigned long getDroppedCount();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
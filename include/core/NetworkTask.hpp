@@ -0,0 +1,217 @@
+#ifndef NETWORK_TASK_H
+#define NETWORK_TASK_H
+
+// Lib includes
+#include "ArduinoJson.h"
+
+// local Includes
+#include "Defines.hpp"
+#include "Events.hpp"
+#include "Hal.hpp"
+#include "HttpCache.hpp"
+#include "HttpService.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Called on main loop when a request completes
+		 *
+		 * @param status       http status or negative value on connection error
+		 * @param responseBody parsed response body, only valid during the call
+		 * @param context      context given when request was submitted
+		 */
+		typedef void (*ResponseCallback)(const int status, JsonDocument& responseBody, void* context);
+
+		/** Handle of a submitted request */
+		typedef uint16_t RequestId;
+
+		/**
+		 * Background network task
+		 *
+		 * Runs http requests on a task pinned to the core that does not run the main loop, or on a thread natively, so that frames keep going while a request waits on the network
+		 * Requests live in a fixed number of slots that own their payload buffer, filter and response documents so submitting never blocks nor allocates and cancelling never leaves a dangling pointer
+		 * Completions post Events::EVENT_NETWORK and callbacks are called from poll on the main loop
+		 */
+		class NetworkTask {
+
+		public:
+			/** Request that is not submitted */
+			static const RequestId NO_REQUEST = 0;
+
+			/** Maximum uri length */
+			static const size_t MAX_URI_SIZE = 96;
+
+			/** Filter document capacity */
+			static const size_t FILTER_SIZE = 384;
+
+			/** Maximum serialized request body length */
+			static const size_t MAX_PAYLOAD_SIZE = MAX_JSON_DOCUMENT_SIZE - 1;
+
+		private:
+			/** Maximum number of requests queued, running or waiting for their callback */
+			static const uint8_t MAX_REQUESTS = 4;
+
+			/** Slot that is not found */
+			static const uint8_t NO_SLOT = 0xFF;
+
+			/**
+			 * Request slot states
+			 */
+			enum State {
+				STATE_FREE,
+				STATE_QUEUED,
+				STATE_RUNNING,
+				STATE_DONE,
+				STATE_CANCELLED
+			};
+
+			/**
+			 * Request slot
+			 */
+			struct Slot {
+				/** Http method */
+				const char* method;
+				/** Server host, must be a literal or outlive the request */
+				const char* host;
+				/** Server port */
+				uint16_t port;
+				/** Server username, must be a literal or outlive the request */
+				const char* username;
+				/** Server password, must be a literal or outlive the request */
+				const char* password;
+				/** Requested uri */
+				char uri[MAX_URI_SIZE];
+				/** Serialized request body */
+				char payload[MAX_PAYLOAD_SIZE + 1];
+				/** True if request has a body */
+				bool hasPayload;
+				/** Copy of response filter */
+				StaticJsonDocument<FILTER_SIZE> filter;
+				/** True if response is filtered */
+				bool filtered;
+				/** Cache updated before callback or NULL */
+				HttpCache* cache;
+				/** Copy of cached validators, updated on network task */
+				HttpCache::Entry cacheEntry;
+				/** Parsed response body, not leased from JsonPool since it is filled on network task while main loop holds its own leases */
+				StaticJsonDocument<MAX_JSON_DOCUMENT_SIZE> responseBody;
+				/** Http status */
+				int status;
+				/** Called on main loop when request completes */
+				ResponseCallback callback;
+				/** Passed to callback */
+				void* context;
+				/** Submission order */
+				uint32_t sequence;
+				/** Incremented on each submission so that stale handles are ignored */
+				uint8_t generation;
+				/** Slot state */
+				State state;
+			};
+
+			/** Request slots */
+			static Slot slots[MAX_REQUESTS];
+
+			/** Next submission order */
+			static uint32_t sequence;
+
+			/** True if network task is running, requests are run from poll otherwise */
+			static bool started;
+
+			/** Number of requests rejected because every slot was used */
+			static uint32_t droppedCount;
+
+			/**
+			 * Network task body
+			 *
+			 * @param parameter unused
+			 */
+			static void run(void* parameter);
+
+			/**
+			 * Finds oldest slot in given state, lock must be held
+			 *
+			 * @param state of searched slot
+			 * @return slot index or NO_SLOT
+			 */
+			static uint8_t findOldest(const State state);
+
+			/**
+			 * Finds slot of request handle, lock must be held
+			 *
+			 * @param id request handle
+			 * @return slot index or NO_SLOT if request is not pending
+			 */
+			static uint8_t findSlot(const RequestId id);
+
+			/**
+			 * Sends request of slot and parses its response
+			 *
+			 * @param slot to run
+			 */
+			static void execute(Slot& slot);
+
+		public:
+			/**
+			 * Starts network task
+			 */
+			static void begin();
+
+			/**
+			 * Queues request
+			 *
+			 * @param method   http method, must be a literal
+			 * @param host     server host, must be a literal or outlive the request
+			 * @param port     server port
+			 * @param uri      requested uri, copied
+			 * @param username server username, must be a literal or outlive the request
+			 * @param password server password, must be a literal or outlive the request
+			 * @param payload  request body or NULL, serialized into the request slot
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @param cache    validators of uri used to make request conditional and updated before callback or NULL, must outlive the request
+			 * @param callback called on main loop when request completes
+			 * @param context  passed to callback
+			 * @return request handle or NO_REQUEST if every slot is used or payload is longer than MAX_PAYLOAD_SIZE
+			 */
+			static RequestId submit(const char* method, const char* host, const uint16_t port, const char* uri, const char* username, const char* password, const JsonDocument* payload, const JsonDocument* filter, HttpCache* cache, ResponseCallback callback, void* context);
+
+			/**
+			 * Cancels request, its callback is never called
+			 * A running request still completes on the network task but its response is dropped
+			 *
+			 * @param id request handle, set to NO_REQUEST
+			 */
+			static void cancel(RequestId& id);
+
+			/**
+			 * Checks if request is queued, running or waiting for its callback
+			 *
+			 * @param id request handle
+			 * @return true if request is pending
+			 */
+			static bool isPending(const RequestId id);
+
+			/**
+			 * Calls callbacks of completed requests, must be called from main loop
+			 */
+			static void poll();
+
+			/**
+			 * Gets number of requests rejected because every slot was used
+			 *
+			 * @return rejected requests count
+			 */
+			static uint32_t getDroppedCount();
+
+			/**
+			 * Gets memory of response documents owned by request slots
+			 *
+			 * @return response documents size in bytes
+			 */
+			static size_t getResponseMemory();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
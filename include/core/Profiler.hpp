@@ -0,0 +1,150 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Lib includes
+#include "ArduinoJson.h"
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+#include "JsonPool.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Frame time profiler
+		 *
+		 * Keeps min, average, max and a logarithmic histogram of every named probe so that p99 can be estimated
+		 * Probes are timed with the cpu cycle counter through Profiler::Scope
+		 * Type f on Serial to log a report, j to get a json dump and r to reset statistics
+		 */
+		class Profiler {
+
+		private:
+			/** Maximum number of probes, extra probes are ignored, main loop and features use 12 */
+			static const uint8_t MAX_PROBES = 16;
+
+			/** Number of histogram buckets, bucket i holds durations up to 2^(i/2) us and last one holds the rest */
+			static const uint8_t HISTOGRAM_SIZE = 32;
+
+			/** Probe that is not tracked */
+			static const uint8_t NO_PROBE = 0xFF;
+
+			/**
+			 * Statistics of one probe
+			 */
+			struct Probe {
+				/** Probe name, must live as long as the profiler */
+				const char* name;
+				/** Number of samples */
+				uint32_t count;
+				/** Shortest sample in us */
+				uint32_t minimum;
+				/** Longest sample in us */
+				uint32_t maximum;
+				/** Sum of samples in us */
+				uint64_t total;
+				/** Number of samples longer than frame budget */
+				uint32_t overBudget;
+				/** Samples per duration bucket */
+				uint32_t histogram[HISTOGRAM_SIZE];
+			};
+
+			/** Probes */
+			static Probe probes[MAX_PROBES];
+
+			/** Number of used probes */
+			static uint8_t probesCount;
+
+			/** Indicates if an extra probe was ignored, it is logged only once */
+			static bool probesOverflowed;
+
+			/** Frame budget in us */
+			static uint32_t frameBudget;
+
+			/**
+			 * Finds probe by name and creates it if needed
+			 *
+			 * @param name probe name
+			 * @return probe index or NO_PROBE if probes are full
+			 */
+			static uint8_t findProbe(const char* name);
+
+			/**
+			 * Adds sample to probe
+			 *
+			 * @param probe    probe index
+			 * @param duration sample duration in us
+			 */
+			static void record(const uint8_t probe, const uint32_t duration);
+
+			/**
+			 * Estimates 99th percentile of probe from its histogram
+			 *
+			 * @param probe to estimate
+			 * @return upper bound of bucket holding the 99th percentile in us
+			 */
+			static uint32_t percentile99(const Probe& probe);
+
+		public:
+			/**
+			 * Times enclosing scope into a probe
+			 */
+			class Scope {
+
+			private:
+				/** Probe index */
+				uint8_t probe;
+
+				/** Cycle counter when scope started */
+				uint32_t start;
+
+			public:
+				/**
+				 * Starts timing
+				 *
+				 * @param name probe name, must live as long as the profiler
+				 */
+				Scope(const char* name);
+
+				/**
+				 * Stops timing and records the sample
+				 */
+				~Scope();
+			};
+
+			/**
+			 * Sets frame budget used to count over budget samples
+			 *
+			 * @param budget frame budget in us
+			 */
+			static void setFrameBudget(const uint32_t budget);
+
+			/**
+			 * Handles profiler commands typed on Serial
+			 */
+			static void poll();
+
+			/**
+			 * Logs one line per probe and one line of heap and json pool statistics
+			 */
+			static void report();
+
+			/**
+			 * Dumps every probe into json array
+			 *
+			 * @param document to dump into
+			 */
+			static void dump(JsonDocument& document);
+
+			/**
+			 * Clears every probe statistics
+			 */
+			static void reset();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SAVED_DATA_RECORD_H
+#define SAVED_DATA_RECORD_H
+
+// local Includes
+#include "Defines.hpp"
+#include "FeatureFactory.hpp"
+#include "Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Feature saved data record in Hal::Storage
+		 *
+		 * A record is a header with a stamp, the feature factory id and saved data length followed by saved data without terminating zero
+		 * It is stored under a prefix followed by factory name hash in hex, each owner of records uses its own prefix and gives its own meaning to the stamp
+		 * Records are validated before use, a corrupted or foreign one is removed and never read on the stack if it is longer than MAX_SAVED_DATA_SIZE
+		 */
+		class SavedDataRecord {
+
+		public:
+			/** Storage key length, prefix followed by factory name hash in hex */
+			static const size_t KEY_SIZE = 9;
+
+			/** Longest stored saved data */
+			static const size_t MAX_SAVED_DATA_SIZE = MAX_JSON_DOCUMENT_SIZE;
+
+		private:
+			/**
+			 * Stored record header, followed by saved data
+			 */
+			struct Header {
+				/** Stamp given by record owner */
+				uint32_t stamp;
+				/** Feature factory id in database, -1 if not created yet */
+				int32_t id;
+				/** Saved data length */
+				uint16_t savedDataLength;
+			};
+
+			/** Longest stored record */
+			static const size_t MAX_RECORD_SIZE = sizeof(Header) + MAX_SAVED_DATA_SIZE;
+
+		public:
+			/**
+			 * Builds storage key of factory record
+			 *
+			 * @param prefix  of record owner
+			 * @param factory feature factory
+			 * @param key     filled with KEY_SIZE characters and terminating zero
+			 */
+			static void getKey(const char prefix, const FeatureFactory* factory, char* key);
+
+			/**
+			 * Reads record, removes it if it is corrupted
+			 *
+			 * @param key       storage key
+			 * @param stamp     filled with record stamp
+			 * @param id        filled with feature factory id
+			 * @param savedData filled with saved data
+			 * @return true if a valid record was read
+			 */
+			static const bool read(const char* key, uint32_t& stamp, int32_t& id, String& savedData);
+
+			/**
+			 * Writes record, replaces previous one
+			 *
+			 * @param key       storage key
+			 * @param stamp     record stamp
+			 * @param id        feature factory id
+			 * @param savedData saved data, not written if it is longer than MAX_SAVED_DATA_SIZE
+			 * @return true if record is written
+			 */
+			static const bool write(const char* key, const uint32_t stamp, const int32_t id, const String& savedData);
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
@@ -0,0 +1,186 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// local Includes
+#include "Defines.hpp"
+#include "Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Timer callback
+		 *
+		 * @param context pointer given when timer was scheduled
+		 */
+		typedef void (*TimerCallback)(void* context);
+
+		/**
+		 * Timer handle, Scheduler::NO_TIMER if none
+		 */
+		typedef uint16_t TimerId;
+
+		/**
+		 * Timer scheduler
+		 *
+		 * Hashed timer wheel : timers are hashed by deadline tick into WHEEL_SIZE slots and each run only visits the slots of elapsed ticks
+		 * Timers come from a fixed pool so scheduling never allocates, deadlines are 64 bits ms from Hal::Clock so they never wrap
+		 * Callbacks run from Scheduler::run in the main loop, they may schedule or cancel timers
+		 */
+		class Scheduler {
+
+		private:
+			/** Tick duration in ms */
+			static const uint16_t TICK = 10;
+
+			/** Number of wheel slots, must be a power of two */
+			static const uint8_t WHEEL_SIZE = 64;
+
+			/** Maximum number of scheduled timers */
+			static const uint8_t MAX_TIMERS = 24;
+
+			/** Empty slot or end of slot list */
+			static const uint8_t NO_INDEX = 0xFF;
+
+			/**
+			 * Scheduled timer
+			 */
+			struct Timer {
+				/** Called when timer expires, may be NULL for a plain deadline */
+				TimerCallback callback;
+				/** Passed to callback */
+				void* context;
+				/** Deadline tick */
+				uint64_t deadline;
+				/** Period in ticks, 0 for one shot timers */
+				uint32_t period;
+				/** Next timer in the same slot */
+				uint8_t next;
+				/** Incremented on each reuse so that stale TimerId are rejected */
+				uint8_t generation;
+				/** Indicates if timer is scheduled */
+				bool active;
+			};
+
+			/** Timer pool */
+			static Timer timers[MAX_TIMERS];
+
+			/** First timer of each slot */
+			static uint8_t slots[WHEEL_SIZE];
+
+			/** Last processed tick */
+			static uint64_t currentTick;
+
+			/**
+			 * Gets actual tick
+			 *
+			 * @return ticks since boot
+			 */
+			static uint64_t nowTick();
+
+			/**
+			 * Gets pool index of timer
+			 *
+			 * @param timer to find
+			 * @return pool index or NO_INDEX if timer is not scheduled
+			 */
+			static uint8_t findTimer(const TimerId timer);
+
+			/**
+			 * Adds timer to its slot
+			 *
+			 * @param index pool index of timer
+			 */
+			static void link(const uint8_t index);
+
+			/**
+			 * Removes timer from its slot
+			 *
+			 * @param index pool index of timer
+			 */
+			static void unlink(const uint8_t index);
+
+			/**
+			 * Schedules timer
+			 *
+			 * @param delay    before first expiry in ms
+			 * @param period   between expiries in ms, 0 for one shot timers
+			 * @param callback to call on expiry
+			 * @param context  passed to callback
+			 * @return timer handle or NO_TIMER if pool is full
+			 */
+			static TimerId add(const uint32_t delay, const uint32_t period, TimerCallback callback, void* context);
+
+			/**
+			 * Expires due timers of one slot
+			 *
+			 * @param slot to process
+			 * @param tick processed tick
+			 */
+			static void processSlot(const uint8_t slot, const uint64_t tick);
+
+		public:
+			/** Handle of no timer */
+			static const TimerId NO_TIMER = 0;
+
+			/**
+			 * Schedules one shot timer
+			 *
+			 * @param delay    before expiry in ms
+			 * @param callback to call on expiry, may be NULL for a plain deadline checked with isScheduled
+			 * @param context  passed to callback
+			 * @return timer handle or NO_TIMER if pool is full
+			 */
+			static TimerId schedule(const uint32_t delay, TimerCallback callback, void* context);
+
+			/**
+			 * Schedules periodic timer, first expiry is after one period
+			 * Missed expiries are skipped instead of being run in a burst
+			 *
+			 * @param period   between expiries in ms
+			 * @param callback to call on expiry
+			 * @param context  passed to callback
+			 * @return timer handle or NO_TIMER if pool is full
+			 */
+			static TimerId scheduleEvery(const uint32_t period, TimerCallback callback, void* context);
+
+			/**
+			 * Cancels timer
+			 *
+			 * @param timer to cancel, set to NO_TIMER
+			 * @return true if timer was scheduled
+			 */
+			static bool cancel(TimerId& timer);
+
+			/**
+			 * Indicates if timer is still scheduled
+			 *
+			 * @param timer to check
+			 * @return true if timer did not expire and was not canceled
+			 */
+			static bool isScheduled(const TimerId timer);
+
+			/**
+			 * Runs callbacks of every expired timer
+			 */
+			static void run();
+
+			/**
+			 * Gets deadline of the timer that expires first
+			 *
+			 * @return deadline in ms since boot or UINT64_MAX if no timer is scheduled
+			 */
+			static uint64_t getNextDeadline();
+
+			/**
+			 * Gets time left before the first timer expires
+			 *
+			 * @return ms before next deadline, 0 if it is due and UINT32_MAX if no timer is scheduled
+			 */
+			static uint32_t getTimeUntilNextDeadline();
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+
+#endif
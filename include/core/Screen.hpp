@@ -1,26 +1,93 @@
 #ifndef SCREEN_H
 #define SCREEN_H
 
-// Lib includes
-#include "M5StickC.h"
-
 // local Includes
+#include "Asset.hpp"
 #include "Defines.hpp"
+#include "Hal.hpp"
+#include "Scheduler.hpp"
 
 // Resource includes
-#include "resources/r_logo.hpp"
+#include "resources/r_assets.hpp"
 
 namespace CrowOs {
 	namespace Core {
 
+		/**
+		 * Screen area
+		 */
+		struct Rect {
+
+			/** Top left corner x position */
+			int16_t x;
+
+			/** Top left corner y position */
+			int16_t y;
+
+			/** Area width */
+			int16_t w;
+
+			/** Area height */
+			int16_t h;
+		};
+
+		/**
+		 * Text grid cell
+		 */
+		struct TextCell {
+
+			/** Character shown in the cell, '\0' if unknown */
+			char glyph;
+
+			/** Character color */
+			uint16_t foregroundColor;
+
+			/** Cell background color */
+			uint16_t backgroundColor;
+		};
+
 		/**
 		 * Screen class
 		 *
 		 * Helper used to manage device screen
+		 * Everything is drawn into an off screen canvas, changed areas are pushed to the lcd by flush()
 		 */
 		class Screen {
 
 		private:
+			/** Maximum tracked dirty areas, when exceeded the cheapest pair is merged */
+			static const short MAX_DIRTY_RECTS = 8;
+
+			/** Extra pixels two dirty areas may cost once merged, cheaper than one more bus transaction */
+			static const int DIRTY_RECT_MERGE_THRESHOLD = 160;
+
+			/** Text grid cell width */
+			static const short TEXT_CELL_WIDTH = 6;
+
+			/** Text grid cell height */
+			static const short TEXT_CELL_HEIGHT = 8;
+
+			/** Text grid cells, portrait 15x19 grid is the biggest one */
+			static const short MAX_TEXT_CELLS = 15 * 19;
+
+			/** Back buffer every drawing goes to */
+			Hal::Canvas canvas;
+
+			/** Areas changed since last flush */
+			Rect dirtyRects[MAX_DIRTY_RECTS];
+
+			/** Number of areas changed since last flush */
+			short dirtyRectsCount;
+
+			/** Pixels pushed to the lcd by last flush */
+			unsigned long pixelsPushed;
+
+			/** Bus transactions done by last flush */
+			short transfers;
+
+			/** Content of each text grid cell, row by row */
+			TextCell textCells[MAX_TEXT_CELLS];
+
 			/** Current default background color */
 			uint16_t backgroundColor;
 
@@ -30,8 +97,8 @@ namespace CrowOs {
 			/** Current brightness */
 			short brightness;
 
-			/** Error showing delay */
-			unsigned int m_errorDelay;
+			/** Error message expiry, error is shown while it is scheduled */
+			TimerId errorTimer;
 
 			/** Current screen orientation */
 			short screenOrientation;
@@ -39,6 +106,29 @@ namespace CrowOs {
 			/** Error message showing actually on the screen */
 			char errorMessage[28];
 
+			/**
+			 * Marks screen area as changed so that next flush pushes it
+			 *
+			 * @param x area x position
+			 * @param y area y position
+			 * @param w area width
+			 * @param h area height
+			 */
+			void markDirty(int x, int y, int w, int h);
+
+			/**
+			 * Marks area covered by text printed from x, y up to current canvas cursor as changed
+			 *
+			 * @param x text start x position
+			 * @param y text start y position
+			 */
+			void markTextDirty(const int x, const int y);
+
+			/**
+			 * Forgets text grid content so that every cell is rasterized on next print
+			 */
+			void invalidateTextCells();
+
 		public:
 			/** Screen left landscape orientation */
 			static const short SCREEN_LEFT_LANDSCAPE = 1;
@@ -61,9 +151,29 @@ namespace CrowOs {
 
 			/**
 			 * Screen loop method
+			 * Shows error message if any and flushes changed areas to the lcd
 			 */
 			void loop();
 
+			/**
+			 * Pushes areas changed since last flush to the lcd
+			 */
+			void flush();
+
+			/**
+			 * Gets number of pixels pushed to the lcd by last flush
+			 *
+			 * @return pixels pushed by last flush
+			 */
+			unsigned long getPixelsPushed() const;
+
+			/**
+			 * Gets number of bus transactions done by last flush
+			 *
+			 * @return transactions done by last flush
+			 */
+			short getTransfers() const;
+
 			/**
 			 * Prints text on the screen
 			 *
@@ -73,12 +183,12 @@ namespace CrowOs {
 			 * @param textForegroundColor text foreground color
 			 * @param textBackgroundColor text background color if not set than default background color is used
 			 */
-			void printText(const char* text, const int x, const int y, const uint16_t textForegroundColor, const int textBackgroundColor = -1) const;
+			void printText(const char* text, const int x, const int y, const uint16_t textForegroundColor, const int textBackgroundColor = -1);
 
 			/**
 			 * Paint screen with background color
 			 */
-			void clearLCD() const;
+			void clearLCD();
 
 			/**
 			 * Clear screen text
@@ -88,7 +198,106 @@ namespace CrowOs {
 			 * @param y          cursor y position
 			 * @param clearColor color to clear text with
 			 */
-			void clearText(const int size, const int x, const int y, const int clearColor = -1) const;
+			void clearText(const int size, const int x, const int y, const int clearColor = -1);
+
+			/**
+			 * Prints text in the text grid, only cells whose glyph or colors changed are rasterized
+			 * Text does not wrap, cells that do not fit the row are dropped
+			 *
+			 * @param text                text to print
+			 * @param column              first cell column
+			 * @param row                 cell row
+			 * @param textForegroundColor text foreground color
+			 * @param textBackgroundColor text background color if not set than default background color is used
+			 * @param size                minimum number of cells written, cells after the text are cleared
+			 */
+			void printCells(const char* text, const int column, const int row, const uint16_t textForegroundColor, const int textBackgroundColor = -1, const int size = 0);
+
+			/**
+			 * Clears text grid cells
+			 *
+			 * @param size       number of cells to clear
+			 * @param column     first cell column
+			 * @param row        cell row
+			 * @param clearColor color to clear cells with
+			 */
+			void clearCells(const int size, const int column, const int row, const int clearColor = -1);
+
+			/**
+			 * Fills rectangle
+			 *
+			 * @param x     rectangle x position
+			 * @param y     rectangle y position
+			 * @param w     rectangle width
+			 * @param h     rectangle height
+			 * @param color to fill with
+			 */
+			void fillRect(const int x, const int y, const int w, const int h, const uint16_t color);
+
+			/**
+			 * Draws rectangle outline
+			 *
+			 * @param x     rectangle x position
+			 * @param y     rectangle y position
+			 * @param w     rectangle width
+			 * @param h     rectangle height
+			 * @param color to draw with
+			 */
+			void drawRect(const int x, const int y, const int w, const int h, const uint16_t color);
+
+			/**
+			 * Draws line
+			 *
+			 * @param x0    start x position
+			 * @param y0    start y position
+			 * @param x1    end x position
+			 * @param y1    end y position
+			 * @param color to draw with
+			 */
+			void drawLine(const int x0, const int y0, const int x1, const int y1, const uint16_t color);
+
+			/**
+			 * Draws circle outline
+			 *
+			 * @param x      center x position
+			 * @param y      center y position
+			 * @param radius circle radius
+			 * @param color  to draw with
+			 */
+			void drawCircle(const int x, const int y, const int radius, const uint16_t color);
+
+			/**
+			 * Fills circle
+			 *
+			 * @param x      center x position
+			 * @param y      center y position
+			 * @param radius circle radius
+			 * @param color  to fill with
+			 */
+			void fillCircle(const int x, const int y, const int radius, const uint16_t color);
+
+			/**
+			 * Draws RGB565 image
+			 *
+			 * @param x    image x position
+			 * @param y    image y position
+			 * @param w    image width
+			 * @param h    image height
+			 * @param data image pixels
+			 */
+			void pushImage(const int x, const int y, const int w, const int h, const uint16_t* data);
+
+			/**
+			 * Draws RGB565 image skipping transparent pixels
+			 *
+			 * @param x           image x position
+			 * @param y           image y position
+			 * @param w           image width
+			 * @param h           image height
+			 * @param data        image pixels
+			 * @param transparent color that is not drawn
+			 */
+			void pushImage(const int x, const int y, const int w, const int h, const uint16_t* data, const uint16_t transparent);
 
 			/**
 			 * changes screen background color
@@ -97,6 +306,43 @@ namespace CrowOs {
 			 */
 			void setBackground(const uint16_t color);
 
+			/**
+			 * Draws compressed asset decoding it one row at a time
+			 *
+			 * @param x           asset x position
+			 * @param y           asset y position
+			 * @param asset       to draw
+			 * @param transparent color that is not drawn, if not set every pixel is drawn
+			 */
+			void pushAsset(const int x, const int y, const Asset& asset, const int transparent = -1);
+
+			/**
+			 * Draws compressed asset into any canvas decoding it one row at a time
+			 *
+			 * @param target      canvas to draw into
+			 * @param x           asset x position
+			 * @param y           asset y position
+			 * @param asset       to draw
+			 * @param transparent color that is not drawn, if not set every pixel is drawn
+			 */
+			static void drawAsset(Hal::Canvas& target, const int x, const int y, const Asset& asset, const int transparent = -1);
+
+			/**
+			 * Draws top left area of an off screen sprite
+			 *
+			 * @param x      sprite x position
+			 * @param y      sprite y position
+			 * @param sprite to draw
+			 * @param w      area width
+			 * @param h      area height
+			 */
+			void pushSprite(const int x, const int y, const Hal::Canvas& sprite, const int w, const int h);
+
+			/**
+			 * Prints flash size and decode time of every asset
+			 */
+			void reportAssets() const;
+
 			/**
 			 * Shows crow logo
 			 */
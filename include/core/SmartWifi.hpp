@@ -1,15 +1,15 @@
 #ifndef SMART_WIFI_H
 #define SMART_WIFI_H
 
-// Lib includes
-#include "M5StickC.h"
-#include "WiFi.h"
-
 // local Includes
 #include "Defines.hpp"
+#include "Hal.hpp"
+#include "HttpService.hpp"
+#include "Scheduler.hpp"
+#include "Screen.hpp"
 
 // Resource includes
-#include "resources/r_wifi.hpp"
+#include "resources/r_assets.hpp"
 
 namespace CrowOs {
 	namespace Core {
@@ -22,11 +22,14 @@ namespace CrowOs {
 		class SmartWifi {
 
 		private:
+			/** Screen helper used to show wifi icon */
+			Screen* screen;
+
 			/** Time between to reconnection attrempts */
 			unsigned long reconnectionTimeOut;
 
-			/** Last reconnection try time */
-			unsigned long lastReconnectionTime;
+			/** Reconnection hold off, no reconnection is tried while it is scheduled */
+			TimerId reconnectionTimer;
 
 			/**
 			 * Do smart config and wait until is done
@@ -36,8 +39,10 @@ namespace CrowOs {
 		public:
 			/**
 			 * Initialise SmartWifi
+			 *
+			 * @param screenHelper Screen helper used to show wifi icon
 			 */
-			SmartWifi();
+			SmartWifi(Screen* screenHelper);
 
 			/**
 			 * Set up Smart wifi
@@ -59,11 +64,6 @@ namespace CrowOs {
 			 */
 			void reconnect();
 
-			/**
-			 * Wait for connection for 100000 ms than fail
-			 */
-			const bool waitUntilReconnect();
-
 			/**
 			 * Checks wifi status and shows wifi icon on the screen
 			 *
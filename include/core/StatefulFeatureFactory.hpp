@@ -0,0 +1,63 @@
+#ifndef STATEFUL_FEATURE_FACTORY_H
+#define STATEFUL_FEATURE_FACTORY_H
+
+// Lib includes
+#include <type_traits>
+
+// local Includes
+#include "FeatureFactory.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Feature factory that keeps a typed state of its features in memory
+		 *
+		 * Extend this class instead of FeatureFactory, give state to created features and implement readState and writeState
+		 * State outlives features so switching features never touches json, it is only converted when saved data is read or written
+		 * Always loop factories keep their state in memory too, but only factories of FEATURE_DESCRIPTORS have their saved data stored and synced
+		 */
+		template<typename State>
+		class StatefulFeatureFactory : public FeatureFactory {
+
+			static_assert(std::is_pod<State>::value, "feature state must be plain old data");
+
+		protected:
+			/** State kept in memory between activations */
+			State state;
+
+		public:
+			/**
+			 * Initialise stateful feature factory
+			 *
+			 * @param featureFactoryName indicates name of this feature factory
+			 * @param initialState       state used until saved data is read
+			 * @param alwaysLoop         indicates if feature made by this factory should be always in a main loop default false
+			 */
+			StatefulFeatureFactory(const char* featureFactoryName, const State& initialState, const bool alwaysLoop = false)
+				: FeatureFactory(featureFactoryName, alwaysLoop)
+				, state(initialState) {
+			}
+
+			/**
+			 * Gets state kept in memory between activations of features made by this factory
+			 *
+			 * @return pointer to state
+			 */
+			const void* getState() const override {
+				return &state;
+			}
+
+			/**
+			 * Gets size of state
+			 *
+			 * @return state size in bytes
+			 */
+			const size_t getStateSize() const override {
+				return sizeof state;
+			}
+		};
+
+	} // namespace Core
+} // namespace CrowOs
+#endif
@@ -1,11 +1,9 @@
 #ifndef TIME_H
 #define TIME_H
 
-// Lib includes
-#include "M5StickC.h"
-
 // local Includes
 #include "Defines.hpp"
+#include "Hal.hpp"
 
 namespace CrowOs {
 	namespace Core {
@@ -14,46 +12,45 @@ namespace CrowOs {
 		 * Time class
 		 *
 		 * Used to manage device upTime and sleepTime
+		 * nowUs and nowMs read the hardware clock like Scheduler, FramePacer, HttpCache and Profiler do, getUpTime is wall-clock time that also counts time during which the clock was stopped
 		 */
 		class Time {
 
 		private:
-			/** Time since device is up */
-			RTC_TimeTypeDef upTime;
+			/** Rtc is read once per RTC_SYNC_PERIOD ms */
+			static const uint32_t RTC_SYNC_PERIOD = 60000;
 
-			/** Time since last keepWokedUp call */
-			RTC_TimeTypeDef lastActiveTime;
+			/** Rtc advance over up time in s above which up time is moved forward */
+			static const long RTC_MAX_DRIFT = 2;
 
-			/** Default time to put device on sleep */
-			int sleepTime;
+			/** Microseconds added to the hardware clock by getUpTime only, grows when rtc shows that the clock was stopped */
+			uint64_t clockOffset;
 
-			/** Max fps */
-			double maxFps;
+			/** Up time of last rtc read in ms */
+			uint64_t rtcSyncTime;
 
-			/** Last time that limitFps was Executed */
-			unsigned long limitFpsLastTime;
+			/** Rtc time of day of last rtc read in s */
+			long rtcSyncSeconds;
 
-			/** Last time we calculated fps */
-			unsigned long fpsLastTime;
+			/** Up time of last keepWokedUp call in ms */
+			uint64_t lastActiveTime;
 
-			/** Number of fps since fpsLastTime */
-			double frames;
+			/** Default time to put device on sleep */
+			int sleepTime;
 
 			/**
-			 * Updates last active time
-			 *
-			 * @param newTime to update
+			 * Reads rtc and moves up time forward if rtc went further, for example when the cpu timer was stopped
+			 * Rtc time of day wraps at midnight so it is only compared over one RTC_SYNC_PERIOD
 			 */
-			void updateLastActiveTime(const RTC_TimeTypeDef newTime);
+			void syncRtc();
 
 		public:
 			/**
 			 * Initialises new Time
 			 *
 			 * @param speepTime time to put device on sleep default 60, 0 for never
-			 * @param maxFps max fps default 25
 			 */
-			Time(const int sleepTime = 60, const double maxFps = 25);
+			Time(const int sleepTime = 60);
 
 			/**
 			 * Set up Time helper
@@ -75,12 +72,20 @@ namespace CrowOs {
 			boolean shouldSleep() const;
 
 			/**
-			 * Converts RTC_TimeTypeDef to seconds
+			 * Gets monotonic hardware clock time, 64 bits so it never wraps
+			 * Time during which the clock was stopped is not counted, see getUpTime
+			 *
+			 * @return microseconds since boot
+			 */
+			uint64_t nowUs() const;
+
+			/**
+			 * Gets monotonic hardware clock time, 64 bits so it never wraps
+			 * Time during which the clock was stopped is not counted, see getUpTime
 			 *
-			 * @param  time to convert
-			 * @return converted time
+			 * @return milliseconds since boot
 			 */
-			int convertTimeToSecondes(const RTC_TimeTypeDef time) const;
+			uint64_t nowMs() const;
 
 			/**
 			 * Converts time to string HH:MM.SS
@@ -91,11 +96,12 @@ namespace CrowOs {
 			void convertTimeToString(const RTC_TimeTypeDef time, char dest[9]) const;
 
 			/**
-			 * Gets time since device is on
+			 * Gets wall-clock time since device is on
+			 * Unlike nowMs it counts time during which the hardware clock was stopped, as measured by rtc
 			 *
-			 * @return devices up time
+			 * @return devices up time in ms
 			 */
-			RTC_TimeTypeDef getUpTime() const;
+			uint64_t getUpTime() const;
 
 			/**
 			 * Gets device default sleep time
@@ -112,9 +118,10 @@ namespace CrowOs {
 			void setSleepTime(const int time);
 
 			/**
-			 * Limit fps
+			 * Time loop method
+			 * Resyncs the clock with rtc once per RTC_SYNC_PERIOD
 			 */
-			void limitFps();
+			void loop();
 		};
 
 	} // namespace Core
@@ -3,10 +3,12 @@
 
 // Lib includes
 #include "ArduinoJson.h"
-#include "HTTPClient.h"
 
 // local Includes
 #include "Defines.hpp"
+#include "Hal.hpp"
+#include "HttpService.hpp"
+#include "NetworkTask.hpp"
 
 namespace CrowOs {
 	namespace Core {
@@ -14,14 +16,13 @@ namespace CrowOs {
 		/**
 		 * Simple web client class
 		 *
-		 * Simple implementation of REST web client
+		 * Simple implementation of REST web client, requests go through the shared HttpService connection
+		 * send methods block until the response is parsed, submit methods run the request on the NetworkTask and call back on the main loop
+		 * GET requests are conditional once a response was received, HttpCache::NOT_MODIFIED status means the body received last time is unchanged and responseBody is left empty
 		 */
 		class WebClient {
 
 		private:
-			/** Http client instance */
-			HTTPClient http;
-
 			/** Host that this client has to connect to */
 			const char* host;
 
@@ -37,10 +38,33 @@ namespace CrowOs {
 			/** Server base path */
 			const char* basePath;
 
+			/** Validators of GET responses */
+			HttpCache cache;
+
 			/**
-			 * Adds general server headers
+			 * Sends query to distinct server
+			 *
+			 * @param method       http method
+			 * @param path         path on distinct server ressource
+			 * @param payload      payload to send to server or NULL
+			 * @param responseBody server response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
+			 * @return status      server status response
 			 */
-			void addGeneralHeaders();
+			int send(const char* method, const char* path, const char* payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter);
+
+			/**
+			 * Submits query to distinct server on network task
+			 *
+			 * @param method   http method
+			 * @param path     path on distinct server ressource
+			 * @param payload  payload to send to server or NULL
+			 * @param callback called on main loop with server response
+			 * @param context  passed to callback
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+			 */
+			RequestId submit(const char* method, const char* path, const JsonDocument* payload, ResponseCallback callback, void* context, const JsonDocument* filter);
 
 		public:
 			/**
@@ -59,9 +83,10 @@ namespace CrowOs {
 			 *
 			 * @param path         path on distinct server ressource
 			 * @param responseBody server response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
 			 * @return status      server status response
 			 */
-			int sendGET(const char* path, DynamicJsonDocument& responseBody);
+			int sendGET(const char* path, JsonDocument& responseBody, const DeserializationOption::Filter* filter = NULL);
 
 			/**
 			 * Send POST query to distinct server
@@ -69,9 +94,10 @@ namespace CrowOs {
 			 * @param path         path on distinct server ressource
 			 * @param payload      payload to send to server
 			 * @param responseBody server response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
 			 * @return status      server status response
 			 */
-			int sendPOST(const char* path, const DynamicJsonDocument payload, DynamicJsonDocument& responseBody);
+			int sendPOST(const char* path, const JsonDocument& payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter = NULL);
 
 			/**
 			 * Send PUT query to distinct server
@@ -79,9 +105,10 @@ namespace CrowOs {
 			 * @param path         path on distinct server ressource
 			 * @param payload      payload to send to server
 			 * @param responseBody server response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
 			 * @return status      server status response
 			 */
-			int sendPUT(const char* path, const DynamicJsonDocument payload, DynamicJsonDocument& responseBody);
+			int sendPUT(const char* path, const JsonDocument& payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter = NULL);
 
 			/**
 			 * Send PATCH query to distinct server
@@ -89,18 +116,85 @@ namespace CrowOs {
 			 * @param path         path on distinct server ressource
 			 * @param payload      payload to send to server
 			 * @param responseBody server response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
 			 * @return status      server status response
 			 */
-			int sendPATCH(const char* path, const DynamicJsonDocument payload, DynamicJsonDocument& responseBody);
+			int sendPATCH(const char* path, const JsonDocument& payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter = NULL);
 
 			/**
 			 * Send DELETE query to distinct server
 			 *
 			 * @param path         path on distinct server ressource
 			 * @param responseBody server response body
+			 * @param filter       keeps only matching fields of response body or NULL to keep everything
 			 * @return status      server status response
 			 */
-			int sendDELETE(const char* path, DynamicJsonDocument& responseBody);
+			int sendDELETE(const char* path, JsonDocument& responseBody, const DeserializationOption::Filter* filter = NULL);
+
+			/**
+			 * Submits GET query to distinct server
+			 *
+			 * @param path     path on distinct server ressource
+			 * @param callback called on main loop with server response
+			 * @param context  passed to callback
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @return request handle or NetworkTask::NO_REQUEST if network queue is full
+			 */
+			RequestId submitGET(const char* path, ResponseCallback callback, void* context, const JsonDocument* filter = NULL);
+
+			/**
+			 * Submits POST query to distinct server
+			 *
+			 * @param path     path on distinct server ressource
+			 * @param payload  payload to send to server
+			 * @param callback called on main loop with server response
+			 * @param context  passed to callback
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+			 */
+			RequestId submitPOST(const char* path, const JsonDocument& payload, ResponseCallback callback, void* context, const JsonDocument* filter = NULL);
+
+			/**
+			 * Submits PUT query to distinct server
+			 *
+			 * @param path     path on distinct server ressource
+			 * @param payload  payload to send to server
+			 * @param callback called on main loop with server response
+			 * @param context  passed to callback
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+			 */
+			RequestId submitPUT(const char* path, const JsonDocument& payload, ResponseCallback callback, void* context, const JsonDocument* filter = NULL);
+
+			/**
+			 * Submits PATCH query to distinct server
+			 *
+			 * @param path     path on distinct server ressource
+			 * @param payload  payload to send to server
+			 * @param callback called on main loop with server response
+			 * @param context  passed to callback
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+			 */
+			RequestId submitPATCH(const char* path, const JsonDocument& payload, ResponseCallback callback, void* context, const JsonDocument* filter = NULL);
+
+			/**
+			 * Submits DELETE query to distinct server
+			 *
+			 * @param path     path on distinct server ressource
+			 * @param callback called on main loop with server response
+			 * @param context  passed to callback
+			 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+			 * @return request handle or NetworkTask::NO_REQUEST if network queue is full
+			 */
+			RequestId submitDELETE(const char* path, ResponseCallback callback, void* context, const JsonDocument* filter = NULL);
+
+			/**
+			 * Forgets cached validators of path so that its next GET returns the body
+			 *
+			 * @param path path on distinct server ressource
+			 */
+			void invalidate(const char* path);
 		};
 
 	} // namespace Core
@@ -3,7 +3,7 @@
 
 // local Includes
 #include "core/Feature.hpp"
-#include "resources/r_battery.hpp"
+#include "resources/r_assets.hpp"
 
 namespace CrowOs {
 	namespace Feature {
@@ -41,8 +41,18 @@ namespace CrowOs {
 			/** Battery charging animation level */
 			int chargingAnimationLevel;
 
-			/** Last time animation has changed */
-			unsigned long lastAnimationChange;
+			/** Indicates if charging animation level has changed since last draw */
+			bool animationChanged;
+
+			/** Charging animation timer */
+			Core::TimerId animationTimer;
+
+			/**
+			 * Moves charging animation to next level, called by animationTimer
+			 *
+			 * @param battery to animate
+			 */
+			static void onAnimationTimer(void* battery);
 
 			/**
 			 * Calculates battery level in fonction of battery voltage and current
@@ -73,7 +83,7 @@ namespace CrowOs {
 			 * @param  batteryLevel to calculate for
 			 * @return image correspending icon
 			 */
-			const unsigned short* getBatteryLevelIcon(const int batteryLevel) const;
+			const Core::Asset* getBatteryLevelIcon(const int batteryLevel) const;
 
 			/**
 			 * Calculates battery level color in fonction of battery current and level
@@ -90,22 +100,19 @@ namespace CrowOs {
 
 			/**
 			 * Called after Feature creation before loop when state changes to this feature
-			 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+			 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 			 *
 			 * @param screenHelper Screen helper used to manage screen
 			 * @param timeHelper   Time helper used to manage upTime and sleepTime
 			 * @param ledHelper    Led helper used to manage Led state
-			 * @param savedData    pointer to feature persistent data
 			 */
-			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) override;
+			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper) override;
 
 			/**
 			 * Called before Feature destroying after loop when state changes from this feature to another
-			 * You should destroy all your variables here and save the persistent one into savedData pointer
-			 *
-			 * @param savedData pointer to feature persistent data
+			 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
 			 */
-			void onStop(DynamicJsonDocument* savedData) override;
+			void onStop() override;
 
 			/**
 			 * Main Feature loop
@@ -122,6 +129,14 @@ namespace CrowOs {
 			 * Called when home button is double clicked
 			 */
 			void onHomeDoubleClick() override;
+
+			/**
+			 * Indicates if feature has something to draw at next frame
+			 * Battery is sampled at idle main loop rate, charging animation and led blink are driven by timers
+			 *
+			 * @return true if loop should be called again as soon as possible
+			 */
+			const bool needsFrame() const override;
 		};
 
 	} // namespace Feature
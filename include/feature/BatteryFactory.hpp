@@ -14,6 +14,9 @@ namespace CrowOs {
 		class BatteryFactory : public Core::FeatureFactory {
 
 		public:
+			/** Feature factory name, also used by its descriptor */
+			static constexpr const char* NAME = "BatteryFactory";
+
 			/**
 			 * Initialise battery factory
 			 */
@@ -7,11 +7,21 @@
 
 // local Includes
 #include "core/Feature.hpp"
-#include "resources/r_libelle.hpp"
+#include "resources/r_assets.hpp"
 
 namespace CrowOs {
 	namespace Feature {
 
+		/**
+		 * Libelle state kept between activations
+		 */
+		struct LibelleState {
+			/** X calibration position */
+			float calibrationX;
+			/** Y calibration position */
+			float calibrationY;
+		};
+
 		/**
 		 * Small libelle feature
 		 */
@@ -42,14 +52,26 @@ namespace CrowOs {
 			/** Y circle position */
 			int positionY;
 
-			/** X calibration position */
-			float calibrationX;
-			/** Y calibration position */
-			float calibrationY;
+			/** Calibration kept by factory */
+			LibelleState& state;
 
 			/** circle radius */
 			int radius;
 
+			/** Sprite side, big enough for the old and new circle boxes of a usual frame move */
+			static const int SPRITE_SIZE = 48;
+
+			/** Off screen sprite where circle moves are composited */
+			Core::Hal::Canvas sprite;
+
+			/** X position of circle actually on screen, -1 if none */
+			int drawnX;
+			/** Y position of circle actually on screen, -1 if none */
+			int drawnY;
+
+			/** Color of calibration circle actually on screen, -1 if none */
+			int drawnCalibrationColor;
+
 			/**
 			 * Update position x and y values from MPU
 			 */
@@ -57,40 +79,52 @@ namespace CrowOs {
 
 			/**
 			 * Draw accelerometer circle
+			 * Union of old and new circle boxes is composited off screen and pushed once, nothing is drawn if circle did not move
 			 *
-			 * @param clear if true than it will use background color
+			 * @param force if true circle is drawn even if it did not move
 			 */
-			void drawCircle(const bool clear = false);
+			void drawCircle(const bool force = false);
 
 			/**
-			 * Draw calibration circle
+			 * Composites screen area into sprite with background, calibration circle and accelerometer circle then pushes it
+			 *
+			 * @param x area x position
+			 * @param y area y position
+			 * @param w area width, at most SPRITE_SIZE
+			 * @param h area height, at most SPRITE_SIZE
+			 */
+			void compositeArea(const int x, const int y, const int w, const int h);
+
+			/**
+			 * Draw calibration circle when its color changes
+			 *
+			 * @return true if calibration circle was drawn
 			 */
-			void drawCalibrationCircle();
+			const bool drawCalibrationCircle();
 
 		public:
 			/**
 			 * Initialise new Libelle
+			 *
+			 * @param state calibration kept by factory
 			 */
-			Libelle();
+			Libelle(LibelleState& state);
 
 			/**
 			 * Called after Feature creation before loop when state changes to this feature
-			 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+			 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 			 *
 			 * @param screenHelper Screen helper used to manage screen
 			 * @param timeHelper   Time helper used to manage upTime and sleepTime
 			 * @param ledHelper    Led helper used to manage Led state
-			 * @param savedData    pointer to feature persistent data
 			 */
-			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) override;
+			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper) override;
 
 			/**
 			 * Called before Feature destroying after loop when state changes from this feature to another
-			 * You should destroy all your variables here and save the persistent one into savedData pointer
-			 *
-			 * @param savedData pointer to feature persistent data
+			 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
 			 */
-			void onStop(DynamicJsonDocument* savedData) override;
+			void onStop() override;
 
 			/**
 			 * Main Feature loop
@@ -107,6 +141,14 @@ namespace CrowOs {
 			 * Called when home button is double clicked
 			 */
 			void onHomeDoubleClick() override;
+
+			/**
+			 * Gets frame rate wanted while feature needs frames
+			 * Bubble follows the imu, a higher rate makes it glide instead of jump
+			 *
+			 * @return target fps
+			 */
+			const double getTargetFps() const override;
 		};
 
 	} // namespace Feature
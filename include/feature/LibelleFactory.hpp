@@ -3,7 +3,7 @@
 
 // local Includes
 #include "Libelle.hpp"
-#include "core/FeatureFactory.hpp"
+#include "core/StatefulFeatureFactory.hpp"
 
 namespace CrowOs {
 	namespace Feature {
@@ -11,9 +11,12 @@ namespace CrowOs {
 		/**
 		 * Libelle factory class
 		 */
-		class LibelleFactory : public Core::FeatureFactory {
+		class LibelleFactory : public Core::StatefulFeatureFactory<LibelleState> {
 
 		public:
+			/** Feature factory name, also used by its descriptor */
+			static constexpr const char* NAME = "LibelleFactory";
+
 			/**
 			 * Initialise libelle factory
 			 */
@@ -29,6 +32,20 @@ namespace CrowOs {
 			 * @return Feature* your feature
 			 */
 			Core::Feature* createFeature() override;
+
+			/**
+			 * Restores state from saved data, missing fields keep their actual value
+			 *
+			 * @param savedData parsed saved data
+			 */
+			void readState(const JsonDocument& savedData) override;
+
+			/**
+			 * Writes state into saved data
+			 *
+			 * @param savedData to fill
+			 */
+			void writeState(JsonDocument& savedData) const override;
 		};
 
 	} // namespace Feature
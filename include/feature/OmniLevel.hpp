@@ -3,11 +3,19 @@
 
 // local Includes
 #include "core/Feature.hpp"
-#include "resources/r_omni_level.hpp"
+#include "resources/r_assets.hpp"
 
 namespace CrowOs {
 	namespace Feature {
 
+		/**
+		 * OmniLevel state kept between activations
+		 */
+		struct OmniLevelState {
+			/** Calibrated pressure var that goes between 0-127 from FSR reading */
+			int savedPressure;
+		};
+
 		/**
 		 * 3D printer bed leveling tool
 		 */
@@ -29,8 +37,17 @@ namespace CrowOs {
 			/** The var that goes between 0-127 from FSR reading */
 			int currentPressure;
 
-			/** Calibrated pressure var that goes between 0-127 from FSR reading */
-			int savedPressure;
+			/** Calibration kept by factory */
+			OmniLevelState& state;
+
+			/** Pressure actually shown by the progress bar, -1 if bar is not drawn */
+			int drawnPressure;
+
+			/** Indicator image actually shown, NULL if none */
+			const Core::Asset* shownIndicator;
+
+			/** Progress bar color of each pressure value */
+			static const uint16_t RAINBOW[128];
 
 			/**
 			 * Calculate error percentage between approx and exact
@@ -51,11 +68,19 @@ namespace CrowOs {
 
 			/**
 			 * Draw progress bar from currentPressure
+			 * Only rows between drawnPressure and currentPressure are painted
 			 */
 			void progressBar();
 
 			/**
-			 * Gets progresss bar rainbow colour
+			 * Shows leveling indicator image if it changed
+			 *
+			 * @param indicator image to show
+			 */
+			void showIndicator(const Core::Asset& indicator);
+
+			/**
+			 * Gets progresss bar rainbow colour, evaluated at compile time to build RAINBOW
 			 * The value is converted to a spectrum colour from 0 = blue through to red = blue
 			 *
 			 * @method rainbow
@@ -63,32 +88,38 @@ namespace CrowOs {
 			 *
 			 * @return a spectrum colour from 0 = blue through to red = blue
 			 */
-			unsigned int rainbow(int value);
+			static constexpr uint16_t rainbow(const int value) {
+
+				// Red is the top 5 bits, green the middle 6 bits and blue the bottom 5 bits
+				return value / 32 == 0 ? ((2 * (value % 32)) << 5) | 31
+					: value / 32 == 1 ? (63 << 5) | (31 - value % 32)
+					: value / 32 == 2 ? ((value % 32) << 11) | (63 << 5)
+					: (31 << 11) | ((63 - 2 * (value % 32)) << 5);
+			}
 
 		public:
 			/**
 			 * Initialise new OmniLevel feature
+			 *
+			 * @param state calibration kept by factory
 			 */
-			OmniLevel();
+			OmniLevel(OmniLevelState& state);
 
 			/**
 			 * Called after Feature creation before loop when state changes to this feature
-			 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+			 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 			 *
 			 * @param screenHelper Screen helper used to manage screen
 			 * @param timeHelper   Time helper used to manage upTime and sleepTime
 			 * @param ledHelper    Led helper used to manage Led state
-			 * @param savedData    pointer to feature persistent data
 			 */
-			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) override;
+			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper) override;
 
 			/**
 			 * Called before Feature destroying after loop when state changes from this feature to another
-			 * You should destroy all your variables here and save the persistent one into savedData pointer
-			 *
-			 * @param savedData pointer to feature persistent data
+			 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
 			 */
-			void onStop(DynamicJsonDocument* savedData) override;
+			void onStop() override;
 
 			/**
 			 * Main Feature loop
@@ -105,6 +136,14 @@ namespace CrowOs {
 			 * Called when home button is double clicked
 			 */
 			void onHomeDoubleClick() override;
+
+			/**
+			 * Gets frame rate wanted while feature needs frames
+			 * Pressure gauge only needs to follow the hand
+			 *
+			 * @return target fps
+			 */
+			const double getTargetFps() const override;
 		};
 
 	} // namespace Feature
@@ -3,7 +3,7 @@
 
 // local Includes
 #include "OmniLevel.hpp"
-#include "core/FeatureFactory.hpp"
+#include "core/StatefulFeatureFactory.hpp"
 
 namespace CrowOs {
 	namespace Feature {
@@ -11,9 +11,12 @@ namespace CrowOs {
 		/**
 		 * OmniLevel factory class
 		 */
-		class OmniLevelFactory : public Core::FeatureFactory {
+		class OmniLevelFactory : public Core::StatefulFeatureFactory<OmniLevelState> {
 
 		public:
+			/** Feature factory name, also used by its descriptor */
+			static constexpr const char* NAME = "OmniLevelFactory";
+
 			/**
 			 * Initialise OmniLevel factory
 			 */
@@ -29,6 +32,20 @@ namespace CrowOs {
 			 * @return Feature* your feature
 			 */
 			Core::Feature* createFeature() override;
+
+			/**
+			 * Restores state from saved data, missing fields keep their actual value
+			 *
+			 * @param savedData parsed saved data
+			 */
+			void readState(const JsonDocument& savedData) override;
+
+			/**
+			 * Writes state into saved data
+			 *
+			 * @param savedData to fill
+			 */
+			void writeState(JsonDocument& savedData) const override;
 		};
 
 	} // namespace Feature
@@ -78,6 +78,35 @@ namespace CrowOs {
 			}
 		};
 
+		/**
+		 * Printers list shared by printer features and their factory
+		 */
+		class PrinterList {
+		public:
+			/** List of fetched printers */
+			Printer printers[5];
+
+			/** Size of discovered printers */
+			int printerSize;
+
+			/** Incremented each time list is read from backend */
+			uint32_t version;
+
+			PrinterList()
+				: printers()
+				, printerSize(0)
+				, version(0) {
+			}
+		};
+
+		/**
+		 * Printer feature state kept between activations
+		 */
+		struct PrinterFeatureState {
+			/** Current printer index */
+			short printerIndex;
+		};
+
 		/**
 		 * Printer feature class
 		 */
@@ -93,17 +122,29 @@ namespace CrowOs {
 			/** Pointer to screen helper */
 			Core::Screen* screen;
 
-			/** Web client instance */
-			Core::WebClient webClient;
+			/** Web client kept by factory */
+			Core::WebClient& webClient;
 
 			/** Indicates if screen should be redrawen */
 			boolean shouldRedrawScreen;
 
-			/** Last time printers list was fetched */
-			int lastPrinterListFetch;
+			/** Printers list fetch hold off, list is not fetched again while it is scheduled */
+			Core::TimerId printerListFetchTimer;
+
+			/** Printer fetch hold off, printer is not fetched again while it is scheduled */
+			Core::TimerId printerFetchTimer;
+
+			/** Pending printers list request */
+			Core::RequestId printerListRequest;
+
+			/** Pending printer request */
+			Core::RequestId printerRequest;
 
-			/** Last time printer was fetched */
-			int lastPrinterFetch;
+			/** Pending led color request */
+			Core::RequestId ledColorRequest;
+
+			/** Index of printer requested by printerRequest */
+			short fetchedPrinterIndex;
 
 			/** foreground color */
 			const uint16_t foregroundColor;
@@ -111,17 +152,17 @@ namespace CrowOs {
 			/** background color */
 			const uint16_t backgroundColor;
 
-			/** Size of discovered printers */
-			int printerSize;
-
-			/** Current printer index */
-			short printerIndex;
+			/** Current printer index kept by factory */
+			PrinterFeatureState& state;
 
 			/** Current view index 0 = printersMenu; 1 = printerDetails */
 			short viewIndex;
 
-			/** List of fetched printers */
-			Printer printers[5];
+			/** Fetched printers kept by factory */
+			PrinterList& printerList;
+
+			/** Version of printers list last drawn */
+			uint32_t drawnListVersion;
 
 			/**
 			 * Fetch printer list from backend
@@ -133,6 +174,56 @@ namespace CrowOs {
 			 */
 			void fetchPrinter();
 
+			/**
+			 * Stores fetched printer list
+			 *
+			 * @param status       http status
+			 * @param responseBody fetched printer list
+			 */
+			void onPrinterList(const int status, JsonDocument& responseBody);
+
+			/**
+			 * Stores fetched printer
+			 *
+			 * @param status     http status
+			 * @param printerDto fetched printer
+			 */
+			void onPrinter(const int status, JsonDocument& printerDto);
+
+			/**
+			 * Shows led color change error
+			 *
+			 * @param status http status
+			 */
+			void onLedColor(const int status);
+
+			/**
+			 * Called on main loop when printer list request completes
+			 *
+			 * @param status       http status
+			 * @param responseBody fetched printer list
+			 * @param context      PrinterFeature instance
+			 */
+			static void onPrinterListResponse(const int status, JsonDocument& responseBody, void* context);
+
+			/**
+			 * Called on main loop when printer request completes
+			 *
+			 * @param status       http status
+			 * @param responseBody fetched printer
+			 * @param context      PrinterFeature instance
+			 */
+			static void onPrinterResponse(const int status, JsonDocument& responseBody, void* context);
+
+			/**
+			 * Called on main loop when led color request completes
+			 *
+			 * @param status       http status
+			 * @param responseBody unused
+			 * @param context      PrinterFeature instance
+			 */
+			static void onLedColorResponse(const int status, JsonDocument& responseBody, void* context);
+
 			/**
 			 * Shows printer list menu
 			 * user can choose between diferent printers clicking home button
@@ -153,27 +244,71 @@ namespace CrowOs {
 		public:
 			/**
 			 * Initialise new PrinterFeature
+			 *
+			 * @param state       current printer kept by factory
+			 * @param webClient   web client kept by factory
+			 * @param printerList fetched printers kept by factory
+			 */
+			PrinterFeature(PrinterFeatureState& state, Core::WebClient& webClient, PrinterList& printerList);
+
+			/**
+			 * Submits printer list request
+			 *
+			 * @param webClient used to send request
+			 * @param callback  called on main loop when request completes
+			 * @param context   passed to callback
+			 * @return request handle
+			 */
+			static Core::RequestId submitPrinterList(Core::WebClient& webClient, Core::ResponseCallback callback, void* context);
+
+			/**
+			 * Reads fetched printer list
+			 *
+			 * @param responseBody fetched printer list
+			 * @param printerList  to fill
+			 * @param webClient    whose cached printers are invalidated when they moved in list
 			 */
-			PrinterFeature();
+			static void readPrinterList(JsonDocument& responseBody, PrinterList& printerList, Core::WebClient& webClient);
 
 			/**
 			 * Called after Feature creation before loop when state changes to this feature
-			 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+			 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 			 *
 			 * @param screenHelper Screen helper used to manage screen
 			 * @param timeHelper   Time helper used to manage upTime and sleepTime
 			 * @param ledHelper    Led helper used to manage Led state
-			 * @param savedData    pointer to feature persistent data
 			 */
-			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) override;
+			void onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper) override;
 
 			/**
 			 * Called before Feature destroying after loop when state changes from this feature to another
-			 * You should destroy all your variables here and save the persistent one into savedData pointer
+			 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
+			 */
+			void onStop() override;
+
+			/**
+			 * Indicates if feature can be suspended instead of being destroyed when state changes from this feature to another
+			 * Hold off timers are kept so that switching back shows printers without fetching them again
 			 *
-			 * @param savedData pointer to feature persistent data
+			 * @return true
+			 */
+			const bool canSuspend() const override;
+
+			/**
+			 * Called after loop instead of onStop when state changes from this feature to another and feature can be suspended
+			 * Pending requests are cancelled, printers are kept
 			 */
-			void onStop(DynamicJsonDocument* savedData) override;
+			void onSuspend() override;
+
+			/**
+			 * Called instead of onStart when state changes back to this suspended feature
+			 * Kept printers are drawn on first frame
+			 *
+			 * @param screenHelper Screen helper used to manage screen
+			 * @param timeHelper   Time helper used to manage upTime and sleepTime
+			 * @param ledHelper    Led helper used to manage Led state
+			 */
+			void onResume(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper) override;
 
 			/**
 			 * Main Feature loop
@@ -190,6 +325,22 @@ namespace CrowOs {
 			 * Called when home button is double clicked
 			 */
 			void onHomeDoubleClick() override;
+
+			/**
+			 * Indicates if feature has something to draw at next frame
+			 * Printers are fetched in background when hold off timers expire, screen is redrawn only after a changed response, a prefetched list or a click
+			 *
+			 * @return true if loop should be called again as soon as possible
+			 */
+			const bool needsFrame() const override;
+
+			/**
+			 * Gets frame rate wanted while feature needs frames
+			 * Screen is redrawn only after a fetch or a click
+			 *
+			 * @return target fps
+			 */
+			const double getTargetFps() const override;
 		};
 
 	} // namespace Feature
@@ -3,7 +3,7 @@
 
 // local Includes
 #include "PrinterFeature.hpp"
-#include "core/FeatureFactory.hpp"
+#include "core/StatefulFeatureFactory.hpp"
 
 namespace CrowOs {
 	namespace Feature {
@@ -11,9 +11,37 @@ namespace CrowOs {
 		/**
 		 * Printer feature factory factory class
 		 */
-		class PrinterFeatureFactory : public Core::FeatureFactory {
+		class PrinterFeatureFactory : public Core::StatefulFeatureFactory<PrinterFeatureState> {
+
+		private:
+			/** Delay to wait between two printer list prefetches */
+			static const int PREFETCH_DELAY = 30000;
+
+			/** Web client shared with features so that their requests are conditional on prefetched responses */
+			Core::WebClient webClient;
+
+			/** Fetched printers shared with features */
+			PrinterList printerList;
+
+			/** Prefetch hold off, printer list is not prefetched again while it is scheduled */
+			Core::TimerId prefetchTimer;
+
+			/** Pending prefetch request */
+			Core::RequestId prefetchRequest;
+
+			/**
+			 * Called on main loop when prefetch request completes
+			 *
+			 * @param status       http status
+			 * @param responseBody fetched printer list
+			 * @param context      PrinterFeatureFactory instance
+			 */
+			static void onPrefetchResponse(const int status, JsonDocument& responseBody, void* context);
 
 		public:
+			/** Feature factory name, also used by its descriptor */
+			static constexpr const char* NAME = "PrinterFeatureFactory";
+
 			/**
 			 * Initialise printer feature factory
 			 */
@@ -29,6 +57,25 @@ namespace CrowOs {
 			 * @return Feature* your feature
 			 */
 			Core::Feature* createFeature() override;
+
+			/**
+			 * Prefetches printer list so that printer feature shows it on its first frame
+			 */
+			void prefetch() override;
+
+			/**
+			 * Restores state from saved data, missing fields keep their actual value
+			 *
+			 * @param savedData parsed saved data
+			 */
+			void readState(const JsonDocument& savedData) override;
+
+			/**
+			 * Writes state into saved data
+			 *
+			 * @param savedData to fill
+			 */
+			void writeState(JsonDocument& savedData) const override;
 		};
 
 	} // namespace Feature
@@ -0,0 +1,65 @@
+#ifndef R_ASSETS_H
+#define R_ASSETS_H
+
+// Generated by   : tools/asset_converter.py, do not edit
+// Generated from : assets/
+// Memory usage   : 12764 bytes instead of 34040 bytes
+
+// local Includes
+#include "core/Asset.hpp"
+
+/** r_logo.hpp 79x144, 8602 bytes */
+extern const CrowOs::Core::Asset res_logo;
+
+/** r_battery.hpp 16x10, 94 bytes */
+extern const CrowOs::Core::Asset res_battery_10;
+
+/** r_battery.hpp 16x10, 116 bytes */
+extern const CrowOs::Core::Asset res_battery_35;
+
+/** r_battery.hpp 16x10, 106 bytes */
+extern const CrowOs::Core::Asset res_battery_50;
+
+/** r_battery.hpp 16x10, 102 bytes */
+extern const CrowOs::Core::Asset res_battery_65;
+
+/** r_battery.hpp 16x10, 102 bytes */
+extern const CrowOs::Core::Asset res_battery_80;
+
+/** r_battery.hpp 16x10, 32 bytes */
+extern const CrowOs::Core::Asset res_battery_100;
+
+/** r_wifi.hpp 16x10, 255 bytes */
+extern const CrowOs::Core::Asset res_wifi_connected;
+
+/** r_wifi.hpp 16x10, 277 bytes */
+extern const CrowOs::Core::Asset res_wifi_disconnected;
+
+/** r_wifi.hpp 16x10, 256 bytes */
+extern const CrowOs::Core::Asset res_wifi_connecting;
+
+/** r_wifi.hpp 16x10, 261 bytes */
+extern const CrowOs::Core::Asset res_wifi_connfiguring;
+
+/** r_wifi.hpp 16x10, 271 bytes */
+extern const CrowOs::Core::Asset res_wifi_error;
+
+/** r_omni_level.hpp 32x32, 391 bytes */
+extern const CrowOs::Core::Asset rotate_left;
+
+/** r_omni_level.hpp 32x32, 402 bytes */
+extern const CrowOs::Core::Asset rotate_right;
+
+/** r_omni_level.hpp 32x32, 555 bytes */
+extern const CrowOs::Core::Asset thumbs_up;
+
+/** r_libelle.hpp 29x28, 942 bytes */
+extern const CrowOs::Core::Asset res_circle;
+
+/** All assets */
+extern const CrowOs::Core::Asset* const ASSETS[];
+
+/** Number of assets */
+extern const short ASSETS_COUNT;
+
+#endif
@@ -0,0 +1,453 @@
+/**
+ * Minimal Arduino core implementation for the native build
+ * @author error23
+ */
+#include "Arduino.h"
+
+// Lib includes
+#include <chrono>
+#include <poll.h>
+#include <thread>
+#include <unistd.h>
+
+/** Number of emulated pins */
+static const int PIN_COUNT = 64;
+
+/** Latched pin levels */
+static uint8_t pinLevels[PIN_COUNT];
+
+/** Serial instance, constant initialised so that static constructors can log */
+HardwareSerial Serial;
+
+/**
+ * Gets program start time, initialised on first call so that static constructors get a valid clock
+ *
+ * @return program start time
+ */
+static std::chrono::steady_clock::time_point startTime() {
+	static const std::chrono::steady_clock::time_point START_TIME = std::chrono::steady_clock::now();
+	return START_TIME;
+}
+
+/**
+ * Gets milliseconds since program start
+ *
+ * @return milliseconds since program start
+ */
+unsigned long millis() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime()).count();
+}
+
+/**
+ * Gets microseconds since program start
+ *
+ * @return microseconds since program start
+ */
+unsigned long micros() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime()).count();
+}
+
+/**
+ * Sleeps for given milliseconds
+ *
+ * @param ms milliseconds to sleep
+ */
+void delay(unsigned long ms) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/**
+ * Sleeps for given microseconds
+ *
+ * @param us microseconds to sleep
+ */
+void delayMicroseconds(unsigned int us) {
+	std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+/**
+ * Sets pin mode, pins configured with INPUT_PULLUP are read HIGH until something writes them LOW
+ *
+ * @param pin  to configure
+ * @param mode INPUT, OUTPUT or INPUT_PULLUP
+ */
+void pinMode(uint8_t pin, uint8_t mode) {
+	if(pin < PIN_COUNT && mode == INPUT_PULLUP) pinLevels[pin] = HIGH;
+}
+
+/**
+ * Latches pin level
+ *
+ * @param pin   to write
+ * @param level HIGH or LOW
+ */
+void digitalWrite(uint8_t pin, uint8_t level) {
+	if(pin < PIN_COUNT) pinLevels[pin] = level ? HIGH : LOW;
+}
+
+/**
+ * Reads latched pin level
+ *
+ * @param pin to read
+ * @return HIGH or LOW
+ */
+int digitalRead(uint8_t pin) {
+	return pin < PIN_COUNT ? pinLevels[pin] : LOW;
+}
+
+/**
+ * Re-maps a number from one range to another
+ */
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+	return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// String
+
+String::String(const char* cstr /* = "" */)
+	: buffer(cstr != NULL ? cstr : "") {
+}
+
+String::String(const std::string& str)
+	: buffer(str) {
+}
+
+String::String(const char c)
+	: buffer(1, c) {
+}
+
+String::String(const int value, const unsigned char base /* = 10 */)
+	: String((long)value, base) {
+}
+
+String::String(const unsigned int value, const unsigned char base /* = 10 */)
+	: String((unsigned long)value, base) {
+}
+
+String::String(const long value, const unsigned char base /* = 10 */) {
+	char buff[34];
+	if(base == 16) {
+		snprintf(buff, sizeof buff, "%lx", value);
+	}
+	else {
+		snprintf(buff, sizeof buff, "%ld", value);
+	}
+	buffer = buff;
+}
+
+String::String(const unsigned long value, const unsigned char base /* = 10 */) {
+	char buff[34];
+	if(base == 16) {
+		snprintf(buff, sizeof buff, "%lx", value);
+	}
+	else {
+		snprintf(buff, sizeof buff, "%lu", value);
+	}
+	buffer = buff;
+}
+
+String::String(const double value, const unsigned char decimalPlaces /* = 2 */) {
+	char buff[34];
+	snprintf(buff, sizeof buff, "%.*f", decimalPlaces, value);
+	buffer = buff;
+}
+
+const char* String::c_str() const {
+	return buffer.c_str();
+}
+
+unsigned int String::length() const {
+	return buffer.length();
+}
+
+bool String::isEmpty() const {
+	return buffer.empty();
+}
+
+bool String::reserve(unsigned int size) {
+	buffer.reserve(size);
+	return true;
+}
+
+bool String::concat(const char* cstr) {
+	if(cstr == NULL) return false;
+	buffer.append(cstr);
+	return true;
+}
+
+bool String::concat(const char* cstr, unsigned int length) {
+	if(cstr == NULL) return false;
+	buffer.append(cstr, length);
+	return true;
+}
+
+bool String::concat(const char c) {
+	buffer.push_back(c);
+	return true;
+}
+
+bool String::concat(const String& str) {
+	buffer.append(str.buffer);
+	return true;
+}
+
+String& String::operator+=(const char* cstr) {
+	concat(cstr);
+	return *this;
+}
+
+String& String::operator+=(const char c) {
+	concat(c);
+	return *this;
+}
+
+String& String::operator+=(const String& str) {
+	concat(str);
+	return *this;
+}
+
+bool String::equals(const char* cstr) const {
+	if(cstr == NULL) return buffer.empty();
+	return buffer == cstr;
+}
+
+bool String::operator==(const char* cstr) const {
+	return equals(cstr);
+}
+
+bool String::operator==(const String& str) const {
+	return buffer == str.buffer;
+}
+
+bool String::operator!=(const char* cstr) const {
+	return !equals(cstr);
+}
+
+bool String::operator!=(const String& str) const {
+	return buffer != str.buffer;
+}
+
+char String::operator[](unsigned int index) const {
+	return index < buffer.length() ? buffer[index] : '\0';
+}
+
+int String::indexOf(const char c, unsigned int fromIndex /* = 0 */) const {
+	size_t index = buffer.find(c, fromIndex);
+	return index == std::string::npos ? -1 : (int)index;
+}
+
+String String::substring(unsigned int beginIndex) const {
+	if(beginIndex >= buffer.length()) return String();
+	return String(buffer.substr(beginIndex));
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+	if(beginIndex >= buffer.length() || endIndex <= beginIndex) return String();
+	return String(buffer.substr(beginIndex, endIndex - beginIndex));
+}
+
+long String::toInt() const {
+	return strtol(buffer.c_str(), NULL, 10);
+}
+
+StringSumHelper::StringSumHelper(const String& str)
+	: String(str) {
+}
+
+StringSumHelper operator+(const StringSumHelper& lhs, const String& rhs) {
+	StringSumHelper sum(lhs);
+	sum.concat(rhs);
+	return sum;
+}
+
+StringSumHelper operator+(const StringSumHelper& lhs, const char* rhs) {
+	StringSumHelper sum(lhs);
+	sum.concat(rhs);
+	return sum;
+}
+
+// Print
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+	size_t written = 0;
+	while(size--) {
+		written += write(*buffer++);
+	}
+	return written;
+}
+
+size_t Print::write(const char* str) {
+	if(str == NULL) return 0;
+	return write((const uint8_t*)str, strlen(str));
+}
+
+size_t Print::print(const char* str) {
+	return write(str);
+}
+
+size_t Print::print(const String& str) {
+	return write(str.c_str());
+}
+
+size_t Print::print(const char c) {
+	return write((uint8_t)c);
+}
+
+size_t Print::print(const int value) {
+	return print((long)value);
+}
+
+size_t Print::print(const unsigned int value) {
+	return print((unsigned long)value);
+}
+
+size_t Print::print(const long value) {
+	return printf("%ld", value);
+}
+
+size_t Print::print(const unsigned long value) {
+	return printf("%lu", value);
+}
+
+size_t Print::print(const double value, const int digits /* = 2 */) {
+	return printf("%.*f", digits, value);
+}
+
+size_t Print::println() {
+	return write("\r\n");
+}
+
+size_t Print::println(const char* str) {
+	return print(str) + println();
+}
+
+size_t Print::println(const String& str) {
+	return print(str) + println();
+}
+
+size_t Print::println(const int value) {
+	return print(value) + println();
+}
+
+size_t Print::println(const unsigned long value) {
+	return print(value) + println();
+}
+
+size_t Print::printf(const char* format, ...) {
+
+	char buff[256];
+	va_list args;
+
+	va_start(args, format);
+	int length = vsnprintf(buff, sizeof buff, format, args);
+	va_end(args);
+
+	if(length < 0) return 0;
+	if((size_t)length < sizeof buff) return write((const uint8_t*)buff, length);
+
+	std::string big(length + 1, '\0');
+	va_start(args, format);
+	vsnprintf(&big[0], big.size(), format, args);
+	va_end(args);
+
+	return write((const uint8_t*)big.c_str(), length);
+}
+
+// Stream
+
+int Stream::timedRead() {
+
+	unsigned long start = millis();
+	do {
+		int c = read();
+		if(c >= 0) return c;
+	} while(millis() - start < timeout);
+
+	return -1;
+}
+
+void Stream::setTimeout(unsigned long newTimeout) {
+	timeout = newTimeout;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+
+	size_t count = 0;
+	while(count < length) {
+		int c = timedRead();
+		if(c < 0) break;
+		*buffer++ = (char)c;
+		count++;
+	}
+	return count;
+}
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+	return readBytes((char*)buffer, length);
+}
+
+// HardwareSerial
+
+void HardwareSerial::begin(unsigned long /* baud */) {
+	setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+void HardwareSerial::end() {
+	flush();
+}
+
+void HardwareSerial::flush() {
+	fflush(stdout);
+}
+
+int HardwareSerial::available() {
+
+	if(peeked >= 0) return 1;
+
+	struct pollfd fd = {STDIN_FILENO, POLLIN, 0};
+	return poll(&fd, 1, 0) > 0 && (fd.revents & POLLIN) ? 1 : 0;
+}
+
+int HardwareSerial::read() {
+
+	if(peeked >= 0) {
+		int c = peeked;
+		peeked = -1;
+		return c;
+	}
+
+	if(!available()) return -1;
+
+	unsigned char c;
+	return ::read(STDIN_FILENO, &c, 1) == 1 ? c : -1;
+}
+
+int HardwareSerial::peek() {
+
+	if(peeked < 0) peeked = read();
+	return peeked;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+	return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+	return fwrite(buffer, 1, size, stdout);
+}
+
+HardwareSerial::operator bool() const {
+	return true;
+}
+
+/**
+ * Native program entry point, mimics the arduino core main task
+ */
+int main() {
+
+	setup();
+	for(;;) {
+		loop();
+	}
+	return 0;
+}
@@ -0,0 +1,249 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+/**
+ * Minimal Arduino core for the native build
+ *
+ * Only the part of the Arduino API used by CrowOs and its libraries is implemented here.
+ * Time is taken from the host monotonic clock, pins are simple latched levels and Serial is bound to stdin/stdout.
+ */
+
+// Lib includes
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::abs;
+using std::max;
+using std::min;
+using std::round;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x02
+#define INPUT_PULLUP 0x05
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+/**
+ * Gets milliseconds since program start
+ *
+ * @return milliseconds since program start
+ */
+unsigned long millis();
+
+/**
+ * Gets microseconds since program start
+ *
+ * @return microseconds since program start
+ */
+unsigned long micros();
+
+/**
+ * Sleeps for given milliseconds
+ *
+ * @param ms milliseconds to sleep
+ */
+void delay(unsigned long ms);
+
+/**
+ * Sleeps for given microseconds
+ *
+ * @param us microseconds to sleep
+ */
+void delayMicroseconds(unsigned int us);
+
+/**
+ * Sets pin mode, pins configured with INPUT_PULLUP are read HIGH until something writes them LOW
+ *
+ * @param pin  to configure
+ * @param mode INPUT, OUTPUT or INPUT_PULLUP
+ */
+void pinMode(uint8_t pin, uint8_t mode);
+
+/**
+ * Latches pin level
+ *
+ * @param pin   to write
+ * @param level HIGH or LOW
+ */
+void digitalWrite(uint8_t pin, uint8_t level);
+
+/**
+ * Reads latched pin level
+ *
+ * @param pin to read
+ * @return HIGH or LOW
+ */
+int digitalRead(uint8_t pin);
+
+/**
+ * Re-maps a number from one range to another
+ */
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+/**
+ * Arduino String implemented over std::string
+ */
+class String {
+
+private:
+	/** String content */
+	std::string buffer;
+
+public:
+	String(const char* cstr = "");
+	String(const std::string& str);
+	String(const char c);
+	String(const int value, const unsigned char base = 10);
+	String(const unsigned int value, const unsigned char base = 10);
+	String(const long value, const unsigned char base = 10);
+	String(const unsigned long value, const unsigned char base = 10);
+	String(const double value, const unsigned char decimalPlaces = 2);
+
+	const char* c_str() const;
+	unsigned int length() const;
+	bool isEmpty() const;
+	bool reserve(unsigned int size);
+
+	bool concat(const char* cstr);
+	bool concat(const char* cstr, unsigned int length);
+	bool concat(const char c);
+	bool concat(const String& str);
+
+	String& operator+=(const char* cstr);
+	String& operator+=(const char c);
+	String& operator+=(const String& str);
+
+	bool equals(const char* cstr) const;
+	bool operator==(const char* cstr) const;
+	bool operator==(const String& str) const;
+	bool operator!=(const char* cstr) const;
+	bool operator!=(const String& str) const;
+
+	char operator[](unsigned int index) const;
+	int indexOf(const char c, unsigned int fromIndex = 0) const;
+	String substring(unsigned int beginIndex) const;
+	String substring(unsigned int beginIndex, unsigned int endIndex) const;
+	long toInt() const;
+};
+
+/**
+ * Arduino string concatenation helper, needed by ArduinoJson string adapters
+ */
+class StringSumHelper : public String {
+public:
+	StringSumHelper(const String& str);
+};
+
+StringSumHelper operator+(const StringSumHelper& lhs, const String& rhs);
+StringSumHelper operator+(const StringSumHelper& lhs, const char* rhs);
+
+/**
+ * Arduino Print base class
+ */
+class Print {
+
+public:
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	size_t write(const char* str);
+
+	size_t print(const char* str);
+	size_t print(const String& str);
+	size_t print(const char c);
+	size_t print(const int value);
+	size_t print(const unsigned int value);
+	size_t print(const long value);
+	size_t print(const unsigned long value);
+	size_t print(const double value, const int digits = 2);
+
+	size_t println();
+	size_t println(const char* str);
+	size_t println(const String& str);
+	size_t println(const int value);
+	size_t println(const unsigned long value);
+
+	size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+/**
+ * Arduino Stream base class
+ */
+class Stream : public Print {
+
+protected:
+	/** Number of ms to wait for the next char before aborting timed read */
+	unsigned long timeout;
+
+	/**
+	 * Reads a char waiting at most timeout ms
+	 *
+	 * @return read char or -1 on timeout
+	 */
+	int timedRead();
+
+public:
+	constexpr Stream()
+		: timeout(1000) {
+	}
+
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	void setTimeout(unsigned long timeout);
+	size_t readBytes(char* buffer, size_t length);
+	size_t readBytes(uint8_t* buffer, size_t length);
+};
+
+/**
+ * Serial port bound to process stdin/stdout
+ */
+class HardwareSerial : public Stream {
+
+private:
+	/** Char read by peek and not consumed yet, -1 if none */
+	int peeked;
+
+public:
+	constexpr HardwareSerial()
+		: peeked(-1) {
+	}
+
+	void begin(unsigned long baud);
+	void end();
+	void flush();
+
+	int available() override;
+	int read() override;
+	int peek() override;
+
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	using Print::write;
+
+	operator bool() const;
+};
+
+extern HardwareSerial Serial;
+
+/**
+ * Arduino sketch entry points, implemented by the application
+ */
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef NATIVE_PRINT_H
+#define NATIVE_PRINT_H
+
+// Everything lives in Arduino.h in the native core
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef NATIVE_WSTRING_H
+#define NATIVE_WSTRING_H
+
+// Everything lives in Arduino.h in the native core
+#include "Arduino.h"
+
+#endif
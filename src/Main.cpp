@@ -13,7 +13,10 @@ OneButton homeButton(BUTTON_A_PIN, true);
 OneButton upButton(BUTTON_B_PIN, true);
 
 /** Time helper */
-Time timeHelper(120, 30);
+Time timeHelper(120);
+
+/** Frame pacer */
+FramePacer framePacer(MAX_FPS);
 
 /** Led helper */
 Led ledHelper;
@@ -22,7 +25,7 @@ Led ledHelper;
 Screen screenHelper;
 
 /** SmartWifi helper */
-SmartWifi smartWifi;
+SmartWifi smartWifi(&screenHelper);
 
 /** Web client helper */
 WebClient webClient(BACKEND_HOST, BACKEND_PORT, BACKEND_USER_USERNAME, BACKEND_USER_PASSWORD, BACKEND_BASE_PATH);
@@ -42,29 +45,50 @@ int newFeatureIndex = 0;
 /** Indicates if device is sleeping */
 bool sleeping = false;
 
+/** Input burst, main loop does not block while it is scheduled */
+TimerId inputTimer = Scheduler::NO_TIMER;
+
+/** Server feature data request */
+RequestId featureDataRequest = NetworkTask::NO_REQUEST;
+
+/** Server feature data hold off after a failed request */
+TimerId featureDataTimer = Scheduler::NO_TIMER;
+
+/** Indicates if local feature data was reconciled with the server */
+bool featureDataReconciled = false;
+
+/** Indicates if first frame was drawn */
+bool firstFrameDrawn = false;
+
+// unit tests bring their own setup and loop
+#ifndef UNIT_TEST
 /**
  * Main setUp method
  */
 void setup() {
 
-	M5.begin();
+	Hal::begin();
 	Serial.begin(115200);
-	M5.Axp.begin();
-	M5.Lcd.setSwapBytes(true);
-	M5.MPU6886.Init();
+	Log::begin();
+	Hal::Pmic::begin();
+	Hal::Display::begin();
+	Hal::Imu::begin();
+	Hal::Storage::begin();
 	screenHelper.setUp();
 	screenHelper.showLogo();
+	screenHelper.reportAssets();
 
 	timeHelper.setUp();
 	ledHelper.setUp();
 	setUpButtons();
+	Events::begin();
+	NetworkTask::begin();
 	smartWifi.setUp();
 
-	initialiseFeatureFactories();
 	initialiseFeatureData();
 	setUpPermanentFeatures();
 
-	if(LOG_INFO) Serial.println("Info : [Main] Setup Done");
+	LOG_INFO(Main, "Setup Done duration = %u ms", (unsigned int)(Hal::Clock::getMicroseconds() / 1000));
 }
 
 /**
@@ -72,8 +96,27 @@ void setup() {
  */
 void loop() {
 
-	timeHelper.limitFps();
-	tickButtons();
+	waitNextFrame();
+	Profiler::Scope frameScope("frame");
+	timeHelper.loop();
+
+	{
+		Profiler::Scope scope("buttons");
+		tickButtons();
+		Profiler::poll();
+	}
+
+	// Expire timers before anything reads them
+	{
+		Profiler::Scope scope("timers");
+		Scheduler::run();
+	}
+
+	// Deliver network responses before features read them
+	{
+		Profiler::Scope scope("network");
+		NetworkTask::poll();
+	}
 
 	if(timeHelper.shouldSleep() || sleeping) {
 		sleep();
@@ -81,10 +124,18 @@ void loop() {
 	else {
 
 		// Checks wifi status and try to reconnect it if is not connected
-		if(!smartWifi.checkStatus()) smartWifi.reconnect();
+		bool connected;
+		{
+			Profiler::Scope scope("wifi");
+			connected = smartWifi.checkStatus();
+			if(!connected) smartWifi.reconnect();
+			else if(!featureDataReconciled) reconcileFeatureData();
+			else Journal::replay();
+		}
 
 		// loop permanent features
 		for(auto& feature : permanentFeatures) {
+			Profiler::Scope scope(feature->getFeatureName());
 			feature->loop();
 		}
 
@@ -94,35 +145,57 @@ void loop() {
 			// switch normal feature if index has changed
 			if(newFeatureIndex != currentFeatureIndex) {
 
-				if(currentFeature != NULL) killCurrentFeature();
+				Profiler::Scope scope("switch");
+				if(currentFeature != NULL) suspendCurrentFeature();
 				currentFeature = startFeature(newFeatureIndex);
 				currentFeatureIndex = newFeatureIndex;
 			}
 
 			// loop current feature if exists
-			if(currentFeature != NULL) currentFeature->loop();
+			if(currentFeature != NULL) {
+				Profiler::Scope scope(currentFeature->getFeatureName());
+				currentFeature->loop();
+			}
+
+			// up button always switches to next feature, warm it while current one is shown
+			if(connected && currentFeature != NULL) {
+				Profiler::Scope scope("prefetch");
+				prefetchNextFeature();
+			}
 		}
 	}
-	screenHelper.loop();
+
+	{
+		Profiler::Scope scope("screen");
+		screenHelper.loop();
+	}
+
+	// Boot metric, features started from local copy so this does not wait for wifi
+	if(!firstFrameDrawn) {
+		firstFrameDrawn = true;
+		LOG_INFO(Main, "boot timeToFirstFrame = %u ms", (unsigned int)(Hal::Clock::getMicroseconds() / 1000));
+	}
 }
+#endif
 
 /**
  * Main shutdown method
  */
 void shutdown() {
 
-	if(LOG_INFO) Serial.println("Info : [Main] shutdown ...");
+	LOG_INFO(Main, "shutdown ...");
 	screenHelper.showLogo();
 
-	killCurrentFeature();
-	saveFeatureDataToServer(true);
+	if(currentFeature != NULL) killCurrentFeature();
+	stopSuspendedFeatures();
+	saveFeatureData();
 	shutdownPermanentFeatures();
-	shutdownFeatureFactories();
 	smartWifi.disconnect();
 
-	if(LOG_INFO) Serial.println("Info : [Main] shutdown Done");
+	LOG_INFO(Main, "shutdown Done");
+	Log::flush();
 	delay(100);
-	M5.Axp.PowerOff();
+	Hal::Pmic::powerOff();
 }
 
 /**
@@ -130,19 +203,16 @@ void shutdown() {
  */
 void sleep() {
 
-	if(LOG_INFO) Serial.println("Info : [Main] sleep");
+	LOG_INFO(Main, "sleep");
 
-	if(sleeping) {
-		delay(500);
-		if(LOG_DEBUG) Serial.println("Debug : [Main] sleep delay = 500 ms");
-		return;
-	}
+	// Main loop light sleeps in waitNextFrame
+	if(sleeping) return;
 
 	sleeping = true;
-	if(LOG_DEBUG) Serial.println("Debug : [Main] sleep sleeping = true");
-	saveFeatureDataToServer(false);
-	if(currentFeature != NULL) killCurrentFeature();
-	M5.Axp.SetSleep();
+	LOG_DEBUG(Main, "sleep sleeping = true");
+	if(currentFeature != NULL) suspendCurrentFeature();
+	saveFeatureData();
+	Hal::Pmic::sleep();
 	smartWifi.disconnect();
 }
 
@@ -152,11 +222,11 @@ void sleep() {
 void wakeUp() {
 
 	if(!sleeping) return;
-	if(LOG_INFO) Serial.println("Info : [Main] wakeUp");
+	LOG_INFO(Main, "wakeUp");
 
 	timeHelper.keepWokedUp();
-	M5.Axp.begin();
-	M5.Lcd.setSwapBytes(true);
+	Hal::Pmic::begin();
+	Hal::Display::begin();
 	screenHelper.setUp();
 	smartWifi.connect();
 	if(currentFeatureIndex != -1) currentFeature = startFeature(currentFeatureIndex);
@@ -165,90 +235,119 @@ void wakeUp() {
 }
 
 /**
- * Initialise feature saved data from the server
+ * Initialise feature saved data from its local copy and from journaled updates
+ * Server saved data is reconciled later by reconcileFeatureData
  */
 void initialiseFeatureData() {
 
-	if(LOG_INFO) Serial.println("Info : [Main] initialiseFeatureData ...");
+	LOG_INFO(Main, "initialiseFeatureData ...");
 
-	if(!smartWifi.waitUntilReconnect()) {
-		screenHelper.showError("Init failed !!", 10000);
-		return;
-	}
-
-	DynamicJsonDocument responseBody(MAX_JSON_DOCUMENT_SIZE * (FeatureFactory::featureFactories.size() + 1));
-	int status = webClient.sendGET("featureData", responseBody);
-	if(status != 200) {
-		char err[15];
-		sprintf(err, "server er:%d", status);
-		screenHelper.showError(err, 10000);
+	// States keep their initial value until saved data is read
+	for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
+		featureFactorySavedDataPair.first->setSavedData(featureFactorySavedDataPair.second);
 	}
 
-	JsonArray featureDataDtos = responseBody.as<JsonArray>();
-
-	for(DynamicJsonDocument featureDataDto : featureDataDtos) {
-
-		for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
-			if(featureFactorySavedDataPair.first->getFeatureFactoryName() == featureDataDto["featureFactoryName"]) {
+	FeatureDataStore::load();
+	Journal::begin(&webClient);
 
-				featureFactorySavedDataPair.first->setFeatureFactoryId(featureDataDto["id"]);
+	LOG_INFO(Main, "initialiseFeatureData Done");
+}
 
-				String s = "\0";
-				if(!featureDataDto["savedData"].isNull()) {
-					serializeJson(featureDataDto["savedData"], s);
-				}
+/**
+ * Requests server feature data once first frame is drawn, response is handled by onFeatureDataResponse
+ */
+void reconcileFeatureData() {
 
-				if(LOG_DEBUG) Serial.printf("Debug : [Main] initialiseFeatureData save second = %s for featureFactoryName = %s\n", s.c_str(), featureFactorySavedDataPair.first->getFeatureFactoryName());
-				featureFactorySavedDataPair.second = s;
-				break;
-			}
-		}
-	}
+	if(!firstFrameDrawn || NetworkTask::isPending(featureDataRequest) || Scheduler::isScheduled(featureDataTimer)) return;
 
-	if(LOG_INFO) Serial.println("Info : [Main] initialiseFeatureData Done");
+	LOG_INFO(Main, "reconcileFeatureData ...");
+	featureDataRequest = webClient.submitGET("featureData", onFeatureDataResponse, NULL);
+	if(featureDataRequest == NetworkTask::NO_REQUEST) featureDataTimer = Scheduler::schedule(FEATURE_DATA_RETRY_DELAY, NULL, NULL);
 }
 
 /**
- * Sends feature saved data to the server
+ * Reconciles local feature data with server feature data
+ * Server saved data replaces local one that did not change since last sync, otherwise local saved data wins and journal sends it
+ * Current feature is restarted when its saved data is replaced
  *
- * @param waitForConnection if true method will call SmartWifi::waitUntilReconnect() method in the begining
+ * @param status       http status
+ * @param responseBody server feature data
+ * @param context      unused
  */
-void saveFeatureDataToServer(boolean waitForConnection) {
+void onFeatureDataResponse(const int status, JsonDocument& responseBody, void* /* context */) {
 
-	if(LOG_INFO) Serial.println("Info : [Main] saveFeatureDataToServer ...");
+	if(status == HttpCache::NOT_MODIFIED) {
+		featureDataReconciled = true;
+		return;
+	}
 
-	if(waitForConnection && !smartWifi.waitUntilReconnect()) {
-		screenHelper.showError("Init failed !!", 10000);
+	if(status != 200) {
+		LOG_INFO(Main, "onFeatureDataResponse status = %d", status);
+		featureDataTimer = Scheduler::schedule(FEATURE_DATA_RETRY_DELAY, NULL, NULL);
 		return;
 	}
 
-	DynamicJsonDocument payload(MAX_JSON_DOCUMENT_SIZE * (FeatureFactory::featureFactories.size() + 1));
-	JsonArray featureDataDtos = payload.to<JsonArray>();
+	JsonArray featureDataDtos = responseBody.as<JsonArray>();
 
-	for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
+	for(JsonObject featureDataDto : featureDataDtos) {
+
+		// feature data is created on server under its factory name, afterwards it is known by id
+		long id = featureDataDto["id"] | -1L;
+		auto featureFactorySavedDataPair = FeatureFactory::featureFactories.find(id);
+		if(featureFactorySavedDataPair == NULL) featureFactorySavedDataPair = FeatureFactory::featureFactories.find(featureDataDto["featureFactoryName"].as<const char*>());
+		if(featureFactorySavedDataPair == NULL) continue;
+
+		FeatureFactory::featureFactories.setFeatureFactoryId(featureFactorySavedDataPair, id);
 
-		DynamicJsonDocument featureDataDto(MAX_JSON_DOCUMENT_SIZE);
+		String s;
+		if(!featureDataDto["savedData"].isNull()) {
+			serializeJson(featureDataDto["savedData"], s);
+		}
+
+		// server did not change since local copy was synced
+		uint32_t serverHash = FeatureFactory::hashSavedData(s);
+		if(serverHash == featureFactorySavedDataPair->first->getSyncedHash()) {
+			FeatureDataStore::store(featureFactorySavedDataPair->first);
+			continue;
+		}
 
-		if(featureFactorySavedDataPair.first->getFeatureFactoryId() != -1) featureDataDto["id"] = featureFactorySavedDataPair.first->getFeatureFactoryId();
-		featureDataDto["featureFactoryName"] = featureFactorySavedDataPair.first->getFeatureFactoryName();
+		// running feature hands its state over before it is compared
+		bool running = !sleeping && currentFeature != NULL && FeatureFactory::featureFactories.indexOf(featureFactorySavedDataPair) == currentFeatureIndex;
+		if(running) killCurrentFeature();
 
-		DynamicJsonDocument savedData(MAX_JSON_DOCUMENT_SIZE);
-		deserializeJson(savedData, featureFactorySavedDataPair.second);
-		featureDataDto["savedData"] = savedData;
+		if(featureFactorySavedDataPair->first->isDirty()) {
+			LOG_INFO(Main, "onFeatureDataResponse %s conflict keeps local saved data", featureFactorySavedDataPair->first->getFeatureFactoryName());
+			featureFactorySavedDataPair->first->markSynced(serverHash);
+			Journal::record(featureFactorySavedDataPair->first, featureFactorySavedDataPair->second);
+		}
+		else {
+			LOG_DEBUG(Main, "onFeatureDataResponse save second = %s for featureFactoryName = %s", s.c_str(), featureFactorySavedDataPair->first->getFeatureFactoryName());
+			featureFactorySavedDataPair->second = s;
+			featureFactorySavedDataPair->first->setSavedData(s);
+			featureFactorySavedDataPair->first->markSynced();
+		}
+		FeatureDataStore::store(featureFactorySavedDataPair->first);
 
-		featureDataDtos.add(featureDataDto);
+		if(running) currentFeature = startFeature(currentFeatureIndex);
 	}
 
-	DynamicJsonDocument responseBody(MAX_JSON_DOCUMENT_SIZE * (FeatureFactory::featureFactories.size() + 1));
-	int status = webClient.sendPUT("featureData", payload, responseBody);
-	if(status != 202) {
-		char err[15];
-		sprintf(err, "server er:%d", status);
-		screenHelper.showError(err, 10000);
-		screenHelper.loop();
+	featureDataReconciled = true;
+	LOG_INFO(Main, "reconcileFeatureData Done pending = %d", Journal::getPendingCount());
+}
+
+/**
+ * Journals feature saved data that changed since it was last stored to the server
+ * Never waits for the network, journal sends it once wifi is connected
+ */
+void saveFeatureData() {
+
+	LOG_INFO(Main, "saveFeatureData ...");
+
+	for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
+		Journal::record(featureFactorySavedDataPair.first, featureFactorySavedDataPair.second);
 	}
 
-	if(LOG_INFO) Serial.println("Info : [Main] saveFeatureDataToServer Done");
+	LOG_INFO(Main, "saveFeatureData Done pending = %d", Journal::getPendingCount());
 }
 
 /**
@@ -256,54 +355,32 @@ void saveFeatureDataToServer(boolean waitForConnection) {
  */
 void setUpPermanentFeatures() {
 
-	if(LOG_INFO) Serial.println("Info : [Main] setUpPermanentFeatures ...");
+	LOG_INFO(Main, "setUpPermanentFeatures ...");
 
-	for(int i = 0; i < FeatureFactory::featureFactories.size(); i++) {
-		if(FeatureFactory::featureFactories[i].first->isAlwaysLoop()) {
+	for(auto& featureFactorySavedDataPair : FeatureFactory::permanentFactories) {
 
-			Feature* permanentFeature = FeatureFactory::featureFactories[i].first->createFeature();
-			delete FeatureFactory::featureFactories[i].first;
-			i--;
+		Feature* permanentFeature = featureFactorySavedDataPair.first->createFeature();
+		permanentFeature->onStart(&screenHelper, &timeHelper, &ledHelper);
+		permanentFeatures.push_back(permanentFeature);
 
-			permanentFeature->onStart(&screenHelper, &timeHelper, &ledHelper, NULL);
-			permanentFeatures.push_back(permanentFeature);
-
-			if(LOG_DEBUG) Serial.printf("Debug : [Main] setUpPermanentFeatures %s added to permanentFeatures actualSize = %d\n", permanentFeature->getFeatureName(), permanentFeatures.size());
-		}
+		LOG_DEBUG(Main, "setUpPermanentFeatures %s added to permanentFeatures actualSize = %d", permanentFeature->getFeatureName(), (int)permanentFeatures.size());
 	}
 
-	if(LOG_INFO) Serial.println("Info : [Main] setUpPermanentFeatures Done");
+	LOG_INFO(Main, "setUpPermanentFeatures Done");
 }
 
 /**
  * Deletes all alwaysLoop = true fatures
  */
 void shutdownPermanentFeatures() {
-	if(LOG_INFO) Serial.println("Info : [Main] shutdownPermanentFeatures ...");
+	LOG_INFO(Main, "shutdownPermanentFeatures ...");
 
 	for(auto& permanentFeature : permanentFeatures) {
 
-		permanentFeature->onStop(NULL);
+		permanentFeature->onStop();
 		delete permanentFeature;
 	}
-	if(LOG_INFO) Serial.println("Info : [Main] shutdownPermanentFeatures Done");
-}
-
-/**
- * Deletes all feature factories
- */
-void shutdownFeatureFactories() {
-
-	if(LOG_INFO) Serial.println("Info : [Main] shutdownFeatureFactories ...");
-
-	for(int i = 0; i < FeatureFactory::featureFactories.size(); i++) {
-		if(FeatureFactory::featureFactories[i].first != NULL) {
-			delete FeatureFactory::featureFactories[i].first;
-			i--;
-		}
-	}
-
-	if(LOG_INFO) Serial.println("Info : [Main] shutdownFeatureFactories Done");
+	LOG_INFO(Main, "shutdownPermanentFeatures Done");
 }
 
 /**
@@ -311,48 +388,50 @@ void shutdownFeatureFactories() {
  */
 void nextFeature() {
 
-	if(LOG_DEBUG) {
-		Serial.printf("Debug : [Main] nextFeature currentFeatureIndex = %d\n", currentFeatureIndex);
-		Serial.printf("Debug : [Main] nextFeature newFeatureIndex = %d\n", newFeatureIndex);
-		Serial.printf("Debug : [Main] nextFeature featureFactories.size() = %d\n", FeatureFactory::featureFactories.size());
-	}
+	LOG_DEBUG(Main, "nextFeature currentFeatureIndex = %d", currentFeatureIndex);
+	LOG_DEBUG(Main, "nextFeature newFeatureIndex = %d", newFeatureIndex);
+	LOG_DEBUG(Main, "nextFeature featureFactories.size() = %d", (int)FeatureFactory::featureFactories.size());
 
 	newFeatureIndex++;
 	if(newFeatureIndex >= FeatureFactory::featureFactories.size()) {
 		newFeatureIndex = 0;
 	}
 
-	if(LOG_DEBUG) {
-		Serial.printf("Debug : [Main] nextFeature newFeatureIndex = %d\n", newFeatureIndex);
-		Serial.printf("Debug : [Main] nextFeature featureFactories.size() = %d\n", FeatureFactory::featureFactories.size());
-	}
+	LOG_DEBUG(Main, "nextFeature newFeatureIndex = %d", newFeatureIndex);
+	LOG_DEBUG(Main, "nextFeature featureFactories.size() = %d", (int)FeatureFactory::featureFactories.size());
 }
 
 /**
- * Starts new feature from featureFactories
+ * Lets factory of feature that follows current one prefetch its data
+ */
+void prefetchNextFeature() {
+
+	int nextFeatureIndex = currentFeatureIndex + 1 >= (int)FeatureFactory::featureFactories.size() ? 0 : currentFeatureIndex + 1;
+	if(nextFeatureIndex != currentFeatureIndex) FeatureFactory::featureFactories[nextFeatureIndex].first->prefetch();
+}
+
+/**
+ * Starts new feature from featureFactories, resumes it if it is suspended
  *
  * @param featureIndex featureFactories index of feature to start
  * @return started feature
  */
 Feature* startFeature(const int featureIndex) {
 
-	// start new feature
-	Feature* feature = FeatureFactory::featureFactories[featureIndex].first->createFeature();
-
-	// if there is no saved data start feature with null
-	if(FeatureFactory::featureFactories[featureIndex].second == NULL) {
-		if(LOG_DEBUG) Serial.printf("Debug : [Main] startFeature name = %s new second = NULL\n", feature->getFeatureName());
-
-		feature->onStart(&screenHelper, &timeHelper, &ledHelper, NULL);
-	}
-	// Else deserialise json document and start feature with it
-	else {
-		DynamicJsonDocument json(MAX_JSON_DOCUMENT_SIZE);
-		deserializeJson(json, FeatureFactory::featureFactories[featureIndex].second);
-		if(LOG_DEBUG) Serial.printf("Debug : [Main] startFeature name = %s retrieve new second = %s\n", feature->getFeatureName(), FeatureFactory::featureFactories[featureIndex].second.c_str());
-		feature->onStart(&screenHelper, &timeHelper, &ledHelper, &json);
+	// resume suspended feature with its view and caches
+	FeatureFactory* featureFactory = FeatureFactory::featureFactories[featureIndex].first;
+	Feature* feature = FeatureStandby::take(featureFactory);
+	if(feature != NULL) {
+		LOG_DEBUG(Main, "startFeature resume name = %s", feature->getFeatureName());
+		feature->onResume(&screenHelper, &timeHelper, &ledHelper);
+		return feature;
 	}
 
+	// start new feature, its persistent data is already in factory state
+	feature = featureFactory->createFeature();
+	LOG_DEBUG(Main, "startFeature name = %s", feature->getFeatureName());
+	feature->onStart(&screenHelper, &timeHelper, &ledHelper);
+
 	return feature;
 }
 
@@ -361,22 +440,73 @@ Feature* startFeature(const int featureIndex) {
  */
 void killCurrentFeature() {
 
-	// Deserialise saved data into json document
-	DynamicJsonDocument json(MAX_JSON_DOCUMENT_SIZE);
-	deserializeJson(json, FeatureFactory::featureFactories[currentFeatureIndex].second);
-	if(LOG_DEBUG) Serial.printf("Debug : [Main] killCurrentFeature retrieve second = %s\n", FeatureFactory::featureFactories[currentFeatureIndex].second.c_str());
+	stopFeature(FeatureFactory::featureFactories[currentFeatureIndex], currentFeature);
+	currentFeature = NULL;
+}
+
+/**
+ * Suspends current feature if it can be suspended and kills it otherwise
+ * Least recently suspended feature is stopped when standby is full
+ */
+void suspendCurrentFeature() {
+
+	if(!currentFeature->canSuspend()) {
+		killCurrentFeature();
+		return;
+	}
+
+	FeatureStandby::Entry evicted;
+	if(FeatureStandby::isFull() && FeatureStandby::evict(evicted)) {
+		stopFeature(*FeatureFactory::featureFactories.find(evicted.factory), evicted.feature);
+	}
+
+	// suspended feature keeps its view but its state is saved as if it was stopped
+	auto& featureFactorySavedDataPair = FeatureFactory::featureFactories[currentFeatureIndex];
+	currentFeature->onSuspend();
+	updateFeatureSavedData(featureFactorySavedDataPair);
+	FeatureStandby::suspend(featureFactorySavedDataPair.first, currentFeature);
+	currentFeature = NULL;
+}
+
+/**
+ * Stops feature, saves state of its factory and deletes it
+ *
+ * @param featureFactorySavedDataPair factory of feature and its saved data
+ * @param feature                     to stop
+ */
+void stopFeature(FeatureRegistry::Entry& featureFactorySavedDataPair, Feature* feature) {
 
 	// Stop feature
-	currentFeature->onStop(&json);
+	feature->onStop();
+	updateFeatureSavedData(featureFactorySavedDataPair);
+
+	// kill feature
+	delete feature;
+}
+
+/**
+ * Stops all suspended features
+ */
+void stopSuspendedFeatures() {
 
-	// Serialize json document into saved data
-	String s;
-	serializeJson(json, s);
-	FeatureFactory::featureFactories[currentFeatureIndex].second = s;
-	if(LOG_DEBUG) Serial.printf("Debug : [Main] killCurrentFeature save second = %s\n", FeatureFactory::featureFactories[currentFeatureIndex].second.c_str());
+	FeatureStandby::Entry evicted;
+	while(FeatureStandby::evict(evicted)) {
+		stopFeature(*FeatureFactory::featureFactories.find(evicted.factory), evicted.feature);
+	}
+}
 
-	// kill current feature
-	delete currentFeature;
+/**
+ * Serializes factory state into saved data if it changed, then journals it, journal writes local copy once
+ *
+ * @param featureFactorySavedDataPair factory and its saved data
+ */
+void updateFeatureSavedData(FeatureRegistry::Entry& featureFactorySavedDataPair) {
+
+	// Saved data is serialized only when factory state changed
+	if(featureFactorySavedDataPair.first->updateSavedData(featureFactorySavedDataPair.second)) {
+		LOG_DEBUG(Main, "updateFeatureSavedData save second = %s", featureFactorySavedDataPair.second.c_str());
+		Journal::record(featureFactorySavedDataPair.first, featureFactorySavedDataPair.second);
+	}
 }
 
 /**
@@ -384,7 +514,7 @@ void killCurrentFeature() {
  */
 void setUpButtons() {
 
-	if(LOG_INFO) Serial.println("Info : [Main] setUpButtons ...");
+	LOG_INFO(Main, "setUpButtons ...");
 
 	homeButton.attachClick(onHomeButtonClick);
 	homeButton.attachDoubleClick(onHomeButtonDoubleClick);
@@ -394,8 +524,8 @@ void setUpButtons() {
 	upButton.attachDoubleClick(onUpButtonDoubleClick);
 	upButton.setDebounceTicks(DEBOUNCE_TICKS);
 
-	if(LOG_DEBUG) Serial.printf("Debug : [Main] setUpButtons DEBOUNCE_TICKS : %d\n", DEBOUNCE_TICKS);
-	if(LOG_INFO) Serial.println("Info : [Main] setUpButtons Done");
+	LOG_DEBUG(Main, "setUpButtons DEBOUNCE_TICKS : %d", DEBOUNCE_TICKS);
+	LOG_INFO(Main, "setUpButtons Done");
 }
 
 /**
@@ -403,25 +533,83 @@ void setUpButtons() {
  */
 void tickButtons() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] tickButtons");
+	LOG_DEBUG(Main, "tickButtons");
+	Hal::Buttons::poll();
 	homeButton.tick();
 	upButton.tick();
 
-	uint8_t event = M5.Axp.GetBtnPress();
-	if(event == 0x01) {
+	Hal::PowerButtonEvent event = Hal::Pmic::getPowerButtonEvent();
+	if(event == Hal::POWER_BUTTON_LONG_CLICK) {
 		onPowerButtonLongClick();
 	}
-	else if(event == 0x02) {
+	else if(event == Hal::POWER_BUTTON_CLICK) {
 		onPowerButtonClick();
 	}
 }
 
+/**
+ * Drains main loop events and blocks until next frame deadline or next event
+ */
+void waitNextFrame() {
+
+	Events::EventType event;
+	while(Events::poll(event)) {
+
+		LOG_DEBUG(Main, "waitNextFrame event = %d", event);
+		if(event == Events::EVENT_BUTTON || event == Events::EVENT_POWER_BUTTON) {
+			Scheduler::cancel(inputTimer);
+			inputTimer = Scheduler::schedule(INPUT_BURST_TIME, NULL, NULL);
+		}
+	}
+
+	framePacer.setFrameRate(getFrameRate());
+	framePacer.waitNextFrame(sleeping);
+}
+
+/**
+ * Gets frame rate main loop should run at
+ * Highest rate wanted by looped features, during input bursts at least INPUT_FPS
+ *
+ * @return frame rate
+ */
+const double getFrameRate() {
+
+	if(sleeping) return SLEEP_FPS;
+
+	bool input = Scheduler::isScheduled(inputTimer);
+	double frameRate = input ? INPUT_FPS : 0;
+
+	// Feature switch is pending
+	if(FeatureFactory::featureFactories.size() != 0 && newFeatureIndex != currentFeatureIndex) return framePacer.getMaxFps();
+
+	for(auto& feature : permanentFeatures) {
+		frameRate = max(frameRate, getFeatureFrameRate(feature, input));
+	}
+	if(currentFeature != NULL) frameRate = max(frameRate, getFeatureFrameRate(currentFeature, input));
+
+	return frameRate;
+}
+
+/**
+ * Gets frame rate wanted by feature
+ *
+ * @param feature to get frame rate for
+ * @param input   true during input bursts
+ * @return MAX_FPS during input bursts if feature asks for it, target fps if feature needs frames, min fps otherwise
+ */
+const double getFeatureFrameRate(const Feature* feature, const bool input) {
+
+	if(input && feature->burstOnInput()) return framePacer.getMaxFps();
+	if(input || feature->needsFrame()) return feature->getTargetFps();
+	return feature->getMinFps();
+}
+
 /**
  * Called on home button click
  */
 void onHomeButtonClick() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] onHomeClick general");
+	LOG_DEBUG(Main, "onHomeClick general");
 	if(sleeping) return;
 	timeHelper.keepWokedUp();
 	if(currentFeature != NULL) currentFeature->onHomeClick();
@@ -432,7 +620,7 @@ void onHomeButtonClick() {
  */
 void onHomeButtonDoubleClick() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] onHomeDoubleClick general");
+	LOG_DEBUG(Main, "onHomeDoubleClick general");
 	if(sleeping) return;
 	timeHelper.keepWokedUp();
 	if(currentFeature != NULL) currentFeature->onHomeDoubleClick();
@@ -443,7 +631,7 @@ void onHomeButtonDoubleClick() {
  */
 void onUpButtonClick() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] onUpButtonClick general");
+	LOG_DEBUG(Main, "onUpButtonClick general");
 	if(sleeping) return;
 	timeHelper.keepWokedUp();
 	nextFeature();
@@ -454,7 +642,7 @@ void onUpButtonClick() {
  */
 void onUpButtonDoubleClick() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] onUpButtonDoubleClick general");
+	LOG_DEBUG(Main, "onUpButtonDoubleClick general");
 	if(sleeping) return;
 	timeHelper.keepWokedUp();
 	screenHelper.changeBrightness();
@@ -465,7 +653,7 @@ void onUpButtonDoubleClick() {
  */
 void onPowerButtonClick() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] onPowerButtonClick general");
+	LOG_DEBUG(Main, "onPowerButtonClick general");
 
 	if(sleeping) {
 		wakeUp();
@@ -480,7 +668,7 @@ void onPowerButtonClick() {
  */
 void onPowerButtonLongClick() {
 
-	if(LOG_DEBUG) Serial.println("Debug : [Main] onPowerButtonLongClick general");
+	LOG_DEBUG(Main, "onPowerButtonLongClick general");
 	if(sleeping) return;
 	timeHelper.keepWokedUp();
 	shutdown();
@@ -0,0 +1,73 @@
+/**
+ * AssetReader class implementation
+ * @author error23
+ */
+#include "core/Asset.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Initialise reader at the first row of asset
+		 *
+		 * @param asset to decode
+		 */
+		AssetReader::AssetReader(const Asset& asset)
+			: asset(asset)
+			, offset(0)
+			, row(0) {
+		}
+
+		/**
+		 * Decodes next row
+		 *
+		 * @param line buffer of asset width pixels to decode into
+		 * @return false if every row has already been decoded
+		 */
+		bool AssetReader::readLine(uint16_t* line) {
+
+			if(row >= asset.height) return false;
+
+			uint16_t x = 0;
+			while(x < asset.width) {
+
+				uint8_t control = pgm_read_byte(asset.data + offset++);
+				uint8_t count = (control & 0x7F) + 1;
+
+				// Repeated value
+				if(control & 0x80) {
+					uint16_t color = readColor();
+					for(uint8_t i = 0; i < count && x < asset.width; i++) {
+						line[x++] = color;
+					}
+				}
+				// Literal values
+				else {
+					for(uint8_t i = 0; i < count && x < asset.width; i++) {
+						line[x++] = readColor();
+					}
+				}
+			}
+
+			row++;
+			return true;
+		}
+
+		/**
+		 * Reads next color from asset data
+		 *
+		 * @return RGB565 color
+		 */
+		uint16_t AssetReader::readColor() {
+
+			if(asset.format == ASSET_FORMAT_PALETTE) {
+				return pgm_read_word(asset.palette + pgm_read_byte(asset.data + offset++));
+			}
+
+			uint16_t color = pgm_read_byte(asset.data + offset) | (pgm_read_byte(asset.data + offset + 1) << 8);
+			offset += 2;
+			return color;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,115 @@
+/**
+ * Events class implementation
+ * @author error23
+ */
+#include "core/Events.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		Events::EventType Events::queue[Events::QUEUE_SIZE];
+		uint8_t Events::head = 0;
+		uint8_t Events::tail = 0;
+		uint32_t Events::droppedCount = 0;
+
+		/**
+		 * Arms hardware wake sources, must be called from the main loop task
+		 */
+		void Events::begin() {
+
+			LOG_INFO(Events, "begin");
+			Hal::Idle::begin(onWake);
+		}
+
+		/**
+		 * Posts event and wakes main loop, callable from interrupts and other tasks
+		 *
+		 * @param type of posted event
+		 */
+		void IRAM_ATTR Events::post(const EventType type) {
+
+			push(type);
+			Hal::Idle::wake();
+		}
+
+		/**
+		 * Gets and removes oldest event
+		 *
+		 * @param type of polled event
+		 * @return false if queue is empty
+		 */
+		bool Events::poll(EventType& type) {
+
+			Hal::Idle::lock();
+			bool polled = head != tail;
+			if(polled) {
+				type = queue[tail & (QUEUE_SIZE - 1)];
+				tail++;
+			}
+			Hal::Idle::unlock();
+
+			return polled;
+		}
+
+		/**
+		 * Blocks until an event is posted, next timer deadline or timeout, returns at once if an event is queued
+		 * EVENT_TIMER is posted when a timer deadline ends the wait
+		 *
+		 * @param timeout    maximum time to block in ms
+		 * @param lightSleep if true device light sleeps, only allowed while wifi is off
+		 */
+		void Events::wait(const uint32_t timeout, const bool lightSleep) {
+
+			Hal::Idle::lock();
+			bool pending = head != tail;
+			Hal::Idle::unlock();
+			if(pending) return;
+
+			uint32_t deadline = Scheduler::getTimeUntilNextDeadline();
+			if(deadline == 0) {
+				push(EVENT_TIMER);
+				return;
+			}
+
+			LOG_DEBUG(Events, "wait timeout = %u ms, deadline = %u ms, lightSleep = %d", (unsigned int)timeout, (unsigned int)deadline, lightSleep);
+			if(!Hal::Idle::wait(min(timeout, deadline), lightSleep) && deadline <= timeout) push(EVENT_TIMER);
+		}
+
+		/**
+		 * Gets number of events dropped because queue was full
+		 *
+		 * @return dropped events count
+		 */
+		uint32_t Events::getDroppedCount() {
+			return droppedCount;
+		}
+
+		/**
+		 * Queues event without waking main loop
+		 *
+		 * @param type of queued event
+		 */
+		void IRAM_ATTR Events::push(const EventType type) {
+
+			Hal::Idle::lock();
+			if((uint8_t)(head - tail) < QUEUE_SIZE) {
+				queue[head & (QUEUE_SIZE - 1)] = type;
+				head++;
+			}
+			else {
+				droppedCount++;
+			}
+			Hal::Idle::unlock();
+		}
+
+		/**
+		 * Posts wake source as event, called from interrupt context on device
+		 *
+		 * @param source that fired
+		 */
+		void IRAM_ATTR Events::onWake(const Hal::WakeSource source) {
+			post(source == Hal::WAKE_POWER_BUTTON ? EVENT_POWER_BUTTON : EVENT_BUTTON);
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -15,7 +15,7 @@ namespace CrowOs {
 		Feature::Feature(const char* featureName)
 			: featureName(featureName) {
 
-			if(LOG_INFO) Serial.printf("Info : [Feature] %s created\n", featureName);
+			LOG_INFO(Feature, "%s created", featureName);
 		}
 
 		/**
@@ -23,7 +23,79 @@ namespace CrowOs {
 		 */
 		Feature::~Feature() {
 
-			if(LOG_INFO) Serial.printf("Info : [Feature] %s deleted\n", featureName);
+			LOG_INFO(Feature, "%s deleted", featureName);
+		}
+
+		/**
+		 * Indicates if feature can be suspended instead of being destroyed when state changes from this feature to another
+		 * Default implementation returns false
+		 *
+		 * @return true if feature implements onSuspend and onResume
+		 */
+		const bool Feature::canSuspend() const {
+			return false;
+		}
+
+		/**
+		 * Called after loop instead of onStop when state changes from this feature to another and feature can be suspended
+		 * You should release what must not run in background here, such as pending requests, and keep what your view needs to be shown again
+		 * A suspended feature may be stopped with onStop and destroyed without being resumed
+		 * Default implementation does nothing
+		 */
+		void Feature::onSuspend() {
+		}
+
+		/**
+		 * Called instead of onStart when state changes back to this suspended feature
+		 * You should show your view again from kept variables here, persistent ones are read from state given by the feature factory
+		 * Default implementation does nothing
+		 *
+		 * @param screenHelper Screen helper used to manage screen
+		 * @param timeHelper   Time helper used to manage upTime and sleepTime
+		 * @param ledHelper    Led helper used to manage Led state
+		 */
+		void Feature::onResume(Screen* /* screenHelper */, Time* /* timeHelper */, Led* /* ledHelper */) {
+		}
+
+		/**
+		 * Indicates if feature has something to draw at next frame
+		 * When no feature needs a frame main loop blocks until next button, timer or network event
+		 * Default implementation always returns true
+		 *
+		 * @return true if loop should be called again as soon as possible
+		 */
+		const bool Feature::needsFrame() const {
+			return true;
+		}
+
+		/**
+		 * Gets frame rate wanted while feature needs frames
+		 * Default implementation returns DEFAULT_TARGET_FPS
+		 *
+		 * @return target fps
+		 */
+		const double Feature::getTargetFps() const {
+			return DEFAULT_TARGET_FPS;
+		}
+
+		/**
+		 * Gets frame rate feature is looped at while it does not need frames
+		 * Default implementation returns DEFAULT_MIN_FPS
+		 *
+		 * @return minimum fps
+		 */
+		const double Feature::getMinFps() const {
+			return DEFAULT_MIN_FPS;
+		}
+
+		/**
+		 * Indicates if main loop should run at MAX_FPS during input bursts instead of target fps
+		 * Default implementation returns false
+		 *
+		 * @return true if feature wants a frame rate burst on input
+		 */
+		const bool Feature::burstOnInput() const {
+			return false;
 		}
 
 		/**
@@ -0,0 +1,118 @@
+/**
+ * FeatureDataStore class implementation
+ * @author error23
+ */
+#include "core/FeatureDataStore.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		FeatureDataStore::Entry FeatureDataStore::entries[FeatureDataStore::MAX_ENTRIES];
+		uint8_t FeatureDataStore::entryCount = 0;
+
+		/**
+		 * Loads local copy into saved data, id and synced hash of feature factories
+		 * Must be called after feature factories were initialised
+		 *
+		 * @return number of restored factories
+		 */
+		uint8_t FeatureDataStore::load() {
+
+			uint8_t restoredCount = 0;
+			entryCount = 0;
+
+			for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
+
+				char key[SavedDataRecord::KEY_SIZE + 1];
+				getKey(featureFactorySavedDataPair.first, key);
+
+				uint32_t version;
+				int32_t id;
+				if(!SavedDataRecord::read(key, version, id, featureFactorySavedDataPair.second)) continue;
+
+				featureFactorySavedDataPair.first->setSavedData(featureFactorySavedDataPair.second);
+				featureFactorySavedDataPair.first->markSynced(version);
+				FeatureFactory::featureFactories.setFeatureFactoryId(&featureFactorySavedDataPair, id);
+
+				Entry* entry = findEntry(featureFactorySavedDataPair.first);
+				if(entry != NULL) {
+					entry->savedDataHash = featureFactorySavedDataPair.first->getSavedDataHash();
+					entry->version = version;
+					entry->id = id;
+				}
+				restoredCount++;
+
+				LOG_DEBUG(FeatureDataStore, "load %s version = %08x, dirty = %d, savedData = %s", featureFactorySavedDataPair.first->getFeatureFactoryName(), (unsigned int)version, featureFactorySavedDataPair.first->isDirty(), featureFactorySavedDataPair.second.c_str());
+			}
+
+			LOG_INFO(FeatureDataStore, "load restored = %d", restoredCount);
+			return restoredCount;
+		}
+
+		/**
+		 * Writes actual saved data of factory if it changed since it was last stored
+		 *
+		 * @param factory feature factory
+		 */
+		void FeatureDataStore::store(FeatureFactory* factory) {
+
+			Entry* entry = findEntry(factory);
+			if(entry == NULL) return;
+			if(entry->savedDataHash == factory->getSavedDataHash() && entry->version == factory->getSyncedHash() && entry->id == factory->getFeatureFactoryId()) return;
+
+			auto featureFactorySavedDataPair = FeatureFactory::featureFactories.find(factory);
+			if(featureFactorySavedDataPair == NULL) return;
+			const String& savedData = featureFactorySavedDataPair->second;
+
+			char key[SavedDataRecord::KEY_SIZE + 1];
+			getKey(factory, key);
+			if(!SavedDataRecord::write(key, factory->getSyncedHash(), factory->getFeatureFactoryId(), savedData)) {
+				LOG_INFO(FeatureDataStore, "store %s write failed", factory->getFeatureFactoryName());
+				return;
+			}
+
+			entry->savedDataHash = factory->getSavedDataHash();
+			entry->version = factory->getSyncedHash();
+			entry->id = factory->getFeatureFactoryId();
+
+			LOG_DEBUG(FeatureDataStore, "store %s version = %08x, length = %d", factory->getFeatureFactoryName(), (unsigned int)entry->version, (int)savedData.length());
+		}
+
+		/**
+		 * Builds storage key of factory
+		 *
+		 * @param factory stored factory
+		 * @param key     filled with SavedDataRecord::KEY_SIZE characters and terminating zero
+		 */
+		void FeatureDataStore::getKey(const FeatureFactory* factory, char* key) {
+			SavedDataRecord::getKey(KEY_PREFIX, factory, key);
+		}
+
+		/**
+		 * Finds entry of factory and creates it if needed
+		 *
+		 * @param factory stored factory
+		 * @return entry or NULL if store is full
+		 */
+		FeatureDataStore::Entry* FeatureDataStore::findEntry(FeatureFactory* factory) {
+
+			for(uint8_t i = 0; i < entryCount; i++) {
+				if(entries[i].factory == factory) return &entries[i];
+			}
+
+			if(entryCount == MAX_ENTRIES) {
+				LOG_INFO(FeatureDataStore, "findEntry %s store is full", factory->getFeatureFactoryName());
+				return NULL;
+			}
+
+			// nothing is stored yet, any state differs from it
+			Entry& entry = entries[entryCount++];
+			entry.factory = factory;
+			entry.savedDataHash = 0;
+			entry.version = 0;
+			entry.id = -2;
+			return &entry;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
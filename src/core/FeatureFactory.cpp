@@ -7,11 +7,13 @@
 namespace CrowOs {
 	namespace Core {
 
-		// Initialise static featureFactories
-		std::vector<std::pair<FeatureFactory*, String>> FeatureFactory::featureFactories;
+		// Initialise static registries from descriptor tables
+		FeatureRegistry FeatureFactory::featureFactories(FEATURE_DESCRIPTORS, FEATURE_DESCRIPTORS_SIZE);
+		FeatureRegistry FeatureFactory::permanentFactories(PERMANENT_FEATURE_DESCRIPTORS, PERMANENT_FEATURE_DESCRIPTORS_SIZE);
 
 		/**
 		 * Initialise Feature factory
+		 * Factories are static objects, they are known to the os once described in a descriptor table
 		 *
 		 * @param featureFactoryName indicates name of this feature factory
 		 * @param alwaysLoop         indicates if feature made by this factory should be always in a main loop default false
@@ -19,45 +21,26 @@ namespace CrowOs {
 		FeatureFactory::FeatureFactory(const char* featureFactoryName, const bool alwaysLoop /* = false */)
 			: m_id(-1)
 			, featureFactoryName(featureFactoryName)
-			, alwaysLoop(alwaysLoop) {
-
-			if(LOG_INFO) Serial.printf("Info : [FeatureFactory] %s created with alwaysLoop = %d\n", featureFactoryName, alwaysLoop);
-			featureFactories.push_back({this, "\0"});
-			if(LOG_DEBUG) Serial.printf("Debug : [FeatureFactory] %s added to featureFactories actualSize = %d\n", featureFactoryName, featureFactories.size());
+			, nameHash(FeatureRegistry::hashName(featureFactoryName))
+			, alwaysLoop(alwaysLoop)
+			, savedDataHash(hashSavedData(""))
+			, syncedHash(savedDataHash)
+			, stateHash(0) {
 		}
 
 		/**
 		 * Default destructor
 		 */
 		FeatureFactory::~FeatureFactory() {
-
-			featureFactories.erase(std::remove_if(featureFactories.begin(),
-												  featureFactories.end(),
-												  [this](std::pair<FeatureFactory*, String> pair) {
-													  if(hasSameName(pair.first)) {
-
-														  if(LOG_DEBUG) Serial.printf("Debug : [FeatureFactory] %s removed from featureFactories", featureFactoryName);
-														  return true;
-													  }
-													  else {
-														  return false;
-													  }
-												  }),
-								   featureFactories.end());
-
-			if(LOG_DEBUG) Serial.printf(" actualSize = %d\n", featureFactories.size());
-			if(LOG_INFO) Serial.printf("Info : [FeatureFactory] %s deleted\n", featureFactoryName);
 		}
 
 		/**
-		 * Verifies if given featureFactory has same name as this one
-		 *
-		 * @param  featureFactory to verify
-		 * @return true if featureFactory.name is same
+		 * Warms data of next feature made by this factory in background, called on main loop while the feature shown before it runs and wifi is connected
+		 * Must never wait, submit requests to NetworkTask and keep their results in factory so that feature shows them on its first frame
+		 * Called on every frame, implementation has to hold off its own requests
+		 * Default implementation does nothing
 		 */
-		const bool FeatureFactory::hasSameName(const FeatureFactory* featureFactory) const {
-
-			return strcmp(featureFactoryName, featureFactory->featureFactoryName) == 0;
+		void FeatureFactory::prefetch() {
 		}
 
 		/**
@@ -71,6 +54,7 @@ namespace CrowOs {
 
 		/**
 		 * Sets feature factory id in database
+		 * Use FeatureRegistry::setFeatureFactoryId so that factory is found by its id
 		 *
 		 * @param id to be set
 		 */
@@ -87,6 +71,15 @@ namespace CrowOs {
 			return featureFactoryName;
 		}
 
+		/**
+		 * Gets hash of feature factory name
+		 *
+		 * @return FeatureRegistry::hashName of featureFactoryName
+		 */
+		const uint32_t FeatureFactory::getNameHash() const {
+			return nameHash;
+		}
+
 		/**
 		 * Indicates if feature made by this factory should be always in a main loop
 		 *
@@ -96,5 +89,158 @@ namespace CrowOs {
 			return alwaysLoop;
 		}
 
+		/**
+		 * Gets state kept in memory between activations of features made by this factory
+		 * Features read and write it directly, it is converted to json only when saved data is read or written
+		 * Default implementation returns NULL, use StatefulFeatureFactory to give features a typed state
+		 *
+		 * @return pointer to plain old data state or NULL if features have no state
+		 */
+		const void* FeatureFactory::getState() const {
+			return NULL;
+		}
+
+		/**
+		 * Gets size of state
+		 * Default implementation returns 0
+		 *
+		 * @return state size in bytes
+		 */
+		const size_t FeatureFactory::getStateSize() const {
+			return 0;
+		}
+
+		/**
+		 * Restores state from saved data, missing fields should keep their actual value
+		 * May lease up to JSON_STATE_LEASES JsonPool documents
+		 * Default implementation does nothing
+		 *
+		 * @param savedData parsed saved data
+		 */
+		void FeatureFactory::readState(const JsonDocument& /* savedData */) {
+		}
+
+		/**
+		 * Writes state into saved data
+		 * May lease up to JSON_STATE_LEASES JsonPool documents
+		 * Default implementation does nothing
+		 *
+		 * @param savedData to fill
+		 */
+		void FeatureFactory::writeState(JsonDocument& /* savedData */) const {
+		}
+
+		/**
+		 * Updates content hash of saved data and restores state from it, must be called each time saved data of this factory is replaced
+		 *
+		 * @param savedData new saved data
+		 */
+		void FeatureFactory::setSavedData(const String& savedData) {
+
+			savedDataHash = hashSavedData(savedData);
+
+			// server sync boundary, the only place where saved data is parsed
+			if(getState() != NULL && savedData.length() > 0) {
+				JsonPool::Lease json;
+				DeserializationError error = json.isValid() ? deserializeJson(*json, savedData) : DeserializationError::NoMemory;
+				if(error) LOG_INFO(FeatureFactory, "%s setSavedData error = %s", featureFactoryName, error.c_str());
+				else readState(*json);
+			}
+			stateHash = hashState();
+
+			LOG_DEBUG(FeatureFactory, "%s setSavedData savedDataHash = %u, dirty = %d", featureFactoryName, (unsigned int)savedDataHash, isDirty());
+		}
+
+		/**
+		 * Serializes state into saved data if it changed since saved data was last written or read
+		 *
+		 * @param savedData saved data of this factory, rewritten only if state changed
+		 * @return true if saved data was rewritten
+		 */
+		const bool FeatureFactory::updateSavedData(String& savedData) {
+
+			uint32_t hash = hashState();
+			if(hash == stateHash) return false;
+
+			// state stays changed and is serialized on next call
+			JsonPool::Lease json;
+			if(!json.isValid()) return false;
+
+			writeState(*json);
+			savedData = "";
+			serializeJson(*json, savedData);
+
+			savedDataHash = hashSavedData(savedData);
+			stateHash = hash;
+
+			LOG_DEBUG(FeatureFactory, "%s updateSavedData savedDataHash = %u, dirty = %d", featureFactoryName, (unsigned int)savedDataHash, isDirty());
+			return true;
+		}
+
+		/**
+		 * Indicates if saved data changed since it was last stored on server
+		 *
+		 * @return true if saved data has to be sent to server
+		 */
+		const bool FeatureFactory::isDirty() const {
+			return savedDataHash != syncedHash;
+		}
+
+		/**
+		 * Marks actual saved data as stored on server
+		 */
+		void FeatureFactory::markSynced() {
+			syncedHash = savedDataHash;
+		}
+
+		/**
+		 * Marks saved data of given content hash as stored on server
+		 * Saved data written after it was sent stays dirty
+		 *
+		 * @param hash content hash of stored saved data
+		 */
+		void FeatureFactory::markSynced(const uint32_t hash) {
+			syncedHash = hash;
+		}
+
+		/**
+		 * Gets content hash of actual saved data
+		 *
+		 * @return content hash
+		 */
+		const uint32_t FeatureFactory::getSavedDataHash() const {
+			return savedDataHash;
+		}
+
+		/**
+		 * Gets content hash of saved data last stored on server
+		 *
+		 * @return content hash
+		 */
+		const uint32_t FeatureFactory::getSyncedHash() const {
+			return syncedHash;
+		}
+
+		/**
+		 * Hashes state bytes with FNV-1a
+		 *
+		 * @return content hash of state, same for every factory without state
+		 */
+		const uint32_t FeatureFactory::hashState() const {
+
+			return Hash::fnv1a(getState(), getStateSize());
+		}
+
+		/**
+		 * Hashes saved data with FNV-1a
+		 *
+		 * @param savedData to hash
+		 * @return content hash
+		 */
+		uint32_t FeatureFactory::hashSavedData(const String& savedData) {
+
+			return Hash::fnv1a(savedData.c_str(), savedData.length());
+		}
+
 	} // namespace Core
 } // namespace CrowOs
@@ -0,0 +1,190 @@
+/**
+ * FeatureRegistry class implementation
+ * @author error23
+ */
+#include "core/FeatureRegistry.hpp"
+
+// local Includes
+#include "core/FeatureFactory.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Builds registry from descriptor table
+		 * Only descriptors are read, factories may not be constructed yet
+		 *
+		 * @param descriptors     static descriptor table
+		 * @param descriptorCount number of descriptors, at most MAX_FACTORIES are registered
+		 */
+		FeatureRegistry::FeatureRegistry(const FeatureDescriptor* descriptors, const size_t descriptorCount)
+			: descriptors(descriptors)
+			, entryCount(descriptorCount < MAX_FACTORIES ? descriptorCount : MAX_FACTORIES) {
+
+			memset(nameIndex, NO_ENTRY, sizeof nameIndex);
+			memset(idIndex, NO_ENTRY, sizeof idIndex);
+
+			for(uint8_t i = 0; i < entryCount; i++) {
+				entries[i].first = descriptors[i].factory;
+
+				// a duplicated name stays reachable by index only
+				uint8_t slot = findNameSlot(descriptors[i].nameHash, descriptors[i].name);
+				if(nameIndex[slot] == NO_ENTRY) nameIndex[slot] = i;
+			}
+		}
+
+		/**
+		 * Finds entry by factory name
+		 *
+		 * @param name factory name
+		 * @return entry or NULL if name is not registered
+		 */
+		FeatureRegistry::Entry* FeatureRegistry::find(const char* name) {
+
+			if(name == NULL) return NULL;
+
+			uint8_t slot = findNameSlot(hashName(name), name);
+			return nameIndex[slot] != NO_ENTRY ? &entries[nameIndex[slot]] : NULL;
+		}
+
+		/**
+		 * Finds entry by feature factory id in database
+		 *
+		 * @param id feature factory id
+		 * @return entry or NULL if no registered factory has this id
+		 */
+		FeatureRegistry::Entry* FeatureRegistry::find(const long id) {
+
+			if(id == -1) return NULL;
+
+			uint8_t slot = findIdSlot(id);
+			return idIndex[slot] != NO_ENTRY ? &entries[idIndex[slot]] : NULL;
+		}
+
+		/**
+		 * Finds entry of factory
+		 *
+		 * @param factory registered factory
+		 * @return entry or NULL if factory is not registered
+		 */
+		FeatureRegistry::Entry* FeatureRegistry::find(const FeatureFactory* factory) {
+
+			Entry* entry = find(factory->getFeatureFactoryName());
+			return entry != NULL && entry->first == factory ? entry : NULL;
+		}
+
+		/**
+		 * Sets feature factory id in database and indexes it
+		 *
+		 * @param entry entry of this registry
+		 * @param id    to be set
+		 */
+		void FeatureRegistry::setFeatureFactoryId(Entry* entry, const long id) {
+
+			if(entry->first->getFeatureFactoryId() == id) return;
+
+			// ids almost never change, rebuilding index keeps probe sequences intact without tombstones
+			entry->first->setFeatureFactoryId(id);
+			indexIds();
+
+			LOG_DEBUG(FeatureRegistry, "setFeatureFactoryId %s id = %ld", entry->first->getFeatureFactoryName(), id);
+		}
+
+		/**
+		 * Gets index of entry
+		 *
+		 * @param entry entry of this registry
+		 * @return entry index
+		 */
+		const int FeatureRegistry::indexOf(const Entry* entry) const {
+			return entry - entries;
+		}
+
+		/**
+		 * Gets number of registered factories
+		 *
+		 * @return registered factories count
+		 */
+		const size_t FeatureRegistry::size() const {
+			return entryCount;
+		}
+
+		/**
+		 * Gets entry by index
+		 *
+		 * @param index entry index, must be lower than size
+		 * @return entry
+		 */
+		FeatureRegistry::Entry& FeatureRegistry::operator[](const size_t index) {
+			return entries[index];
+		}
+
+		/**
+		 * Gets first entry
+		 *
+		 * @return first entry
+		 */
+		FeatureRegistry::Entry* FeatureRegistry::begin() {
+			return entries;
+		}
+
+		/**
+		 * Gets end of entries
+		 *
+		 * @return entry after the last one
+		 */
+		FeatureRegistry::Entry* FeatureRegistry::end() {
+			return entries + entryCount;
+		}
+
+		/**
+		 * Finds name index slot of hash
+		 *
+		 * @param nameHash factory name hash
+		 * @param name     factory name compared on hash collisions
+		 * @return slot holding name or first empty slot of its probe sequence
+		 */
+		uint8_t FeatureRegistry::findNameSlot(const uint32_t nameHash, const char* name) const {
+
+			// index is never full so probing always ends on the name or an empty slot
+			uint8_t slot = nameHash & (INDEX_SIZE - 1);
+			while(nameIndex[slot] != NO_ENTRY) {
+				const FeatureDescriptor& descriptor = descriptors[nameIndex[slot]];
+				if(descriptor.nameHash == nameHash && strcmp(descriptor.name, name) == 0) break;
+				slot = (slot + 1) & (INDEX_SIZE - 1);
+			}
+			return slot;
+		}
+
+		/**
+		 * Finds id index slot of database id
+		 *
+		 * @param id feature factory id in database
+		 * @return slot holding id or first empty slot of its probe sequence
+		 */
+		uint8_t FeatureRegistry::findIdSlot(const long id) const {
+
+			uint8_t slot = (((uint32_t)id * 2654435761u) >> 24) & (INDEX_SIZE - 1);
+			while(idIndex[slot] != NO_ENTRY && entries[idIndex[slot]].first->getFeatureFactoryId() != id) {
+				slot = (slot + 1) & (INDEX_SIZE - 1);
+			}
+			return slot;
+		}
+
+		/**
+		 * Rebuilds id index from ids of registered factories
+		 */
+		void FeatureRegistry::indexIds() {
+
+			memset(idIndex, NO_ENTRY, sizeof idIndex);
+			for(uint8_t i = 0; i < entryCount; i++) {
+				long id = entries[i].first->getFeatureFactoryId();
+				if(id == -1) continue;
+
+				uint8_t slot = findIdSlot(id);
+				if(idIndex[slot] == NO_ENTRY) idIndex[slot] = i;
+			}
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,99 @@
+/**
+ * FeatureStandby class implementation
+ * @author error23
+ */
+#include "core/FeatureStandby.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		FeatureStandby::Entry FeatureStandby::entries[FeatureStandby::MAX_SUSPENDED];
+		uint8_t FeatureStandby::entryCount = 0;
+
+		/**
+		 * Keeps suspended feature as most recently suspended one
+		 * Standby must not be full
+		 *
+		 * @param factory that made feature
+		 * @param feature suspended feature
+		 */
+		void FeatureStandby::suspend(FeatureFactory* factory, Feature* feature) {
+
+			if(isFull()) return;
+
+			entries[entryCount].factory = factory;
+			entries[entryCount].feature = feature;
+			entryCount++;
+
+			LOG_DEBUG(FeatureStandby, "suspend %s suspendedCount = %d", feature->getFeatureName(), (int)entryCount);
+		}
+
+		/**
+		 * Takes suspended feature of factory out of standby
+		 *
+		 * @param factory feature factory
+		 * @return suspended feature or NULL if none of factory features is suspended
+		 */
+		Feature* FeatureStandby::take(const FeatureFactory* factory) {
+
+			for(uint8_t i = 0; i < entryCount; i++) {
+				if(entries[i].factory == factory) {
+					Feature* feature = entries[i].feature;
+					removeEntry(i);
+					LOG_DEBUG(FeatureStandby, "take %s suspendedCount = %d", feature->getFeatureName(), (int)entryCount);
+					return feature;
+				}
+			}
+			return NULL;
+		}
+
+		/**
+		 * Takes least recently suspended feature out of standby
+		 *
+		 * @param entry filled with evicted feature and its factory
+		 * @return false if standby is empty
+		 */
+		const bool FeatureStandby::evict(Entry& entry) {
+
+			if(entryCount == 0) return false;
+
+			entry = entries[0];
+			removeEntry(0);
+
+			LOG_INFO(FeatureStandby, "evict %s suspendedCount = %d", entry.feature->getFeatureName(), (int)entryCount);
+			return true;
+		}
+
+		/**
+		 * Indicates if a feature has to be evicted before another one is suspended
+		 *
+		 * @return true if MAX_SUSPENDED features are suspended
+		 */
+		const bool FeatureStandby::isFull() {
+			return entryCount == MAX_SUSPENDED;
+		}
+
+		/**
+		 * Gets number of suspended features
+		 *
+		 * @return suspended features count
+		 */
+		uint8_t FeatureStandby::getSuspendedCount() {
+			return entryCount;
+		}
+
+		/**
+		 * Removes entry and shifts more recent ones
+		 *
+		 * @param index of removed entry
+		 */
+		void FeatureStandby::removeEntry(const uint8_t index) {
+
+			for(uint8_t i = index; i + 1 < entryCount; i++) {
+				entries[i] = entries[i + 1];
+			}
+			entryCount--;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
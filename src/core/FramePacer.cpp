@@ -0,0 +1,130 @@
+/**
+ * FramePacer class implementation
+ * @author error23
+ */
+#include "core/FramePacer.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Initialise frame pacer
+		 *
+		 * @param maxFps frame rate upper bound
+		 */
+		FramePacer::FramePacer(const double maxFps)
+			: maxFps(maxFps)
+			, frameRate(0)
+			, period(0)
+			, lastFrameTime(0)
+			, nextFrameTime(0)
+			, reportTime(0)
+			, frames(0)
+			, missedDeadlines(0)
+			, maxLateness(0)
+			, totalMissedDeadlines(0) {
+
+			LOG_INFO(FramePacer, "created with maxFps = %f", maxFps);
+		}
+
+		/**
+		 * Sets frame rate, cadence restarts from last frame so that rate changes are never counted as missed deadlines
+		 *
+		 * @param fps frame rate, clamped to maxFps
+		 */
+		void FramePacer::setFrameRate(const double fps) {
+
+			double newFrameRate = min(max(fps, 0.1), maxFps);
+			if(newFrameRate == frameRate) return;
+
+			LOG_DEBUG(FramePacer, "setFrameRate frameRate = %f, newFrameRate = %f", frameRate, newFrameRate);
+
+			frameRate = newFrameRate;
+			period = (uint64_t)(1000000 / frameRate);
+			nextFrameTime = max(lastFrameTime + period, Hal::Clock::getMicroseconds());
+			Profiler::setFrameBudget(period);
+		}
+
+		/**
+		 * Blocks until next frame deadline or next event
+		 *
+		 * @param lightSleep if true device light sleeps while waiting, only allowed while wifi is off
+		 */
+		void FramePacer::waitNextFrame(const bool lightSleep) {
+
+			uint64_t now = Hal::Clock::getMicroseconds();
+			if(now < nextFrameTime) {
+				Events::wait((nextFrameTime - now + 999) / 1000, lightSleep);
+				now = Hal::Clock::getMicroseconds();
+			}
+
+			// Woken early by an event, frame runs at once and cadence is kept
+			if(now < nextFrameTime) {
+				lastFrameTime = now;
+				frames++;
+				report(now);
+				return;
+			}
+
+			uint64_t lateness = now - nextFrameTime;
+			if(lateness >= period) {
+				missedDeadlines += lateness / period;
+				totalMissedDeadlines += lateness / period;
+				nextFrameTime = now + period;
+			}
+			else {
+				nextFrameTime += period;
+			}
+
+			if(lateness > maxLateness) maxLateness = lateness;
+			lastFrameTime = now;
+			frames++;
+			report(now);
+		}
+
+		/**
+		 * Gets current frame rate
+		 *
+		 * @return frame rate
+		 */
+		double FramePacer::getFrameRate() const {
+			return frameRate;
+		}
+
+		/**
+		 * Gets frame rate upper bound
+		 *
+		 * @return max fps
+		 */
+		double FramePacer::getMaxFps() const {
+			return maxFps;
+		}
+
+		/**
+		 * Gets number of missed frame deadlines since boot
+		 *
+		 * @return missed deadlines count
+		 */
+		uint32_t FramePacer::getMissedDeadlines() const {
+			return totalMissedDeadlines;
+		}
+
+		/**
+		 * Logs fps and missed deadlines once per REPORT_PERIOD
+		 *
+		 * @param now clock time in us
+		 */
+		void FramePacer::report(const uint64_t now) {
+
+			if(now - reportTime < REPORT_PERIOD) return;
+
+			LOG_INFO(FramePacer, "report fps = %f, frameRate = %f, missedDeadlines = %u, maxLateness = %u us", frames * 1000000.0 / (now - reportTime), frameRate, (unsigned int)missedDeadlines, (unsigned int)maxLateness);
+
+			reportTime = now;
+			frames = 0;
+			missedDeadlines = 0;
+			maxLateness = 0;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
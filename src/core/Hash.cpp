@@ -0,0 +1,29 @@
+/**
+ * Hash class implementation
+ * @author error23
+ */
+#include "core/Hash.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Hashes bytes with FNV-1a
+		 *
+		 * @param data   bytes to hash
+		 * @param length number of bytes
+		 * @param seed   hash of previous bytes default FNV1A_OFFSET_BASIS
+		 * @return hash of seed followed by data
+		 */
+		uint32_t Hash::fnv1a(const void* data, const size_t length, const uint32_t seed /* = FNV1A_OFFSET_BASIS */) {
+
+			const uint8_t* bytes = (const uint8_t*)data;
+			uint32_t hash = seed;
+			for(size_t i = 0; i < length; i++) {
+				hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+			}
+			return hash;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
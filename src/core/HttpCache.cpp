@@ -0,0 +1,161 @@
+/**
+ * HttpCache class implementation
+ * @author error23
+ */
+#include "core/HttpCache.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Initialise new empty http cache
+		 */
+		HttpCache::HttpCache()
+			: entries()
+			, useCount(0) {
+		}
+
+		/**
+		 * Gets validators of uri
+		 *
+		 * @param uri requested uri
+		 * @return copy of cached validators, empty validators if uri is not cached
+		 */
+		HttpCache::Entry HttpCache::get(const char* uri) {
+
+			uint32_t key = hash(uri);
+
+			Entry* cached = find(key);
+			if(cached != NULL) {
+				cached->lastUsed = useCount++;
+				return *cached;
+			}
+
+			Entry entry = Entry();
+			entry.key = key;
+			return entry;
+		}
+
+		/**
+		 * Stores validators, evicts least recently used uri if cache is full
+		 * Entries without any validator are removed since they can not make a request conditional
+		 *
+		 * @param entry validators returned by get and updated by the request
+		 */
+		void HttpCache::store(const Entry& entry) {
+
+			Entry* cached = find(entry.key);
+
+			if(entry.etag[0] == '\0' && entry.lastModified[0] == '\0' && !isFresh(entry)) {
+				if(cached != NULL) *cached = Entry();
+				return;
+			}
+
+			if(cached == NULL) {
+				cached = &entries[0];
+				for(uint8_t i = 1; i < MAX_ENTRIES && cached->key != 0; i++) {
+					if(entries[i].key == 0 || (int32_t)(entries[i].lastUsed - cached->lastUsed) < 0) cached = &entries[i];
+				}
+			}
+
+			*cached = entry;
+			cached->lastUsed = useCount++;
+			LOG_DEBUG(HttpCache, "store key = %u, etag = %s, lastModified = %s", (unsigned int)entry.key, entry.etag, entry.lastModified);
+		}
+
+		/**
+		 * Removes uri, used when a request may have changed it
+		 *
+		 * @param uri to remove
+		 */
+		void HttpCache::remove(const char* uri) {
+
+			Entry* cached = find(hash(uri));
+			if(cached != NULL) *cached = Entry();
+		}
+
+		/**
+		 * Checks if entry may be used without request
+		 *
+		 * @param entry to check
+		 * @return true if max-age is not elapsed
+		 */
+		bool HttpCache::isFresh(const Entry& entry) {
+			return entry.expires > Hal::Clock::getMicroseconds() / 1000;
+		}
+
+		/**
+		 * Updates entry from response headers
+		 *
+		 * @param entry        to update
+		 * @param status       http status
+		 * @param etag         ETag header
+		 * @param lastModified Last-Modified header
+		 * @param cacheControl Cache-Control header
+		 */
+		void HttpCache::update(Entry& entry, const int status, const String& etag, const String& lastModified, const String& cacheControl) {
+
+			// only a full response or a revalidation says something about the cached body
+			if((status != 200 && status != NOT_MODIFIED) || strstr(cacheControl.c_str(), "no-store") != NULL) {
+				clear(entry);
+				return;
+			}
+
+			// 304 may omit validators that did not change
+			if(status == 200 || etag.length() > 0) {
+				entry.etag[0] = '\0';
+				if(etag.length() < ETAG_SIZE) strcpy(entry.etag, etag.c_str());
+			}
+			if(status == 200 || lastModified.length() > 0) {
+				entry.lastModified[0] = '\0';
+				if(lastModified.length() < LAST_MODIFIED_SIZE) strcpy(entry.lastModified, lastModified.c_str());
+			}
+
+			entry.expires = 0;
+			const char* maxAge = strstr(cacheControl.c_str(), "max-age=");
+			if(maxAge != NULL && strstr(cacheControl.c_str(), "no-cache") == NULL) {
+				uint32_t seconds = strtoul(maxAge + 8, NULL, 10);
+				if(seconds > 0) entry.expires = Hal::Clock::getMicroseconds() / 1000 + seconds * 1000ULL;
+			}
+		}
+
+		/**
+		 * Clears validators of entry, next request is not conditional
+		 *
+		 * @param entry to clear
+		 */
+		void HttpCache::clear(Entry& entry) {
+
+			entry.etag[0] = '\0';
+			entry.lastModified[0] = '\0';
+			entry.expires = 0;
+		}
+
+		/**
+		 * Hashes uri with FNV-1a
+		 *
+		 * @param uri to hash
+		 * @return uri hash, never 0
+		 */
+		uint32_t HttpCache::hash(const char* uri) {
+
+			uint32_t hash = Hash::fnv1a(uri, strlen(uri));
+			return hash != 0 ? hash : 1;
+		}
+
+		/**
+		 * Finds entry of uri hash
+		 *
+		 * @param key uri hash
+		 * @return entry or NULL if uri is not cached
+		 */
+		HttpCache::Entry* HttpCache::find(const uint32_t key) {
+
+			for(uint8_t i = 0; i < MAX_ENTRIES; i++) {
+				if(entries[i].key == key) return &entries[i];
+			}
+			return NULL;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
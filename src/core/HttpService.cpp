@@ -0,0 +1,202 @@
+/**
+ * Http service class implementation
+ * @author error23
+ */
+#include "core/HttpService.hpp"
+
+// Lib includes
+#include <mutex>
+
+namespace CrowOs {
+	namespace Core {
+
+		/** Held from request until end so that only one task uses the connection */
+		static std::mutex requestLock;
+
+		Hal::HttpConnection HttpService::http;
+		HttpService::Metrics HttpService::metrics = HttpService::Metrics();
+		int HttpService::status = 0;
+		uint32_t HttpService::heapStart = 0;
+		uint32_t HttpService::heapHighWater = 0;
+
+		/**
+		 * Sends request over shared connection, every request must be closed with end
+		 *
+		 * @param method     http method
+		 * @param host       server host
+		 * @param port       server port
+		 * @param uri        requested uri
+		 * @param username   server username
+		 * @param password   server password
+		 * @param payload    request body or NULL
+		 * @param cacheEntry validators that make request conditional or NULL
+		 * @return http status or negative value on connection error
+		 */
+		int HttpService::request(const char* method, const char* host, const uint16_t port, const char* uri, const char* username, const char* password, const char* payload, const HttpCache::Entry* cacheEntry /* = NULL */) {
+
+			requestLock.lock();
+
+			metrics.requests++;
+			heapStart = Hal::Memory::getHeapUsed();
+			heapHighWater = heapStart;
+
+			// server may have dropped an idle keep alive connection, that is only known once the request fails
+			for(uint8_t attempt = 0; attempt < 2; attempt++) {
+
+				if(attempt > 0) metrics.retries++;
+
+				if(http.begin(host, port, uri)) {
+					http.addHeader("Content-Type", "application/json");
+					http.setAuthorization(username, password);
+					if(cacheEntry != NULL && cacheEntry->etag[0] != '\0') http.addHeader("If-None-Match", cacheEntry->etag);
+					if(cacheEntry != NULL && cacheEntry->lastModified[0] != '\0') http.addHeader("If-Modified-Since", cacheEntry->lastModified);
+					status = http.sendRequest(method, payload);
+				}
+				else {
+					status = -1;
+				}
+				sampleHeap();
+
+				// server may have received a POST or a PATCH before dropping the connection, it must not be applied twice
+				if(status > 0 || !http.getTimings().reused || !isIdempotent(method)) break;
+				http.end();
+				http.close();
+			}
+
+			if(status <= 0) metrics.failures++;
+			if(status == HttpCache::NOT_MODIFIED) metrics.notModified++;
+
+			return status;
+		}
+
+		/**
+		 * Sends request over shared connection and parses json response
+		 *
+		 * @param method       http method
+		 * @param host         server host
+		 * @param port         server port
+		 * @param uri          requested uri
+		 * @param username     server username
+		 * @param password     server password
+		 * @param payload      request body or NULL
+		 * @param responseBody filled with parsed response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
+		 * @param cacheEntry   validators of uri updated from response or NULL, a fresh entry is answered with HttpCache::NOT_MODIFIED without request
+		 * @return http status or negative value on connection error, HttpCache::NOT_MODIFIED leaves responseBody empty
+		 */
+		int HttpService::request(const char* method, const char* host, const uint16_t port, const char* uri, const char* username, const char* password, const char* payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter, HttpCache::Entry* cacheEntry /* = NULL */) {
+
+			if(cacheEntry != NULL && HttpCache::isFresh(*cacheEntry)) {
+				std::lock_guard<std::mutex> requestGuard(requestLock);
+				metrics.cacheHits++;
+				LOG_DEBUG(HttpService, "request %s %s is fresh", method, uri);
+				return HttpCache::NOT_MODIFIED;
+			}
+
+			// parse straight from the connection so that the body is never buffered whole
+			int status = request(method, host, port, uri, username, password, payload, cacheEntry);
+			if(cacheEntry != NULL && status > 0) HttpCache::update(*cacheEntry, status, http.header("ETag"), http.header("Last-Modified"), http.header("Cache-Control"));
+
+			if(status > 0 && status != HttpCache::NOT_MODIFIED) {
+				DeserializationError error = filter != NULL ? deserializeJson(responseBody, http, *filter) : deserializeJson(responseBody, http);
+				if(error && error != DeserializationError::EmptyInput) {
+					LOG_INFO(HttpService, "request deserializeJson error = %s", error.c_str());
+
+					// caller did not get this body, it must not be told later that it is unchanged
+					if(cacheEntry != NULL) HttpCache::clear(*cacheEntry);
+				}
+			}
+			end();
+
+			return status;
+		}
+
+		/**
+		 * Gets response body of current request, readable as ArduinoJson custom reader
+		 *
+		 * @return connection positioned on response body
+		 */
+		Hal::HttpConnection& HttpService::getBody() {
+			return http;
+		}
+
+		/**
+		 * Ends current request, unread body is dropped
+		 */
+		void HttpService::end() {
+
+			sampleHeap();
+			http.end();
+			record();
+
+			const Hal::HttpTimings& timings = http.getTimings();
+			LOG_INFO(HttpService, "end status = %d, reused = %d, connect = %u us, firstByte = %u us, transfer = %u us, heapPeak = %u bytes", status, timings.reused, (unsigned int)timings.connect, (unsigned int)timings.firstByte, (unsigned int)timings.transfer, (unsigned int)metrics.heapPeak);
+
+			requestLock.unlock();
+		}
+
+		/**
+		 * Closes shared connection, next request opens a new one
+		 * Never waits for a running request, its connection is then left to it
+		 */
+		void HttpService::close() {
+
+			// shutdown must not wait for the network task
+			std::unique_lock<std::mutex> requestGuard(requestLock, std::try_to_lock);
+			if(!requestGuard.owns_lock()) {
+				LOG_INFO(HttpService, "close skipped request is running");
+				return;
+			}
+
+			LOG_INFO(HttpService, "close requests = %u, connections = %u, retries = %u, failures = %u, cacheHits = %u, notModified = %u", (unsigned int)metrics.requests, (unsigned int)metrics.connections, (unsigned int)metrics.retries, (unsigned int)metrics.failures, (unsigned int)metrics.cacheHits, (unsigned int)metrics.notModified);
+			http.close();
+		}
+
+		/**
+		 * Gets connection statistics
+		 *
+		 * @return connection statistics
+		 */
+		const HttpService::Metrics& HttpService::getMetrics() {
+			return metrics;
+		}
+
+		/**
+		 * Samples allocated heap
+		 */
+		void HttpService::sampleHeap() {
+			heapHighWater = max(heapHighWater, Hal::Memory::getHeapUsed());
+		}
+
+		/**
+		 * Indicates if request may be sent again without changing what server did with the first one
+		 *
+		 * @param method http method
+		 * @return true for GET, HEAD, PUT and DELETE
+		 */
+		const bool HttpService::isIdempotent(const char* method) {
+			return strcmp(method, "GET") == 0 || strcmp(method, "HEAD") == 0 || strcmp(method, "PUT") == 0 || strcmp(method, "DELETE") == 0;
+		}
+
+		/**
+		 * Adds timings of last request to metrics
+		 */
+		void HttpService::record() {
+
+			const Hal::HttpTimings& timings = http.getTimings();
+
+			if(!timings.reused && timings.connect > 0) {
+				metrics.connections++;
+				metrics.connectTotal += timings.connect;
+				metrics.connectMaximum = max(metrics.connectMaximum, timings.connect);
+			}
+
+			metrics.firstByteTotal += timings.firstByte;
+			metrics.firstByteMaximum = max(metrics.firstByteMaximum, timings.firstByte);
+
+			metrics.heapPeak = heapHighWater - heapStart;
+			metrics.heapPeakMaximum = max(metrics.heapPeakMaximum, metrics.heapPeak);
+		}
+
+	} // namespace Core
+} // namespace CrowOs
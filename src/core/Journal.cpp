@@ -0,0 +1,266 @@
+/**
+ * Journal class implementation
+ * @author error23
+ */
+#include "core/Journal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		Journal::Entry Journal::entries[Journal::MAX_ENTRIES];
+		uint8_t Journal::entryCount = 0;
+		uint32_t Journal::sequence = 0;
+		WebClient* Journal::webClient = NULL;
+		RequestId Journal::replayRequest = NetworkTask::NO_REQUEST;
+		TimerId Journal::retryTimer = Scheduler::NO_TIMER;
+
+		/**
+		 * Journals saved data of feature factories that local copy holds and server does not
+		 * Must be called after local saved data was loaded
+		 *
+		 * @param webClient client used to replay records
+		 */
+		void Journal::begin(WebClient* webClient) {
+
+			Journal::webClient = webClient;
+			NetworkTask::cancel(replayRequest);
+			Scheduler::cancel(retryTimer);
+			entryCount = 0;
+
+			// local copy stamped with an older synced hash is newer than server, saved data is dirty until replay stores it
+			for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
+				record(featureFactorySavedDataPair.first, featureFactorySavedDataPair.second);
+			}
+
+			LOG_INFO(Journal, "begin pending = %d", getPendingCount());
+		}
+
+		/**
+		 * Journals saved data of factory if it is not stored on server nor already journaled, its local copy is written first
+		 *
+		 * @param factory   feature factory
+		 * @param savedData actual saved data of factory
+		 */
+		void Journal::record(FeatureFactory* factory, const String& savedData) {
+
+			// local copy is the persistent record of pending saved data, it is written only if it changed
+			FeatureDataStore::store(factory);
+
+			// a pending entry is recorded again even when saved data went back to stored one so that a running replay never marks it synced
+			Entry* entry = findEntry(factory, factory->isDirty());
+			if(entry == NULL || (entry->pending && entry->hash == factory->getSavedDataHash())) return;
+			if(!entry->pending && !factory->isDirty()) return;
+
+			// saved data that never fits in a replay is not journaled on each save only to be dropped again
+			if(!fitsReplay(savedData.length())) {
+				if(entry->droppedHash != factory->getSavedDataHash()) {
+					LOG_INFO(Journal, "record %s dropped savedDataLength = %d", factory->getFeatureFactoryName(), (int)savedData.length());
+					entry->hash = factory->getSavedDataHash();
+					drop(*entry);
+				}
+				return;
+			}
+
+			entry->hash = factory->getSavedDataHash();
+			entry->sequence = ++sequence;
+			entry->pending = true;
+			entry->droppedHash = 0;
+
+			LOG_INFO(Journal, "record %s sequence = %u", factory->getFeatureFactoryName(), (unsigned int)sequence);
+		}
+
+		/**
+		 * Sends pending records to server if no replay is running, must be called from main loop while wifi is connected
+		 */
+		void Journal::replay() {
+
+			if(webClient == NULL || NetworkTask::isPending(replayRequest) || Scheduler::isScheduled(retryTimer)) return;
+
+			uint8_t pendingCount = getPendingCount();
+			if(pendingCount == 0) return;
+
+			JsonPool::Lease payload;
+			if(!payload.isValid()) {
+				retryTimer = Scheduler::schedule(RETRY_DELAY, NULL, NULL);
+				return;
+			}
+
+			// saved data is already json, it is copied as is instead of being parsed again
+			JsonArray featureDataDtos = payload->to<JsonArray>();
+			uint8_t sentCount = 0;
+			size_t payloadSize = JSON_ARRAY_SIZE(pendingCount);
+
+			for(uint8_t i = 0; i < entryCount; i++) {
+
+				Entry& entry = entries[i];
+				if(!entry.pending) continue;
+
+				auto featureFactorySavedDataPair = FeatureFactory::featureFactories.find(entry.factory);
+				if(featureFactorySavedDataPair == NULL) continue;
+				const String& savedData = featureFactorySavedDataPair->second;
+
+				// saved data that never fits in pooled document would hold back every later one
+				if(!fitsReplay(savedData.length())) {
+					LOG_INFO(Journal, "replay %s dropped savedDataLength = %d", entry.factory->getFeatureFactoryName(), (int)savedData.length());
+					drop(entry);
+					continue;
+				}
+				size_t recordSize = getPayloadSize(savedData.length());
+
+				// records that do not fit with previous ones are sent by next replay
+				if(payloadSize + recordSize > JsonPool::DOCUMENT_SIZE) continue;
+				payloadSize += recordSize;
+
+				JsonObject featureDataDto = featureDataDtos.createNestedObject();
+
+				long id = entry.factory->getFeatureFactoryId();
+				if(id != -1) featureDataDto["id"] = id;
+				featureDataDto["featureFactoryName"] = entry.factory->getFeatureFactoryName();
+				if(savedData.length() > 0) featureDataDto["savedData"] = serialized(savedData);
+
+				entry.sentSequence = entry.sequence;
+				sentCount++;
+			}
+
+			LOG_INFO(Journal, "replay pending = %d, sent = %d", pendingCount, sentCount);
+			if(sentCount == 0) {
+				retryTimer = Scheduler::schedule(RETRY_DELAY, NULL, NULL);
+				return;
+			}
+
+			// only ids of created feature data are read back
+			StaticJsonDocument<JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(2)> filter;
+			filter[0]["id"] = true;
+			filter[0]["featureFactoryName"] = true;
+
+			replayRequest = webClient->submitPUT("featureData", *payload, onReplayResponse, NULL, &filter);
+			if(replayRequest == NetworkTask::NO_REQUEST) retryTimer = Scheduler::schedule(RETRY_DELAY, NULL, NULL);
+		}
+
+		/**
+		 * Gets number of records not accepted by server yet
+		 *
+		 * @return pending records count
+		 */
+		uint8_t Journal::getPendingCount() {
+
+			uint8_t pendingCount = 0;
+			for(uint8_t i = 0; i < entryCount; i++) {
+				if(entries[i].pending) pendingCount++;
+			}
+			return pendingCount;
+		}
+
+		/**
+		 * Called on main loop when replay request completes
+		 *
+		 * @param status       http status
+		 * @param responseBody ids and names of stored feature data
+		 * @param context      unused
+		 */
+		void Journal::onReplayResponse(const int status, JsonDocument& responseBody, void* /* context */) {
+
+			LOG_INFO(Journal, "onReplayResponse status = %d", status);
+
+			if(status != 202) {
+				for(uint8_t i = 0; i < entryCount; i++) {
+					entries[i].sentSequence = 0;
+				}
+				retryTimer = Scheduler::schedule(RETRY_DELAY, NULL, NULL);
+				return;
+			}
+
+			JsonArray featureDataDtos = responseBody.as<JsonArray>();
+
+			for(uint8_t i = 0; i < entryCount; i++) {
+
+				Entry& entry = entries[i];
+				if(entry.sentSequence == 0) continue;
+
+				// a record written while replay was running is newer than the sent one
+				if(entry.pending && entry.sentSequence == entry.sequence) {
+					entry.pending = false;
+					entry.factory->markSynced(entry.hash);
+				}
+				entry.sentSequence = 0;
+			}
+
+			// server answers with ids of stored feature data, only created ones are not known by id yet
+			for(JsonObject featureDataDto : featureDataDtos) {
+				long id = featureDataDto["id"] | -1L;
+				if(FeatureFactory::featureFactories.find(id) != NULL) continue;
+
+				auto featureFactorySavedDataPair = FeatureFactory::featureFactories.find(featureDataDto["featureFactoryName"].as<const char*>());
+				if(featureFactorySavedDataPair != NULL && featureFactorySavedDataPair->first->getFeatureFactoryId() == -1) FeatureFactory::featureFactories.setFeatureFactoryId(featureFactorySavedDataPair, id);
+			}
+
+			// local copy is stamped with synced hash and id, a stored stamp is what clears pending saved data after a restart
+			for(uint8_t i = 0; i < entryCount; i++) {
+				FeatureDataStore::store(entries[i].factory);
+			}
+
+			LOG_INFO(Journal, "onReplayResponse pending = %d", getPendingCount());
+		}
+
+		/**
+		 * Finds entry of factory
+		 *
+		 * @param factory journaled factory
+		 * @param create  adds entry if factory has none
+		 * @return entry or NULL if factory has none and it could not be added
+		 */
+		Journal::Entry* Journal::findEntry(FeatureFactory* factory, const bool create) {
+
+			for(uint8_t i = 0; i < entryCount; i++) {
+				if(entries[i].factory == factory) return &entries[i];
+			}
+
+			if(!create) return NULL;
+			if(entryCount == MAX_ENTRIES) {
+				LOG_INFO(Journal, "findEntry %s journal is full", factory->getFeatureFactoryName());
+				return NULL;
+			}
+
+			Entry& entry = entries[entryCount++];
+			entry.factory = factory;
+			entry.hash = 0;
+			entry.sequence = 0;
+			entry.sentSequence = 0;
+			entry.pending = false;
+			entry.droppedHash = 0;
+			return &entry;
+		}
+
+		/**
+		 * Indicates if saved data fits alone in a replay payload
+		 *
+		 * @param savedDataLength saved data length
+		 * @return false if saved data can never be replayed
+		 */
+		const bool Journal::fitsReplay(const size_t savedDataLength) {
+			return JSON_ARRAY_SIZE(1) + getPayloadSize(savedDataLength) <= JsonPool::DOCUMENT_SIZE;
+		}
+
+		/**
+		 * Gets size taken by one record in replay payload
+		 *
+		 * @param savedDataLength saved data length
+		 * @return record size in json document
+		 */
+		size_t Journal::getPayloadSize(const size_t savedDataLength) {
+			return JSON_OBJECT_SIZE(3) + savedDataLength + 1;
+		}
+
+		/**
+		 * Drops update that can never be replayed, saved data stays dirty in memory and in local copy
+		 *
+		 * @param entry journal entry of update
+		 */
+		void Journal::drop(Entry& entry) {
+
+			entry.pending = false;
+			entry.droppedHash = entry.hash;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,139 @@
+/**
+ * JsonPool class implementation
+ * @author error23
+ */
+#include "core/JsonPool.hpp"
+
+// Lib includes
+#include <mutex>
+
+namespace CrowOs {
+	namespace Core {
+
+		/** Guards leased flags */
+		static std::mutex poolLock;
+
+		StaticJsonDocument<JsonPool::DOCUMENT_SIZE> JsonPool::documents[JsonPool::POOL_SIZE];
+		bool JsonPool::leased[JsonPool::POOL_SIZE] = {};
+		uint8_t JsonPool::highWater = 0;
+		uint32_t JsonPool::failedCount = 0;
+
+		/**
+		 * Leases a cleared document
+		 */
+		JsonPool::Lease::Lease()
+			: index(acquire()) {
+
+			if(index != NO_DOCUMENT) documents[index].clear();
+		}
+
+		/**
+		 * Returns document to the pool
+		 */
+		JsonPool::Lease::~Lease() {
+
+			if(index != NO_DOCUMENT) release(index);
+		}
+
+		/**
+		 * Indicates if a document was leased
+		 *
+		 * @return false if every document was used
+		 */
+		const bool JsonPool::Lease::isValid() const {
+			return index != NO_DOCUMENT;
+		}
+
+		/**
+		 * Gets leased document, lease must be valid
+		 *
+		 * @return leased document
+		 */
+		JsonDocument& JsonPool::Lease::operator*() {
+			return documents[index];
+		}
+
+		/**
+		 * Gets leased document, lease must be valid
+		 *
+		 * @return leased document
+		 */
+		JsonDocument* JsonPool::Lease::operator->() {
+			return &documents[index];
+		}
+
+		/**
+		 * Gets number of documents actually leased
+		 *
+		 * @return leased documents count
+		 */
+		uint8_t JsonPool::getLeasedCount() {
+
+			std::lock_guard<std::mutex> poolGuard(poolLock);
+
+			uint8_t leasedCount = 0;
+			for(uint8_t i = 0; i < POOL_SIZE; i++) {
+				if(leased[i]) leasedCount++;
+			}
+			return leasedCount;
+		}
+
+		/**
+		 * Gets most documents leased at once
+		 *
+		 * @return leased documents high water
+		 */
+		uint8_t JsonPool::getHighWater() {
+			return highWater;
+		}
+
+		/**
+		 * Gets number of leases that found no free document
+		 *
+		 * @return failed leases count
+		 */
+		uint32_t JsonPool::getFailedCount() {
+			return failedCount;
+		}
+
+		/**
+		 * Leases first free document
+		 *
+		 * @return document index or NO_DOCUMENT
+		 */
+		uint8_t JsonPool::acquire() {
+
+			std::unique_lock<std::mutex> poolGuard(poolLock);
+
+			uint8_t index = NO_DOCUMENT;
+			uint8_t leasedCount = 1;
+			for(uint8_t i = 0; i < POOL_SIZE; i++) {
+				if(leased[i]) leasedCount++;
+				else if(index == NO_DOCUMENT) index = i;
+			}
+
+			if(index == NO_DOCUMENT) {
+				failedCount++;
+				poolGuard.unlock();
+				LOG_INFO(JsonPool, "acquire failed every document is leased, failedCount = %u", (unsigned int)failedCount);
+				return NO_DOCUMENT;
+			}
+
+			leased[index] = true;
+			highWater = max(highWater, leasedCount);
+			return index;
+		}
+
+		/**
+		 * Returns document to the pool
+		 *
+		 * @param index document index
+		 */
+		void JsonPool::release(const uint8_t index) {
+
+			std::lock_guard<std::mutex> poolGuard(poolLock);
+			leased[index] = false;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
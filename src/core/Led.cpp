@@ -13,9 +13,10 @@ namespace CrowOs {
 		Led::Led()
 			: LED_PIN(M5_LED)
 			, state(LOW)
-			, lastTimeBlink(0) {
+			, blinkTimer(Scheduler::NO_TIMER)
+			, blinkDelay(0) {
 
-			if(LOG_INFO) Serial.printf("Info : [Led] created with pin = %d and state = %d\n", LED_PIN, state);
+			LOG_INFO(Led, "created with pin = %d and state = %d", LED_PIN, state);
 		}
 
 		/**
@@ -23,27 +24,29 @@ namespace CrowOs {
 		 */
 		void Led::setUp() {
 
-			if(LOG_INFO) Serial.println("Info : [Led] Setup ...");
+			LOG_INFO(Led, "Setup ...");
 			pinMode(LED_PIN, OUTPUT);
 			off();
-			if(LOG_INFO) Serial.println("Info : [Led] Setup Done");
+			LOG_INFO(Led, "Setup Done");
 		}
 
 		/**
-		 * Turns on led
+		 * Turns on led and stops blinking
 		 */
 		void Led::on() {
 
-			if(LOG_DEBUG) Serial.println("Debug : [Led] on");
+			LOG_DEBUG(Led, "on");
+			Scheduler::cancel(blinkTimer);
 			setLed(LOW);
 		}
 
 		/**
-		 * Turns off led
+		 * Turns off led and stops blinking
 		 */
 		void Led::off() {
 
-			if(LOG_DEBUG) Serial.println("Debug : [Led] off");
+			LOG_DEBUG(Led, "off");
+			Scheduler::cancel(blinkTimer);
 			setLed(HIGH);
 		}
 
@@ -52,22 +55,33 @@ namespace CrowOs {
 		 */
 		void Led::toggle() {
 
-			if(LOG_DEBUG) Serial.printf("Debug : [Led] toggle state = %d, newState = %d\n", state, !state);
+			LOG_DEBUG(Led, "toggle state = %d, newState = %d", state, !state);
 			setLed(!state);
 		}
 
 		/**
-		 * Blink the led
+		 * Blink the led until on or off is called
 		 *
 		 * @param delay deley between two blinks
 		 */
 		void Led::blink(const int delay) {
 
-			if(millis() - lastTimeBlink > delay) {
-				if(LOG_DEBUG) Serial.printf("Debug : [Led] blink delay = %d, lastTimeBlink = %ld\n", delay, lastTimeBlink);
-				toggle();
-				lastTimeBlink = millis();
-			}
+			if(Scheduler::isScheduled(blinkTimer) && blinkDelay == delay) return;
+
+			LOG_DEBUG(Led, "blink delay = %d", delay);
+			Scheduler::cancel(blinkTimer);
+			blinkDelay = delay;
+			toggle();
+			blinkTimer = Scheduler::scheduleEvery(delay, onBlinkTimer, this);
+		}
+
+		/**
+		 * Toggles led, called by blinkTimer
+		 *
+		 * @param led to toggle
+		 */
+		void Led::onBlinkTimer(void* led) {
+			((Led*)led)->toggle();
 		}
 
 		/**
@@ -78,13 +92,13 @@ namespace CrowOs {
 		void Led::setLed(const bool newState) {
 
 			if(state == newState) {
-				if(LOG_DEBUG) Serial.printf("Debug : [Led] setLed inchanged state = %d, newState = %d\n", state, newState);
+				LOG_DEBUG(Led, "setLed inchanged state = %d, newState = %d", state, newState);
 				return;
 			}
 
 			state = newState;
 			digitalWrite(LED_PIN, state);
-			if(LOG_DEBUG) Serial.printf("Debug : [Led] setLed state = %d, newState = %d\n", state, newState);
+			LOG_DEBUG(Led, "setLed state = %d, newState = %d", state, newState);
 		}
 	} // namespace Core
 } // namespace CrowOs
@@ -0,0 +1,231 @@
+/**
+ * Log class implementation
+ * @author error23
+ */
+#include "core/Log.hpp"
+
+// Lib includes
+#include <mutex>
+
+// local Includes
+#include "core/Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/** Ring buffer size in bytes, must be a power of two */
+		static const uint32_t RING_BUFFER_SIZE = 4096;
+
+		/** Longest formatted message, longer ones are truncated */
+		static const int MAX_MESSAGE_SIZE = 192;
+
+		/** Delay between two drains in ms */
+		static const unsigned long DRAIN_PERIOD = 20;
+
+		/** Ring buffer, free running head and tail indexes are wrapped on access */
+		static char ringBuffer[RING_BUFFER_SIZE];
+
+		/** Index where next message is written */
+		static uint32_t head = 0;
+
+		/** Index of next byte to send */
+		static uint32_t tail = 0;
+
+		/** Number of messages dropped because ring buffer was full */
+		static unsigned long droppedCount = 0;
+
+		/** Number of dropped messages already reported */
+		static unsigned long reportedDroppedCount = 0;
+
+		/** Indicates if drain task is running, ring buffer is only shared once it runs */
+		static bool draining = false;
+
+		/** Indicates if messages are written to Serial by the caller because drain task could not start */
+		static bool synchronous = false;
+
+		/** Protects ring buffer indexes */
+		static std::mutex ringLock;
+
+		/** Keeps drains in order when flush runs next to drain task */
+		static std::mutex drainLock;
+
+		/**
+		 * Drain task body
+		 *
+		 * @param parameter unused
+		 */
+		void Log::drainTask(void* /* parameter */) {
+
+			for(;;) {
+				drain();
+				delay(DRAIN_PERIOD);
+			}
+		}
+
+		/**
+		 * Writes ring buffer content to Serial
+		 */
+		void Log::drain() {
+
+			std::lock_guard<std::mutex> drainGuard(drainLock);
+
+			char chunk[128];
+			for(;;) {
+
+				uint32_t length;
+				{
+					std::lock_guard<std::mutex> ringGuard(ringLock);
+
+					length = std::min<uint32_t>(head - tail, sizeof chunk);
+					length = std::min<uint32_t>(length, RING_BUFFER_SIZE - (tail % RING_BUFFER_SIZE));
+					memcpy(chunk, ringBuffer + tail % RING_BUFFER_SIZE, length);
+					tail += length;
+				}
+
+				if(length == 0) break;
+				Serial.write((const uint8_t*)chunk, length);
+			}
+
+			unsigned long dropped = droppedCount;
+			if(dropped != reportedDroppedCount) {
+				if(LOG_ENABLED(Log, LOG_LEVEL_INFO)) Serial.printf("Info : [Log] drain dropped = %lu messages\n", dropped - reportedDroppedCount);
+				reportedDroppedCount = dropped;
+			}
+		}
+
+		/**
+		 * Encodes integer as zigzag varint
+		 *
+		 * @param record being encoded
+		 * @param length actual record length
+		 * @param value  to encode
+		 */
+		void Log::encodeInteger(uint8_t* record, uint8_t& length, const int64_t value) {
+
+			uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+			do {
+				if(length >= MAX_RECORD_SIZE) return;
+				record[length++] = (zigzag & 0x7F) | (zigzag > 0x7F ? 0x80 : 0x00);
+				zigzag >>= 7;
+			} while(zigzag != 0);
+		}
+
+		/**
+		 * Encodes floating point argument as 4 bytes float
+		 *
+		 * @param record being encoded
+		 * @param length actual record length
+		 * @param value  to encode
+		 */
+		void Log::encodeArgument(uint8_t* record, uint8_t& length, const double value) {
+
+			if(length + sizeof(float) > MAX_RECORD_SIZE) return;
+
+			float single = value;
+			memcpy(record + length, &single, sizeof single);
+			length += sizeof single;
+		}
+
+		/**
+		 * Encodes string argument
+		 *
+		 * @param record being encoded
+		 * @param length actual record length
+		 * @param text   to encode
+		 */
+		void Log::encodeArgument(uint8_t* record, uint8_t& length, const char* text) {
+
+			if(length >= MAX_RECORD_SIZE) return;
+
+			uint8_t textLength = text != NULL ? std::min<size_t>(strlen(text), MAX_RECORD_SIZE - length - 1) : 0;
+			record[length++] = textLength;
+			if(textLength > 0) memcpy(record + length, text, textLength);
+			length += textLength;
+		}
+
+		/**
+		 * Copies record or message into the ring buffer
+		 *
+		 * @param data   to copy
+		 * @param length of data
+		 */
+		void Log::push(const void* data, const uint32_t length) {
+
+			{
+				std::unique_lock<std::mutex> ringGuard(ringLock, std::defer_lock);
+				if(draining) ringGuard.lock();
+
+				if(RING_BUFFER_SIZE - (head - tail) < length) {
+					droppedCount++;
+					return;
+				}
+
+				uint32_t offset = head % RING_BUFFER_SIZE;
+				uint32_t firstPart = std::min<uint32_t>(length, RING_BUFFER_SIZE - offset);
+				memcpy(ringBuffer + offset, data, firstPart);
+				memcpy(ringBuffer, (const char*)data + firstPart, length - firstPart);
+				head += length;
+			}
+
+			if(synchronous) drain();
+		}
+
+		/**
+		 * Starts drain task, Serial must be initialised
+		 * Messages logged before are kept in the ring buffer
+		 */
+		void Log::begin() {
+
+			static_assert((RING_BUFFER_SIZE & (RING_BUFFER_SIZE - 1)) == 0, "ring buffer size must be a power of two");
+
+			// Low priority on the core that does not run the main loop so that Serial never holds a frame
+			draining = Hal::Task::start(drainTask, NULL, "log", 2048, 1, 0);
+			synchronous = !draining;
+			if(synchronous) drain();
+
+			LOG_INFO(Log, "begin draining = %d, ringBufferSize = %u", draining, (unsigned int)RING_BUFFER_SIZE);
+		}
+
+		/**
+		 * Formats message into the ring buffer
+		 *
+		 * @param format printf format
+		 */
+		void Log::write(const char* format, ...) {
+
+			char message[MAX_MESSAGE_SIZE];
+			va_list args;
+
+			va_start(args, format);
+			int length = vsnprintf(message, sizeof message, format, args);
+			va_end(args);
+
+			if(length < 0) return;
+			if(length >= MAX_MESSAGE_SIZE) {
+				length = MAX_MESSAGE_SIZE - 1;
+				message[length - 1] = '\n';
+			}
+
+			push(message, length);
+		}
+
+		/**
+		 * Writes every pending message to Serial and waits until it is sent, used before power off
+		 */
+		void Log::flush() {
+
+			drain();
+			Serial.flush();
+		}
+
+		/**
+		 * Gets number of messages dropped because ring buffer was full
+		 *
+		 * @return dropped messages count
+		 */
+		unsigned long Log::getDroppedCount() {
+			return droppedCount;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,272 @@
+/**
+ * NetworkTask class implementation
+ * @author error23
+ */
+#include "core/NetworkTask.hpp"
+
+// Lib includes
+#include <condition_variable>
+#include <mutex>
+
+namespace CrowOs {
+	namespace Core {
+
+		/** Guards slot states */
+		static std::mutex slotsLock;
+
+		/** Signaled when a request is queued */
+		static std::condition_variable requestQueued;
+
+		NetworkTask::Slot NetworkTask::slots[NetworkTask::MAX_REQUESTS];
+		uint32_t NetworkTask::sequence = 0;
+		bool NetworkTask::started = false;
+		uint32_t NetworkTask::droppedCount = 0;
+
+		/**
+		 * Starts network task
+		 */
+		void NetworkTask::begin() {
+
+			// Same core as log drain, main loop runs on the other one
+			started = Hal::Task::start(run, NULL, "network", 8192, 1, 0);
+			LOG_INFO(NetworkTask, "begin started = %d, maxRequests = %d", started, (int)MAX_REQUESTS);
+		}
+
+		/**
+		 * Queues request
+		 *
+		 * @param method   http method, must be a literal
+		 * @param host     server host, must be a literal or outlive the request
+		 * @param port     server port
+		 * @param uri      requested uri, copied
+		 * @param username server username, must be a literal or outlive the request
+		 * @param password server password, must be a literal or outlive the request
+		 * @param payload  request body or NULL, serialized into the request slot
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @param cache    validators of uri used to make request conditional and updated before callback or NULL, must outlive the request
+		 * @param callback called on main loop when request completes
+		 * @param context  passed to callback
+		 * @return request handle or NO_REQUEST if every slot is used or payload is longer than MAX_PAYLOAD_SIZE
+		 */
+		RequestId NetworkTask::submit(const char* method, const char* host, const uint16_t port, const char* uri, const char* username, const char* password, const JsonDocument* payload, const JsonDocument* filter, HttpCache* cache, ResponseCallback callback, void* context) {
+
+			if(payload != NULL && measureJson(*payload) > MAX_PAYLOAD_SIZE) {
+				LOG_INFO(NetworkTask, "submit dropped %s %s payloadLength = %d is too large", method, uri, (int)measureJson(*payload));
+				return NO_REQUEST;
+			}
+
+			std::unique_lock<std::mutex> slotsGuard(slotsLock);
+
+			uint8_t index = findOldest(STATE_FREE);
+			if(index == NO_SLOT) {
+				droppedCount++;
+				slotsGuard.unlock();
+				LOG_INFO(NetworkTask, "submit dropped %s %s", method, uri);
+				return NO_REQUEST;
+			}
+
+			// free slots are touched by nobody else, fill it before queuing it
+			Slot& slot = slots[index];
+			slot.method = method;
+			slot.host = host;
+			slot.port = port;
+			slot.username = username;
+			slot.password = password;
+			strncpy(slot.uri, uri, MAX_URI_SIZE - 1);
+			slot.uri[MAX_URI_SIZE - 1] = '\0';
+			slot.hasPayload = payload != NULL;
+			if(payload != NULL) serializeJson(*payload, slot.payload, sizeof slot.payload);
+			slot.filtered = filter != NULL;
+			if(filter != NULL) slot.filter.set(*filter);
+			slot.cache = cache;
+			if(cache != NULL) slot.cacheEntry = cache->get(uri);
+			slot.callback = callback;
+			slot.context = context;
+			slot.sequence = sequence++;
+			slot.generation++;
+			slot.state = STATE_QUEUED;
+
+			RequestId id = (slot.generation << 8) | (index + 1);
+			slotsGuard.unlock();
+			requestQueued.notify_one();
+
+			// slot is only reused once its callback returned on main loop, payload stays readable here
+			LOG_DEBUG(NetworkTask, "submit %s %s id = %u, payload = %s", method, uri, (unsigned int)id, slot.hasPayload ? slot.payload : "");
+			return id;
+		}
+
+		/**
+		 * Cancels request, its callback is never called
+		 * A running request still completes on the network task but its response is dropped
+		 *
+		 * @param id request handle, set to NO_REQUEST
+		 */
+		void NetworkTask::cancel(RequestId& id) {
+
+			std::lock_guard<std::mutex> slotsGuard(slotsLock);
+
+			uint8_t index = findSlot(id);
+			id = NO_REQUEST;
+			if(index == NO_SLOT) return;
+
+			LOG_DEBUG(NetworkTask, "cancel %s state = %d", slots[index].uri, (int)slots[index].state);
+
+			// running slot is freed by the network task once its request returns
+			slots[index].state = slots[index].state == STATE_RUNNING ? STATE_CANCELLED : STATE_FREE;
+		}
+
+		/**
+		 * Checks if request is queued, running or waiting for its callback
+		 *
+		 * @param id request handle
+		 * @return true if request is pending
+		 */
+		bool NetworkTask::isPending(const RequestId id) {
+
+			std::lock_guard<std::mutex> slotsGuard(slotsLock);
+			return findSlot(id) != NO_SLOT;
+		}
+
+		/**
+		 * Calls callbacks of completed requests, must be called from main loop
+		 */
+		void NetworkTask::poll() {
+
+			for(;;) {
+
+				uint8_t index;
+				{
+					std::lock_guard<std::mutex> slotsGuard(slotsLock);
+
+					// without network task requests are run here, frames wait for them
+					index = started ? NO_SLOT : findOldest(STATE_QUEUED);
+					if(index != NO_SLOT) slots[index].state = STATE_RUNNING;
+				}
+				if(index != NO_SLOT) {
+					execute(slots[index]);
+					std::lock_guard<std::mutex> slotsGuard(slotsLock);
+					slots[index].state = slots[index].state == STATE_CANCELLED ? STATE_FREE : STATE_DONE;
+					continue;
+				}
+
+				{
+					std::lock_guard<std::mutex> slotsGuard(slotsLock);
+
+					// slot stays running during callback so that it is neither reused nor freed under it
+					index = findOldest(STATE_DONE);
+					if(index == NO_SLOT) return;
+					slots[index].state = STATE_RUNNING;
+				}
+
+				Slot& slot = slots[index];
+				LOG_DEBUG(NetworkTask, "poll %s status = %d", slot.uri, slot.status);
+
+				// cache belongs to the caller, it is only alive when its request was not cancelled
+				if(slot.cache != NULL) slot.cache->store(slot.cacheEntry);
+				slot.callback(slot.status, slot.responseBody, slot.context);
+
+				std::lock_guard<std::mutex> slotsGuard(slotsLock);
+				slot.state = STATE_FREE;
+			}
+		}
+
+		/**
+		 * Gets number of requests rejected because every slot was used
+		 *
+		 * @return rejected requests count
+		 */
+		uint32_t NetworkTask::getDroppedCount() {
+			return droppedCount;
+		}
+
+		/**
+		 * Gets memory of response documents owned by request slots
+		 *
+		 * @return response documents size in bytes
+		 */
+		size_t NetworkTask::getResponseMemory() {
+			return MAX_REQUESTS * MAX_JSON_DOCUMENT_SIZE;
+		}
+
+		/**
+		 * Network task body
+		 *
+		 * @param parameter unused
+		 */
+		void NetworkTask::run(void* /* parameter */) {
+
+			for(;;) {
+
+				uint8_t index;
+				{
+					std::unique_lock<std::mutex> slotsGuard(slotsLock);
+					requestQueued.wait(slotsGuard, [] { return findOldest(STATE_QUEUED) != NO_SLOT; });
+					index = findOldest(STATE_QUEUED);
+					slots[index].state = STATE_RUNNING;
+				}
+
+				execute(slots[index]);
+
+				bool cancelled;
+				{
+					std::lock_guard<std::mutex> slotsGuard(slotsLock);
+					cancelled = slots[index].state == STATE_CANCELLED;
+					slots[index].state = cancelled ? STATE_FREE : STATE_DONE;
+				}
+
+				if(!cancelled) Events::post(Events::EVENT_NETWORK);
+			}
+		}
+
+		/**
+		 * Finds oldest slot in given state, lock must be held
+		 *
+		 * @param state of searched slot
+		 * @return slot index or NO_SLOT
+		 */
+		uint8_t NetworkTask::findOldest(const State state) {
+
+			uint8_t oldest = NO_SLOT;
+			for(uint8_t i = 0; i < MAX_REQUESTS; i++) {
+				if(slots[i].state == state && (oldest == NO_SLOT || (int32_t)(slots[i].sequence - slots[oldest].sequence) < 0)) oldest = i;
+			}
+			return oldest;
+		}
+
+		/**
+		 * Finds slot of request handle, lock must be held
+		 *
+		 * @param id request handle
+		 * @return slot index or NO_SLOT if request is not pending
+		 */
+		uint8_t NetworkTask::findSlot(const RequestId id) {
+
+			uint8_t index = (id & 0xFF) - 1;
+			if(id == NO_REQUEST || index >= MAX_REQUESTS) return NO_SLOT;
+			if(slots[index].generation != (id >> 8) || slots[index].state == STATE_FREE || slots[index].state == STATE_CANCELLED) return NO_SLOT;
+			return index;
+		}
+
+		/**
+		 * Sends request of slot and parses its response
+		 *
+		 * @param slot to run
+		 */
+		void NetworkTask::execute(Slot& slot) {
+
+			uint64_t startTime = Hal::Clock::getMicroseconds();
+
+			slot.responseBody.clear();
+			if(slot.filtered) {
+				DeserializationOption::Filter filter(slot.filter);
+				slot.status = HttpService::request(slot.method, slot.host, slot.port, slot.uri, slot.username, slot.password, slot.hasPayload ? slot.payload : NULL, slot.responseBody, &filter, slot.cache != NULL ? &slot.cacheEntry : NULL);
+			}
+			else {
+				slot.status = HttpService::request(slot.method, slot.host, slot.port, slot.uri, slot.username, slot.password, slot.hasPayload ? slot.payload : NULL, slot.responseBody, NULL, slot.cache != NULL ? &slot.cacheEntry : NULL);
+			}
+
+			LOG_INFO(NetworkTask, "execute %s %s status = %d, duration = %u us", slot.method, slot.uri, slot.status, (unsigned int)(Hal::Clock::getMicroseconds() - startTime));
+		}
+
+	} // namespace Core
+} // namespace CrowOs
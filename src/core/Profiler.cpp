@@ -0,0 +1,199 @@
+/**
+ * Profiler class implementation
+ * @author error23
+ */
+#include "core/Profiler.hpp"
+
+// local Includes
+#include "core/NetworkTask.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		Profiler::Probe Profiler::probes[Profiler::MAX_PROBES];
+		uint8_t Profiler::probesCount = 0;
+		bool Profiler::probesOverflowed = false;
+		uint32_t Profiler::frameBudget = 0;
+
+		/**
+		 * Starts timing
+		 *
+		 * @param name probe name, must live as long as the profiler
+		 */
+		Profiler::Scope::Scope(const char* name)
+			: probe(findProbe(name))
+			, start(Hal::Cpu::getCycleCount()) {
+		}
+
+		/**
+		 * Stops timing and records the sample
+		 */
+		Profiler::Scope::~Scope() {
+
+			if(probe != NO_PROBE) record(probe, (Hal::Cpu::getCycleCount() - start) / Hal::Cpu::getCyclesPerMicrosecond());
+		}
+
+		/**
+		 * Sets frame budget used to count over budget samples
+		 *
+		 * @param budget frame budget in us
+		 */
+		void Profiler::setFrameBudget(const uint32_t budget) {
+
+			LOG_INFO(Profiler, "setFrameBudget budget = %u us", (unsigned int)budget);
+			frameBudget = budget;
+		}
+
+		/**
+		 * Handles profiler commands typed on Serial
+		 */
+		void Profiler::poll() {
+
+			// One command per call so that commands of other Serial readers are not swallowed
+			if(!Serial.available()) return;
+
+			switch(Serial.read()) {
+			case 'f':
+				report();
+				break;
+			case 'j': {
+				DynamicJsonDocument document(JSON_ARRAY_SIZE(MAX_PROBES) + MAX_PROBES * JSON_OBJECT_SIZE(7));
+				dump(document);
+				Log::flush();
+				serializeJson(document, Serial);
+				Serial.println();
+				break;
+			}
+			case 'r':
+				reset();
+				break;
+			}
+		}
+
+		/**
+		 * Logs one line per probe and one line of heap and json pool statistics
+		 */
+		void Profiler::report() {
+
+			LOG_INFO(Profiler, "report frameBudget = %u us", (unsigned int)frameBudget);
+			for(uint8_t i = 0; i < probesCount; i++) {
+
+				const Probe& probe = probes[i];
+				if(probe.count == 0) continue;
+
+				uint32_t average = probe.total / probe.count;
+				LOG_INFO(Profiler, "report probe = %s, count = %u, min = %u us, avg = %u us, p99 = %u us, max = %u us, avg budget = %u%%, over budget = %u", probe.name, (unsigned int)probe.count, (unsigned int)probe.minimum, (unsigned int)average, (unsigned int)percentile99(probe), (unsigned int)probe.maximum, frameBudget != 0 ? (unsigned int)(100 * average / frameBudget) : 0, (unsigned int)probe.overBudget);
+			}
+
+			// steady state allocations show as a heap that neither grows nor fragments between reports, json documents are static and reported apart
+			LOG_INFO(Profiler, "report heapUsed = %u, heapFree = %u, largestFreeBlock = %u, fragmentation = %d%%, jsonLeases = %d, jsonHighWater = %d/%d, jsonFailed = %u", (unsigned int)Hal::Memory::getHeapUsed(), (unsigned int)Hal::Memory::getHeapFree(), (unsigned int)Hal::Memory::getLargestFreeBlock(), Hal::Memory::getFragmentation(), JsonPool::getLeasedCount(), JsonPool::getHighWater(), (int)JsonPool::POOL_SIZE, (unsigned int)JsonPool::getFailedCount());
+			LOG_INFO(Profiler, "report jsonPoolMemory = %u, jsonResponseMemory = %u", (unsigned int)(JsonPool::POOL_SIZE * JsonPool::DOCUMENT_SIZE), (unsigned int)NetworkTask::getResponseMemory());
+		}
+
+		/**
+		 * Dumps every probe into json array
+		 *
+		 * @param document to dump into
+		 */
+		void Profiler::dump(JsonDocument& document) {
+
+			JsonArray probesArray = document.to<JsonArray>();
+			for(uint8_t i = 0; i < probesCount; i++) {
+
+				const Probe& probe = probes[i];
+				JsonObject probeObject = probesArray.createNestedObject();
+				probeObject["name"] = probe.name;
+				probeObject["count"] = probe.count;
+				probeObject["min"] = probe.count != 0 ? probe.minimum : 0;
+				probeObject["avg"] = probe.count != 0 ? (uint32_t)(probe.total / probe.count) : 0;
+				probeObject["p99"] = percentile99(probe);
+				probeObject["max"] = probe.maximum;
+				probeObject["overBudget"] = probe.overBudget;
+			}
+		}
+
+		/**
+		 * Clears every probe statistics
+		 */
+		void Profiler::reset() {
+
+			LOG_INFO(Profiler, "reset");
+			for(uint8_t i = 0; i < probesCount; i++) {
+
+				const char* name = probes[i].name;
+				memset(&probes[i], 0, sizeof probes[i]);
+				probes[i].name = name;
+				probes[i].minimum = UINT32_MAX;
+			}
+		}
+
+		/**
+		 * Finds probe by name and creates it if needed
+		 *
+		 * @param name probe name
+		 * @return probe index or NO_PROBE if probes are full
+		 */
+		uint8_t Profiler::findProbe(const char* name) {
+
+			for(uint8_t i = 0; i < probesCount; i++) {
+				if(probes[i].name == name || strcmp(probes[i].name, name) == 0) return i;
+			}
+
+			if(probesCount == MAX_PROBES) {
+				if(!probesOverflowed) LOG_INFO(Profiler, "findProbe %s ignored, all %d probes are used", name, (int)MAX_PROBES);
+				probesOverflowed = true;
+				return NO_PROBE;
+			}
+
+			memset(&probes[probesCount], 0, sizeof probes[probesCount]);
+			probes[probesCount].name = name;
+			probes[probesCount].minimum = UINT32_MAX;
+			LOG_DEBUG(Profiler, "findProbe added name = %s", name);
+			return probesCount++;
+		}
+
+		/**
+		 * Adds sample to probe
+		 *
+		 * @param probe    probe index
+		 * @param duration sample duration in us
+		 */
+		void Profiler::record(const uint8_t probe, const uint32_t duration) {
+
+			Probe& target = probes[probe];
+			target.count++;
+			target.total += duration;
+			if(duration < target.minimum) target.minimum = duration;
+			if(duration > target.maximum) target.maximum = duration;
+			if(frameBudget != 0 && duration > frameBudget) target.overBudget++;
+
+			// bucket i holds durations up to 2^(i/2) us
+			uint8_t bucket = 0;
+			while(bucket < HISTOGRAM_SIZE - 1 && (uint64_t)duration * duration > (1ULL << bucket)) {
+				bucket++;
+			}
+			target.histogram[bucket]++;
+		}
+
+		/**
+		 * Estimates 99th percentile of probe from its histogram
+		 *
+		 * @param probe to estimate
+		 * @return upper bound of bucket holding the 99th percentile in us
+		 */
+		uint32_t Profiler::percentile99(const Probe& probe) {
+
+			if(probe.count == 0) return 0;
+
+			uint32_t threshold = probe.count - probe.count / 100;
+			uint32_t seen = 0;
+			for(uint8_t bucket = 0; bucket < HISTOGRAM_SIZE - 1; bucket++) {
+
+				seen += probe.histogram[bucket];
+				if(seen >= threshold) return std::min<uint32_t>(sqrt(1ULL << bucket), probe.maximum);
+			}
+			return probe.maximum;
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,85 @@
+/**
+ * SavedDataRecord class implementation
+ * @author error23
+ */
+#include "core/SavedDataRecord.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		/**
+		 * Builds storage key of factory record
+		 *
+		 * @param prefix  of record owner
+		 * @param factory feature factory
+		 * @param key     filled with KEY_SIZE characters and terminating zero
+		 */
+		void SavedDataRecord::getKey(const char prefix, const FeatureFactory* factory, char* key) {
+			sprintf(key, "%c%08x", prefix, (unsigned int)factory->getNameHash());
+		}
+
+		/**
+		 * Reads record, removes it if it is corrupted
+		 *
+		 * @param key       storage key
+		 * @param stamp     filled with record stamp
+		 * @param id        filled with feature factory id
+		 * @param savedData filled with saved data
+		 * @return true if a valid record was read
+		 */
+		const bool SavedDataRecord::read(const char* key, uint32_t& stamp, int32_t& id, String& savedData) {
+
+			size_t length = Hal::Storage::getLength(key);
+			if(length == 0) return false;
+
+			// length comes from flash, it is checked before it sizes the stack buffer
+			Header header;
+			header.savedDataLength = 0;
+			if(length >= sizeof header && length <= MAX_RECORD_SIZE) {
+				uint8_t buffer[length + 1];
+				if(Hal::Storage::read(key, buffer, length) == length) memcpy(&header, buffer, sizeof header);
+
+				if(sizeof header + header.savedDataLength == length) {
+					buffer[length] = '\0';
+					stamp = header.stamp;
+					id = header.id;
+					savedData = (const char*)(buffer + sizeof header);
+					return true;
+				}
+			}
+
+			LOG_INFO(SavedDataRecord, "read %s record is corrupted length = %d", key, (int)length);
+			Hal::Storage::remove(key);
+			return false;
+		}
+
+		/**
+		 * Writes record, replaces previous one
+		 *
+		 * @param key       storage key
+		 * @param stamp     record stamp
+		 * @param id        feature factory id
+		 * @param savedData saved data, not written if it is longer than MAX_SAVED_DATA_SIZE
+		 * @return true if record is written
+		 */
+		const bool SavedDataRecord::write(const char* key, const uint32_t stamp, const int32_t id, const String& savedData) {
+
+			if(savedData.length() > MAX_SAVED_DATA_SIZE) {
+				LOG_INFO(SavedDataRecord, "write %s savedDataLength = %d is too large", key, (int)savedData.length());
+				return false;
+			}
+
+			Header header;
+			header.stamp = stamp;
+			header.id = id;
+			header.savedDataLength = savedData.length();
+
+			uint8_t buffer[sizeof header + header.savedDataLength];
+			memcpy(buffer, &header, sizeof header);
+			memcpy(buffer + sizeof header, savedData.c_str(), header.savedDataLength);
+
+			return Hal::Storage::write(key, buffer, sizeof buffer);
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,251 @@
+/**
+ * Scheduler class implementation
+ * @author error23
+ */
+#include "core/Scheduler.hpp"
+
+namespace CrowOs {
+	namespace Core {
+
+		Scheduler::Timer Scheduler::timers[Scheduler::MAX_TIMERS];
+		uint8_t Scheduler::slots[Scheduler::WHEEL_SIZE] = {
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+		uint64_t Scheduler::currentTick = 0;
+
+		/**
+		 * Schedules one shot timer
+		 *
+		 * @param delay    before expiry in ms
+		 * @param callback to call on expiry, may be NULL for a plain deadline checked with isScheduled
+		 * @param context  passed to callback
+		 * @return timer handle or NO_TIMER if pool is full
+		 */
+		TimerId Scheduler::schedule(const uint32_t delay, TimerCallback callback, void* context) {
+
+			return add(delay, 0, callback, context);
+		}
+
+		/**
+		 * Schedules periodic timer, first expiry is after one period
+		 * Missed expiries are skipped instead of being run in a burst
+		 *
+		 * @param period   between expiries in ms
+		 * @param callback to call on expiry
+		 * @param context  passed to callback
+		 * @return timer handle or NO_TIMER if pool is full
+		 */
+		TimerId Scheduler::scheduleEvery(const uint32_t period, TimerCallback callback, void* context) {
+
+			return add(period, period, callback, context);
+		}
+
+		/**
+		 * Cancels timer
+		 *
+		 * @param timer to cancel, set to NO_TIMER
+		 * @return true if timer was scheduled
+		 */
+		bool Scheduler::cancel(TimerId& timer) {
+
+			uint8_t index = findTimer(timer);
+			timer = NO_TIMER;
+			if(index == NO_INDEX) return false;
+
+			unlink(index);
+			timers[index].active = false;
+			return true;
+		}
+
+		/**
+		 * Indicates if timer is still scheduled
+		 *
+		 * @param timer to check
+		 * @return true if timer did not expire and was not canceled
+		 */
+		bool Scheduler::isScheduled(const TimerId timer) {
+
+			return findTimer(timer) != NO_INDEX;
+		}
+
+		/**
+		 * Runs callbacks of every expired timer
+		 */
+		void Scheduler::run() {
+
+			uint64_t now = nowTick();
+
+			// After a long stall every slot is visited once instead of once per elapsed tick
+			if(now - currentTick >= WHEEL_SIZE) {
+				// timers added by callbacks are due after now, they never land in a slot this loop already visited
+				currentTick = now;
+				for(uint8_t slot = 0; slot < WHEEL_SIZE; slot++) {
+					processSlot(slot, now);
+				}
+			}
+			else {
+				while(currentTick < now) {
+					currentTick++;
+					processSlot(currentTick & (WHEEL_SIZE - 1), currentTick);
+				}
+			}
+
+			currentTick = now;
+		}
+
+		/**
+		 * Gets deadline of the timer that expires first
+		 *
+		 * @return deadline in ms since boot or UINT64_MAX if no timer is scheduled
+		 */
+		uint64_t Scheduler::getNextDeadline() {
+
+			uint64_t deadline = UINT64_MAX;
+			for(uint8_t i = 0; i < MAX_TIMERS; i++) {
+				if(timers[i].active && timers[i].deadline * TICK < deadline) deadline = timers[i].deadline * TICK;
+			}
+			return deadline;
+		}
+
+		/**
+		 * Gets time left before the first timer expires
+		 *
+		 * @return ms before next deadline, 0 if it is due and UINT32_MAX if no timer is scheduled
+		 */
+		uint32_t Scheduler::getTimeUntilNextDeadline() {
+
+			uint64_t deadline = getNextDeadline();
+			if(deadline == UINT64_MAX) return UINT32_MAX;
+
+			uint64_t now = Hal::Clock::getMicroseconds() / 1000;
+			if(deadline <= now) return 0;
+			return std::min<uint64_t>(deadline - now, UINT32_MAX - 1);
+		}
+
+		/**
+		 * Gets actual tick
+		 *
+		 * @return ticks since boot
+		 */
+		uint64_t Scheduler::nowTick() {
+
+			return Hal::Clock::getMicroseconds() / (1000 * TICK);
+		}
+
+		/**
+		 * Gets pool index of timer
+		 *
+		 * @param timer to find
+		 * @return pool index or NO_INDEX if timer is not scheduled
+		 */
+		uint8_t Scheduler::findTimer(const TimerId timer) {
+
+			uint8_t index = (timer & 0xFF) - 1;
+			if(timer == NO_TIMER || index >= MAX_TIMERS) return NO_INDEX;
+			if(!timers[index].active || timers[index].generation != timer >> 8) return NO_INDEX;
+			return index;
+		}
+
+		/**
+		 * Adds timer to its slot
+		 *
+		 * @param index pool index of timer
+		 */
+		void Scheduler::link(const uint8_t index) {
+
+			uint8_t slot = timers[index].deadline & (WHEEL_SIZE - 1);
+			timers[index].next = slots[slot];
+			slots[slot] = index;
+		}
+
+		/**
+		 * Removes timer from its slot
+		 *
+		 * @param index pool index of timer
+		 */
+		void Scheduler::unlink(const uint8_t index) {
+
+			uint8_t* link = &slots[timers[index].deadline & (WHEEL_SIZE - 1)];
+			while(*link != NO_INDEX) {
+				if(*link == index) {
+					*link = timers[index].next;
+					return;
+				}
+				link = &timers[*link].next;
+			}
+		}
+
+		/**
+		 * Schedules timer
+		 *
+		 * @param delay    before first expiry in ms
+		 * @param period   between expiries in ms, 0 for one shot timers
+		 * @param callback to call on expiry
+		 * @param context  passed to callback
+		 * @return timer handle or NO_TIMER if pool is full
+		 */
+		TimerId Scheduler::add(const uint32_t delay, const uint32_t period, TimerCallback callback, void* context) {
+
+			for(uint8_t i = 0; i < MAX_TIMERS; i++) {
+				if(timers[i].active) continue;
+
+				Timer& timer = timers[i];
+				timer.callback = callback;
+				timer.context = context;
+				// run already processed current tick, a timer due in it would only be seen one wheel turn later
+				timer.deadline = std::max<uint64_t>(nowTick() + (delay + TICK - 1) / TICK, currentTick + 1);
+				timer.period = period != 0 ? std::max<uint32_t>(1, period / TICK) : 0;
+				timer.generation++;
+				timer.active = true;
+				link(i);
+
+				return (timer.generation << 8) | (i + 1);
+			}
+
+			LOG_INFO(Scheduler, "add unable to schedule timer, pool of %d timers is full", MAX_TIMERS);
+			return NO_TIMER;
+		}
+
+		/**
+		 * Expires due timers of one slot
+		 *
+		 * @param slot to process
+		 * @param tick processed tick
+		 */
+		void Scheduler::processSlot(const uint8_t slot, const uint64_t tick) {
+
+			// Collect due timers first as callbacks may change slot lists
+			uint8_t due[MAX_TIMERS];
+			uint8_t generations[MAX_TIMERS];
+			uint8_t dueCount = 0;
+
+			for(uint8_t index = slots[slot]; index != NO_INDEX; index = timers[index].next) {
+				if(timers[index].deadline <= tick) {
+					due[dueCount] = index;
+					generations[dueCount++] = timers[index].generation;
+				}
+			}
+
+			for(uint8_t i = 0; i < dueCount; i++) {
+
+				Timer& timer = timers[due[i]];
+				if(!timer.active || timer.generation != generations[i]) continue;
+
+				unlink(due[i]);
+				if(timer.period != 0) {
+					timer.deadline += timer.period;
+					if(timer.deadline <= tick) timer.deadline = tick + timer.period;
+					link(due[i]);
+				}
+				else {
+					timer.active = false;
+				}
+
+				if(timer.callback != NULL) timer.callback(timer.context);
+			}
+		}
+
+	} // namespace Core
+} // namespace CrowOs
@@ -7,18 +7,52 @@
 namespace CrowOs {
 	namespace Core {
 
+		/**
+		 * Gets smallest area containing both areas
+		 *
+		 * @param first  area
+		 * @param second area
+		 * @return union area
+		 */
+		static Rect unite(const Rect& first, const Rect& second) {
+
+			int16_t x = min(first.x, second.x);
+			int16_t y = min(first.y, second.y);
+			Rect rect = {x, y, (int16_t)(max(first.x + first.w, second.x + second.w) - x), (int16_t)(max(first.y + first.h, second.y + second.h) - y)};
+			return rect;
+		}
+
+		/**
+		 * Gets number of unchanged pixels pushed if both areas are merged, negative when they overlap
+		 *
+		 * @param first  area
+		 * @param second area
+		 * @return merge cost in pixels
+		 */
+		static int mergeCost(const Rect& first, const Rect& second) {
+
+			Rect rect = unite(first, second);
+			return rect.w * rect.h - first.w * first.h - second.w * second.h;
+		}
+
 		/**
 		 * Initialise screen
 		 */
 		Screen::Screen()
-			: backgroundColor(TFT_BLACK)
+			: canvas()
+			, dirtyRects()
+			, dirtyRectsCount(0)
+			, pixelsPushed(0)
+			, transfers(0)
+			, textCells()
+			, backgroundColor(TFT_BLACK)
 			, MIN_Y(15)
 			, brightness(10)
-			, m_errorDelay(0)
+			, errorTimer(Scheduler::NO_TIMER)
 			, screenOrientation(SCREEN_NORMAL_PORTRET)
 			, errorMessage("\0") {
 
-			if(LOG_INFO) Serial.println("Info : [Screen] created with backgroundColor = TFT_BLACK, MIN_Y = 16, brightness = 10, screenOrientation = SCREEN_NORMAL_PORTRET");
+			LOG_INFO(Screen, "created with backgroundColor = TFT_BLACK, MIN_Y = 16, brightness = 10, screenOrientation = SCREEN_NORMAL_PORTRET");
 		}
 
 		/**
@@ -26,23 +60,25 @@ namespace CrowOs {
 		 */
 		void Screen::setUp() {
 
-			if(LOG_INFO) Serial.println("Info : [Screen] Setup ...");
-			M5.Axp.ScreenBreath(brightness);
-			M5.Lcd.setRotation(screenOrientation);
+			LOG_INFO(Screen, "Setup ...");
+			Hal::Pmic::setScreenBrightness(brightness);
+			Hal::Display::setRotation(screenOrientation);
+			if(canvas.getWidth() != getMaxX() || canvas.getHeight() != getMaxY()) {
+				if(!canvas.create(getMaxX(), getMaxY())) LOG_INFO(Screen, "Setup unable to allocate canvas");
+			}
 			clearLCD();
-			if(LOG_INFO) Serial.println("Info : [Screen] Setup Done");
+			LOG_INFO(Screen, "Setup Done");
 		}
 
 		/**
 		 * Screen loop method
+		 * Shows error message if any and flushes changed areas to the lcd
 		 */
 		void Screen::loop() {
 
-			unsigned int now = millis();
-
-			if(m_errorDelay > now) {
+			if(Scheduler::isScheduled(errorTimer)) {
 
-				if(LOG_INFO) Serial.printf("Info : [Screen] loop show error message = %s for delay = %d ms\n", errorMessage, m_errorDelay - now);
+				LOG_INFO(Screen, "loop show error message = %s", errorMessage);
 
 				printText(errorMessage, 2, getMaxY() - 8, TFT_BLACK, TFT_RED);
 
@@ -52,14 +88,119 @@ namespace CrowOs {
 					emptyBuff[i] = ' ';
 				}
 				emptyBuff[emptySize - 1] = '\0';
-				M5.Lcd.print(emptyBuff);
+				printText(emptyBuff, canvas.getCursorX(), canvas.getCursorY(), TFT_BLACK, TFT_RED);
 			}
 			else if(errorMessage[0] != '\0') {
 
-				if(LOG_INFO) Serial.printf("Info : [Screen] loop hide error message = %s\n", errorMessage);
+				LOG_INFO(Screen, "loop hide error message = %s", errorMessage);
 				clearText(getMaxXCharacters(), 2, getMaxY() - 8);
 				errorMessage[0] = '\0';
 			}
+
+			flush();
+		}
+
+		/**
+		 * Pushes areas changed since last flush to the lcd
+		 */
+		void Screen::flush() {
+
+			pixelsPushed = 0;
+			transfers = 0;
+			if(canvas.getBuffer() == NULL) return;
+
+			for(short i = 0; i < dirtyRectsCount; i++) {
+				Hal::Display::pushCanvas(canvas, dirtyRects[i].x, dirtyRects[i].y, dirtyRects[i].w, dirtyRects[i].h);
+				pixelsPushed += dirtyRects[i].w * dirtyRects[i].h;
+				transfers++;
+			}
+			dirtyRectsCount = 0;
+
+			LOG_DEBUG(Screen, "flush pixelsPushed = %lu, transfers = %d", pixelsPushed, transfers);
+		}
+
+		/**
+		 * Gets number of pixels pushed to the lcd by last flush
+		 *
+		 * @return pixels pushed by last flush
+		 */
+		unsigned long Screen::getPixelsPushed() const {
+
+			return pixelsPushed;
+		}
+
+		/**
+		 * Gets number of bus transactions done by last flush
+		 *
+		 * @return transactions done by last flush
+		 */
+		short Screen::getTransfers() const {
+
+			return transfers;
+		}
+
+		/**
+		 * Marks screen area as changed so that next flush pushes it
+		 *
+		 * @param x area x position
+		 * @param y area y position
+		 * @param w area width
+		 * @param h area height
+		 */
+		void Screen::markDirty(int x, int y, int w, int h) {
+
+			// Clip to the screen
+			if(x < 0) {
+				w += x;
+				x = 0;
+			}
+			if(y < 0) {
+				h += y;
+				y = 0;
+			}
+			if(x + w > getMaxX()) w = getMaxX() - x;
+			if(y + h > getMaxY()) h = getMaxY() - y;
+			if(w <= 0 || h <= 0) return;
+
+			Rect rect = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+
+			// Absorb every area that is cheaper to push together with the new one
+			for(short i = 0; i < dirtyRectsCount; i++) {
+				if(mergeCost(dirtyRects[i], rect) <= DIRTY_RECT_MERGE_THRESHOLD) {
+					rect = unite(dirtyRects[i], rect);
+					dirtyRects[i] = dirtyRects[--dirtyRectsCount];
+					i = -1;
+				}
+			}
+
+			// No room left so grow the area that costs the least
+			if(dirtyRectsCount == MAX_DIRTY_RECTS) {
+
+				short cheapest = 0;
+				for(short i = 1; i < dirtyRectsCount; i++) {
+					if(mergeCost(dirtyRects[i], rect) < mergeCost(dirtyRects[cheapest], rect)) cheapest = i;
+				}
+				dirtyRects[cheapest] = unite(dirtyRects[cheapest], rect);
+				return;
+			}
+
+			dirtyRects[dirtyRectsCount++] = rect;
+		}
+
+		/**
+		 * Marks area covered by text printed from x, y up to current canvas cursor as changed
+		 *
+		 * @param x text start x position
+		 * @param y text start y position
+		 */
+		void Screen::markTextDirty(const int x, const int y) {
+
+			if(canvas.getCursorY() == y) {
+				markDirty(x, y, canvas.getCursorX() - x, 8);
+			}
+			else {
+				markDirty(0, y, getMaxX(), canvas.getCursorY() - y + 8);
+			}
 		}
 
 		/**
@@ -71,37 +212,40 @@ namespace CrowOs {
 		 * @param textForegroundColor text foreground color
 		 * @param textBackgroundColor text background color if not set than default background color is used
 		 */
-		void Screen::printText(const char* text, const int x, const int y, const uint16_t textForegroundColor, const int textBackgroundColor /* = -1 */) const {
+		void Screen::printText(const char* text, const int x, const int y, const uint16_t textForegroundColor, const int textBackgroundColor /* = -1 */) {
 
 			if(textBackgroundColor != -1) {
-				M5.Lcd.setTextColor(textForegroundColor, textBackgroundColor);
+				canvas.setTextColor(textForegroundColor, textBackgroundColor);
 			}
 			else {
-				M5.Lcd.setTextColor(textForegroundColor, backgroundColor);
+				canvas.setTextColor(textForegroundColor, backgroundColor);
 			}
 
-			M5.Lcd.setCursor(x, y);
-			M5.Lcd.print(text);
-			if(LOG_DEBUG) Serial.printf("Debug : [Screen] printText text = %s at x = %d and y = %d\n", text, x, y);
+			canvas.setCursor(x, y);
+			canvas.print(text);
+			markTextDirty(x, y);
+			LOG_DEBUG(Screen, "printText text = %s at x = %d and y = %d", text, x, y);
 		}
 
 		/**
 		 * Paint screen with background color
 		 */
-		void Screen::clearLCD() const {
+		void Screen::clearLCD() {
 
-			M5.Lcd.fillScreen(backgroundColor);
+			canvas.fillScreen(backgroundColor);
 
 			if(screenOrientation == SCREEN_INVERSED_PORTRET || screenOrientation == SCREEN_NORMAL_PORTRET) {
-				M5.Lcd.fillRect(0, 0, getMaxX(), MIN_Y, TFT_BLACK);
+				canvas.fillRect(0, 0, getMaxX(), MIN_Y, TFT_BLACK);
 			}
 			else {
 
-				M5.Lcd.fillRoundRect(-7, -5, getMaxX() / 3, MIN_Y + 5, 5, TFT_BLACK);
-				M5.Lcd.fillRoundRect((getMaxX() / 3) * 2, -5, getMaxX(), MIN_Y + 5, 5, TFT_BLACK);
+				canvas.fillRoundRect(-7, -5, getMaxX() / 3, MIN_Y + 5, 5, TFT_BLACK);
+				canvas.fillRoundRect((getMaxX() / 3) * 2, -5, getMaxX(), MIN_Y + 5, 5, TFT_BLACK);
 			}
+			markDirty(0, 0, getMaxX(), getMaxY());
+			invalidateTextCells();
 
-			if(LOG_DEBUG) Serial.println("Debug : [Screen] clearLCD");
+			LOG_DEBUG(Screen, "clearLCD");
 		}
 
 		/**
@@ -112,15 +256,15 @@ namespace CrowOs {
 		 * @param y          cursor y position
 		 * @param clearColor color to clear text with
 		 */
-		void Screen::clearText(const int size, const int x, const int y, const int clearColor /* = -1 */) const {
+		void Screen::clearText(const int size, const int x, const int y, const int clearColor /* = -1 */) {
 
 			if(clearColor != -1) {
-				M5.Lcd.setTextColor(clearColor - 1, clearColor);
+				canvas.setTextColor(clearColor - 1, clearColor);
 			}
 			else {
-				M5.Lcd.setTextColor(backgroundColor - 1, backgroundColor);
+				canvas.setTextColor(backgroundColor - 1, backgroundColor);
 			}
-			M5.Lcd.setCursor(x, y);
+			canvas.setCursor(x, y);
 
 			char buff[size];
 			for(int i = 0; i < size - 1; i++) {
@@ -128,8 +272,190 @@ namespace CrowOs {
 			}
 			buff[size - 1] = '\0';
 
-			M5.Lcd.print(buff);
-			if(LOG_DEBUG) Serial.printf("Debug : [Screen] clearText %d characters at x = %d, y = %d\n", size, x, y);
+			canvas.print(buff);
+			markTextDirty(x, y);
+			LOG_DEBUG(Screen, "clearText %d characters at x = %d, y = %d", size, x, y);
+		}
+
+		/**
+		 * Prints text in the text grid, only cells whose glyph or colors changed are rasterized
+		 * Text does not wrap, cells that do not fit the row are dropped
+		 *
+		 * @param text                text to print
+		 * @param column              first cell column
+		 * @param row                 cell row
+		 * @param textForegroundColor text foreground color
+		 * @param textBackgroundColor text background color if not set than default background color is used
+		 * @param size                minimum number of cells written, cells after the text are cleared
+		 */
+		void Screen::printCells(const char* text, const int column, const int row, const uint16_t textForegroundColor, const int textBackgroundColor /* = -1 */, const int size /* = 0 */) {
+
+			// Columns that would make the canvas wrap are not shown
+			int columns = min(getMaxXCharacters(), getMaxX() / TEXT_CELL_WIDTH);
+			if(row < 0 || row >= getMaxYCharacters() || column < 0 || column >= columns) return;
+
+			uint16_t cellBackgroundColor = textBackgroundColor != -1 ? textBackgroundColor : backgroundColor;
+			int textLength = strlen(text);
+			int lastColumn = min(column + max(textLength, size), columns);
+
+			// Changed cells are gathered into runs printed at once
+			char run[columns + 1];
+			int runLength = 0;
+			int runColumn = column;
+			int rasterized = 0;
+
+			for(int i = column; i < lastColumn; i++) {
+
+				char glyph = i - column < textLength ? text[i - column] : ' ';
+				TextCell& cell = textCells[row * getMaxXCharacters() + i];
+				bool changed = cell.glyph != glyph || cell.foregroundColor != textForegroundColor || cell.backgroundColor != cellBackgroundColor;
+
+				if(changed) {
+					if(runLength == 0) runColumn = i;
+					run[runLength++] = glyph;
+					cell.glyph = glyph;
+					cell.foregroundColor = textForegroundColor;
+					cell.backgroundColor = cellBackgroundColor;
+				}
+
+				if(runLength > 0 && (!changed || i == lastColumn - 1)) {
+					run[runLength] = '\0';
+					canvas.setTextColor(textForegroundColor, cellBackgroundColor);
+					canvas.setCursor(runColumn * TEXT_CELL_WIDTH, row * TEXT_CELL_HEIGHT);
+					canvas.print(run);
+					markDirty(runColumn * TEXT_CELL_WIDTH, row * TEXT_CELL_HEIGHT, runLength * TEXT_CELL_WIDTH, TEXT_CELL_HEIGHT);
+					rasterized += runLength;
+					runLength = 0;
+				}
+			}
+
+			LOG_DEBUG(Screen, "printCells text = %s at column = %d and row = %d rasterized %d cells", text, column, row, rasterized);
+		}
+
+		/**
+		 * Clears text grid cells
+		 *
+		 * @param size       number of cells to clear
+		 * @param column     first cell column
+		 * @param row        cell row
+		 * @param clearColor color to clear cells with
+		 */
+		void Screen::clearCells(const int size, const int column, const int row, const int clearColor /* = -1 */) {
+
+			uint16_t color = clearColor != -1 ? clearColor : backgroundColor;
+			printCells("", column, row, color, color, size);
+		}
+
+		/**
+		 * Forgets text grid content so that every cell is rasterized on next print
+		 */
+		void Screen::invalidateTextCells() {
+
+			memset(textCells, 0, sizeof textCells);
+		}
+
+		/**
+		 * Fills rectangle
+		 *
+		 * @param x     rectangle x position
+		 * @param y     rectangle y position
+		 * @param w     rectangle width
+		 * @param h     rectangle height
+		 * @param color to fill with
+		 */
+		void Screen::fillRect(const int x, const int y, const int w, const int h, const uint16_t color) {
+
+			canvas.fillRect(x, y, w, h, color);
+			markDirty(x, y, w, h);
+		}
+
+		/**
+		 * Draws rectangle outline
+		 *
+		 * @param x     rectangle x position
+		 * @param y     rectangle y position
+		 * @param w     rectangle width
+		 * @param h     rectangle height
+		 * @param color to draw with
+		 */
+		void Screen::drawRect(const int x, const int y, const int w, const int h, const uint16_t color) {
+
+			canvas.drawRect(x, y, w, h, color);
+			markDirty(x, y, w, h);
+		}
+
+		/**
+		 * Draws line
+		 *
+		 * @param x0    start x position
+		 * @param y0    start y position
+		 * @param x1    end x position
+		 * @param y1    end y position
+		 * @param color to draw with
+		 */
+		void Screen::drawLine(const int x0, const int y0, const int x1, const int y1, const uint16_t color) {
+
+			canvas.drawLine(x0, y0, x1, y1, color);
+			markDirty(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1);
+		}
+
+		/**
+		 * Draws circle outline
+		 *
+		 * @param x      center x position
+		 * @param y      center y position
+		 * @param radius circle radius
+		 * @param color  to draw with
+		 */
+		void Screen::drawCircle(const int x, const int y, const int radius, const uint16_t color) {
+
+			canvas.drawCircle(x, y, radius, color);
+			markDirty(x - radius, y - radius, 2 * radius + 1, 2 * radius + 1);
+		}
+
+		/**
+		 * Fills circle
+		 *
+		 * @param x      center x position
+		 * @param y      center y position
+		 * @param radius circle radius
+		 * @param color  to fill with
+		 */
+		void Screen::fillCircle(const int x, const int y, const int radius, const uint16_t color) {
+
+			canvas.fillCircle(x, y, radius, color);
+			markDirty(x - radius, y - radius, 2 * radius + 1, 2 * radius + 1);
+		}
+
+		/**
+		 * Draws RGB565 image
+		 *
+		 * @param x    image x position
+		 * @param y    image y position
+		 * @param w    image width
+		 * @param h    image height
+		 * @param data image pixels
+		 */
+		void Screen::pushImage(const int x, const int y, const int w, const int h, const uint16_t* data) {
+
+			canvas.pushImage(x, y, w, h, data);
+			markDirty(x, y, w, h);
+		}
+
+		/**
+		 * Draws RGB565 image skipping transparent pixels
+		 *
+		 * @param x           image x position
+		 * @param y           image y position
+		 * @param w           image width
+		 * @param h           image height
+		 * @param data        image pixels
+		 * @param transparent color that is not drawn
+		 */
+		void Screen::pushImage(const int x, const int y, const int w, const int h, const uint16_t* data, const uint16_t transparent) {
+
+			canvas.pushImage(x, y, w, h, data, transparent);
+			markDirty(x, y, w, h);
 		}
 
 		/**
@@ -142,6 +468,92 @@ namespace CrowOs {
 			backgroundColor = color;
 		}
 
+		/**
+		 * Draws compressed asset decoding it one row at a time
+		 *
+		 * @param x           asset x position
+		 * @param y           asset y position
+		 * @param asset       to draw
+		 * @param transparent color that is not drawn, if not set every pixel is drawn
+		 */
+		void Screen::pushAsset(const int x, const int y, const Asset& asset, const int transparent /* = -1 */) {
+
+			unsigned long start = micros();
+
+			drawAsset(canvas, x, y, asset, transparent);
+			markDirty(x, y, asset.width, asset.height);
+
+			LOG_DEBUG(Screen, "pushAsset name = %s at x = %d, y = %d, flash = %u bytes, decode = %lu us", asset.name, x, y, asset.flashSize, micros() - start);
+		}
+
+		/**
+		 * Draws compressed asset into any canvas decoding it one row at a time
+		 *
+		 * @param target      canvas to draw into
+		 * @param x           asset x position
+		 * @param y           asset y position
+		 * @param asset       to draw
+		 * @param transparent color that is not drawn, if not set every pixel is drawn
+		 */
+		void Screen::drawAsset(Hal::Canvas& target, const int x, const int y, const Asset& asset, const int transparent /* = -1 */) {
+
+			AssetReader reader(asset);
+			uint16_t line[asset.width];
+
+			for(int row = 0; reader.readLine(line); row++) {
+				if(transparent != -1) {
+					target.pushImage(x, y + row, asset.width, 1, line, transparent);
+				}
+				else {
+					target.pushImage(x, y + row, asset.width, 1, line);
+				}
+			}
+		}
+
+		/**
+		 * Draws top left area of an off screen sprite
+		 *
+		 * @param x      sprite x position
+		 * @param y      sprite y position
+		 * @param sprite to draw
+		 * @param w      area width
+		 * @param h      area height
+		 */
+		void Screen::pushSprite(const int x, const int y, const Hal::Canvas& sprite, const int w, const int h) {
+
+			canvas.pushCanvas(x, y, sprite, w, h);
+			markDirty(x, y, w, h);
+		}
+
+		/**
+		 * Prints flash size and decode time of every asset
+		 */
+		void Screen::reportAssets() const {
+
+			if(!LOG_ENABLED(Screen, LOG_LEVEL_INFO)) return;
+
+			uint32_t totalFlash = 0;
+			uint32_t totalRaw = 0;
+
+			for(short i = 0; i < ASSETS_COUNT; i++) {
+
+				const Asset& asset = *ASSETS[i];
+				uint16_t line[asset.width];
+
+				unsigned long start = micros();
+				AssetReader reader(asset);
+				while(reader.readLine(line)) {
+				}
+				unsigned long decodeTime = micros() - start;
+
+				totalFlash += asset.flashSize;
+				totalRaw += 2 * asset.width * asset.height;
+				LOG_INFO(Screen, "reportAssets name = %s, size = %dx%d, raw = %d bytes, flash = %u bytes, decode = %lu us", asset.name, asset.width, asset.height, 2 * asset.width * asset.height, (unsigned int)asset.flashSize, decodeTime);
+			}
+
+			LOG_INFO(Screen, "reportAssets total raw = %u bytes, flash = %u bytes", (unsigned int)totalRaw, (unsigned int)totalFlash);
+		}
+
 		/**
 		 * Shows crow logo
 		 */
@@ -149,8 +561,9 @@ namespace CrowOs {
 
 			clearLCD();
 			setScreenOrientation(SCREEN_NORMAL_PORTRET);
-			M5.Lcd.pushImage(2, 8, 79, 144, res_logo);
-			if(LOG_DEBUG) Serial.println("Debug : [Screen] showLogo at x = 2, y = 8, w = 79, h = 144");
+			pushAsset(2, 8, res_logo);
+			flush();
+			LOG_DEBUG(Screen, "showLogo at x = 2, y = 8, w = 79, h = 144");
 		}
 
 		/**
@@ -162,7 +575,8 @@ namespace CrowOs {
 		void Screen::showError(const char* errorText, const unsigned int errorDelay) {
 
 			strncpy(errorMessage, errorText, getMaxXCharacters());
-			m_errorDelay = millis() + errorDelay;
+			Scheduler::cancel(errorTimer);
+			errorTimer = Scheduler::schedule(errorDelay, NULL, NULL);
 		}
 
 		/**
@@ -172,8 +586,8 @@ namespace CrowOs {
 
 			brightness++;
 			if(brightness > 15) brightness = 7;
-			M5.Axp.ScreenBreath(brightness);
-			if(LOG_DEBUG) Serial.printf("Debug : [Screen] changeBrightness brightness = %d\n", brightness);
+			Hal::Pmic::setScreenBrightness(brightness);
+			LOG_DEBUG(Screen, "changeBrightness brightness = %d", brightness);
 		}
 
 		/**
@@ -241,9 +655,17 @@ namespace CrowOs {
 		void Screen::setScreenOrientation(int orientation) {
 
 			if(orientation == screenOrientation) return;
-			if(LOG_DEBUG) Serial.printf("Debug : [Screen] setScreenOrientation new orientation = %d\n", orientation);
+			LOG_DEBUG(Screen, "setScreenOrientation new orientation = %d", orientation);
 			screenOrientation = orientation;
-			M5.Lcd.setRotation(screenOrientation);
+			Hal::Display::setRotation(screenOrientation);
+
+			// Portrait and landscape need a canvas with swapped dimensions
+			if(canvas.getWidth() != getMaxX() && !canvas.create(getMaxX(), getMaxY())) LOG_INFO(Screen, "setScreenOrientation unable to allocate canvas");
+
+			// Areas from previous orientation are meaningless now
+			dirtyRectsCount = 0;
+			markDirty(0, 0, getMaxX(), getMaxY());
+			invalidateTextCells();
 		}
 
 		/**
@@ -9,11 +9,14 @@ namespace CrowOs {
 
 		/**
 		 * Initialise SmartWifi
+		 *
+		 * @param screenHelper Screen helper used to show wifi icon
 		 */
-		SmartWifi::SmartWifi()
-			: reconnectionTimeOut(30000)
-			, lastReconnectionTime(0) {
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] created with reconnectionTimeOut = 30000");
+		SmartWifi::SmartWifi(Screen* screenHelper)
+			: screen(screenHelper)
+			, reconnectionTimeOut(30000)
+			, reconnectionTimer(Scheduler::NO_TIMER) {
+			LOG_INFO(SmartWifi, "created with reconnectionTimeOut = 30000");
 		}
 
 		/**
@@ -21,12 +24,12 @@ namespace CrowOs {
 		 */
 		void SmartWifi::setUp() {
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] Setup ...");
+			LOG_INFO(SmartWifi, "Setup ...");
 
-			if(M5.BtnA.isPressed()) configure();
+			if(Hal::Buttons::isHomePressed()) configure();
 			connect();
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] Setup Done");
+			LOG_INFO(SmartWifi, "Setup Done");
 		}
 
 		/**
@@ -34,14 +37,15 @@ namespace CrowOs {
 		 */
 		void SmartWifi::connect() {
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] connect ...");
+			LOG_INFO(SmartWifi, "connect ...");
 
-			M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_connecting);
-			WiFi.begin();
+			screen->pushAsset(2, 2, res_wifi_connecting);
+			Hal::Wifi::begin();
 			checkStatus();
-			lastReconnectionTime = millis();
+			Scheduler::cancel(reconnectionTimer);
+			reconnectionTimer = Scheduler::schedule(reconnectionTimeOut, NULL, NULL);
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] connect Done");
+			LOG_INFO(SmartWifi, "connect Done");
 		}
 
 		/**
@@ -49,12 +53,13 @@ namespace CrowOs {
 		 */
 		void SmartWifi::disconnect() {
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] disconnect ...");
+			LOG_INFO(SmartWifi, "disconnect ...");
 
-			WiFi.disconnect(true);
+			HttpService::close();
+			Hal::Wifi::disconnect(true);
 			checkStatus();
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] disconnect Done");
+			LOG_INFO(SmartWifi, "disconnect Done");
 		}
 
 		/**
@@ -62,36 +67,15 @@ namespace CrowOs {
 		 */
 		void SmartWifi::reconnect() {
 
-			if(millis() - lastReconnectionTime >= reconnectionTimeOut) {
-				if(LOG_INFO) Serial.println("Info : [SmartWifi] reconnect ...");
-
-				M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_connecting);
-				WiFi.disconnect();
-				WiFi.reconnect();
-
-				lastReconnectionTime = millis();
-				if(LOG_INFO) Serial.println("Info : [SmartWifi] reconnect Done");
-			}
-		}
-
-		/**
-		 * Wait for connection for 100000 ms than fail
-		 */
-		const bool SmartWifi::waitUntilReconnect() {
-
-			unsigned long now = millis();
+			if(!Scheduler::isScheduled(reconnectionTimer)) {
+				LOG_INFO(SmartWifi, "reconnect ...");
 
-			while(!checkStatus()) {
+				screen->pushAsset(2, 2, res_wifi_connecting);
+				Hal::Wifi::reconnect();
 
-				reconnect();
-				if(millis() - now >= 100000) {
-					if(LOG_INFO) Serial.println("Info : [SmartWifi] waitUntilReconnect failed");
-					return false;
-				}
+				reconnectionTimer = Scheduler::schedule(reconnectionTimeOut, NULL, NULL);
+				LOG_INFO(SmartWifi, "reconnect Done");
 			}
-
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] waitUntilReconnect OK");
-			return true;
 		}
 
 		/**
@@ -101,36 +85,29 @@ namespace CrowOs {
 		 */
 		const bool SmartWifi::checkStatus() {
 
-			if(LOG_DEBUG) {
-				Serial.print("Debug : [SmartWifi] checkStatus SSID = ");
-				Serial.print(WiFi.SSID());
-				Serial.print(" localIpAdress = ");
-				Serial.print(WiFi.localIP());
-				Serial.print(" status = ");
-				Serial.println(WiFi.status());
-			}
+			LOG_DEBUG(SmartWifi, "checkStatus SSID = %s localIpAdress = %s status = %d", Hal::Wifi::ssid().c_str(), Hal::Wifi::localIp().c_str(), Hal::Wifi::status());
 
-			switch(WiFi.status()) {
+			switch(Hal::Wifi::status()) {
 
-			case WL_IDLE_STATUS:
-			case WL_NO_SSID_AVAIL:
-			case WL_SCAN_COMPLETED:
-				M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_connecting);
+			case Hal::WIFI_IDLE:
+			case Hal::WIFI_NO_SSID_AVAILABLE:
+			case Hal::WIFI_SCAN_COMPLETED:
+				screen->pushAsset(2, 2, res_wifi_connecting);
 				return false;
 				break;
 
-			case WL_CONNECTED:
-				M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_connected);
+			case Hal::WIFI_CONNECTED:
+				screen->pushAsset(2, 2, res_wifi_connected);
 				return true;
 				break;
 
-			case WL_DISCONNECTED:
-				M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_disconnected);
+			case Hal::WIFI_DISCONNECTED:
+				screen->pushAsset(2, 2, res_wifi_disconnected);
 				return false;
 				break;
 
 			default:
-				M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_error);
+				screen->pushAsset(2, 2, res_wifi_error);
 				return false;
 				break;
 			}
@@ -141,20 +118,21 @@ namespace CrowOs {
 		 */
 		void SmartWifi::configure() {
 
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] configure ...");
+			LOG_INFO(SmartWifi, "configure ...");
+
+			screen->pushAsset(2, 2, res_wifi_connfiguring);
 
-			M5.Lcd.pushImage(2, 2, 16, 10, res_wifi_connfiguring);
+			Hal::Wifi::beginSmartConfig();
 
-			WiFi.mode(WIFI_STA);
-			WiFi.beginSmartConfig();
+			screen->flush();
 
-			while(!WiFi.smartConfigDone()) {
+			while(!Hal::Wifi::smartConfigDone()) {
 				delay(500);
-				if(LOG_DEBUG) Serial.println("Debug : [SmartWifi] configure sleeped for 500ms");
+				LOG_DEBUG(SmartWifi, "configure sleeped for 500ms");
 			}
 
 			checkStatus();
-			if(LOG_INFO) Serial.println("Info : [SmartWifi] configure Done");
+			LOG_INFO(SmartWifi, "configure Done");
 		}
 
 	} // namespace Core
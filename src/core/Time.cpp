@@ -11,21 +11,15 @@ namespace CrowOs {
 		 * Initialises new Time
 		 *
 		 * @param speepTime time to put device on sleep default 60, 0 for never
-		 * @param maxFps max fps default 25
 		 */
-		Time::Time(const int sleepTime /* = 60 */, const double maxFps /* = 25 */)
-			: sleepTime(sleepTime)
-			, maxFps(maxFps)
-			, limitFpsLastTime(0)
-			, fpsLastTime(0)
-			, frames(0) {
-
-			upTime.Hours = 0;
-			upTime.Minutes = 0;
-			upTime.Seconds = 0;
-			updateLastActiveTime(upTime);
-
-			if(LOG_INFO) Serial.printf("Info : [Time] created with sleepTime = %d, maxFps = %fl\n", sleepTime, maxFps);
+		Time::Time(const int sleepTime /* = 60 */)
+			: clockOffset(0)
+			, rtcSyncTime(0)
+			, rtcSyncSeconds(-1)
+			, lastActiveTime(0)
+			, sleepTime(sleepTime) {
+
+			LOG_INFO(Time, "created with sleepTime = %d", sleepTime);
 		}
 
 		/**
@@ -33,10 +27,10 @@ namespace CrowOs {
 		 */
 		void Time::setUp() {
 
-			if(LOG_INFO) Serial.println("Info : [Time] Setup ...");
-			M5.Rtc.SetTime(&upTime);
-			updateLastActiveTime(upTime);
-			if(LOG_INFO) Serial.println("Info : [Time] Setup Done");
+			LOG_INFO(Time, "Setup ...");
+			syncRtc();
+			keepWokedUp();
+			LOG_INFO(Time, "Setup Done");
 		}
 
 		/**
@@ -46,8 +40,8 @@ namespace CrowOs {
 		 */
 		void Time::keepWokedUp() {
 
-			if(LOG_DEBUG) Serial.println("Debug : [Time] keepWokedUp");
-			updateLastActiveTime(upTime);
+			lastActiveTime = getUpTime();
+			LOG_DEBUG(Time, "keepWokedUp lastActiveTime = %llu ms", (unsigned long long)lastActiveTime);
 		}
 
 		/**
@@ -57,20 +51,31 @@ namespace CrowOs {
 		 */
 		boolean Time::shouldSleep() const {
 
-			if(LOG_DEBUG) Serial.println("Debug : [Time] shouldSleep");
+			LOG_DEBUG(Time, "shouldSleep");
 			if(sleepTime == 0) return false;
-			return convertTimeToSecondes(upTime) - convertTimeToSecondes(lastActiveTime) > sleepTime;
+			return getUpTime() - lastActiveTime > (uint64_t)sleepTime * 1000;
 		}
 
 		/**
-		 * Converts RTC_TimeTypeDef to seconds
+		 * Gets monotonic hardware clock time, 64 bits so it never wraps
+		 * Time during which the clock was stopped is not counted, see getUpTime
 		 *
-		 * @param  time to convert
-		 * @return converted time
+		 * @return microseconds since boot
 		 */
-		int Time::convertTimeToSecondes(const RTC_TimeTypeDef time) const {
+		uint64_t Time::nowUs() const {
 
-			return time.Hours * 3600 + time.Minutes * 60 + time.Seconds;
+			return Hal::Clock::getMicroseconds();
+		}
+
+		/**
+		 * Gets monotonic hardware clock time, 64 bits so it never wraps
+		 * Time during which the clock was stopped is not counted, see getUpTime
+		 *
+		 * @return milliseconds since boot
+		 */
+		uint64_t Time::nowMs() const {
+
+			return nowUs() / 1000;
 		}
 
 		/**
@@ -85,13 +90,14 @@ namespace CrowOs {
 		}
 
 		/**
-		 * Gets time since device is on
+		 * Gets wall-clock time since device is on
+		 * Unlike nowMs it counts time during which the hardware clock was stopped, as measured by rtc
 		 *
-		 * @return devices up time
+		 * @return devices up time in ms
 		 */
-		RTC_TimeTypeDef Time::getUpTime() const {
+		uint64_t Time::getUpTime() const {
 
-			return upTime;
+			return (nowUs() + clockOffset) / 1000;
 		}
 
 		/**
@@ -111,62 +117,52 @@ namespace CrowOs {
 		 */
 		void Time::setSleepTime(const int time) {
 
-			if(LOG_DEBUG) Serial.printf("Debug : [Time] setSleepTime with time = %ds\n", time);
+			LOG_DEBUG(Time, "setSleepTime with time = %ds", time);
 			sleepTime = time;
 		}
 
 		/**
-		 * Limit fps
+		 * Time loop method
+		 * Resyncs the clock with rtc once per RTC_SYNC_PERIOD
 		 */
-		void Time::limitFps() {
-
-			frames++;
-			M5.Rtc.GetTime(&upTime);
-			unsigned long now = micros() / 1000;
-			double maxFrameInterval = 1000 / (maxFps * 0.5); // calculate max time for one frame to execute
-
-			double limitFpsElipsed = now - limitFpsLastTime; // calculate elipsed since last method call
-			limitFpsLastTime = now; // update last method call
-			double limitFpsDelta = floor((maxFrameInterval - limitFpsElipsed) * 0.5); // calculate delta between maxFrameInterval and last method call
-
-			if(limitFpsDelta > 0) {
-				delay(limitFpsDelta);
-				if(LOG_DEBUG) Serial.printf("Debug : [Time] limitFps sleeped for %flms\n", limitFpsDelta);
-			}
-			else if(limitFpsDelta < 0) {
-				if(LOG_DEBUG) Serial.printf("Debug : [Time] limitFps lost frames = %fl\n", -limitFpsDelta / maxFrameInterval);
-			}
-
-			double fpsElipsed = now - fpsLastTime;
-			if(fpsElipsed >= 5000) {
+		void Time::loop() {
 
-				if(LOG_INFO) Serial.printf("Info : [Time] limitFps fps = %fl\n", frames / 5);
-				fpsLastTime = now;
-				frames = 0;
-			}
+			if(getUpTime() - rtcSyncTime >= RTC_SYNC_PERIOD) syncRtc();
 		}
 
 		/**
-		 * Updates last active time
-		 *
-		 * @param newTime to update
+		 * Reads rtc and moves up time forward if rtc went further, for example when the cpu timer was stopped
+		 * Rtc time of day wraps at midnight so it is only compared over one RTC_SYNC_PERIOD
 		 */
-		void Time::updateLastActiveTime(const RTC_TimeTypeDef newTime) {
+		void Time::syncRtc() {
 
-			if(LOG_DEBUG) {
+			RTC_TimeTypeDef rtcTime;
+			Hal::Rtc::getTime(rtcTime);
 
-				char timeString[9];
-				convertTimeToString(newTime, timeString);
+			uint64_t now = getUpTime();
+			long seconds = rtcTime.Hours * 3600L + rtcTime.Minutes * 60L + rtcTime.Seconds;
 
-				char lastActiveTimeString[9];
-				convertTimeToString(lastActiveTime, lastActiveTimeString);
+			if(rtcSyncSeconds != -1) {
 
-				Serial.printf("Debug : [Time] updateLastActiveTime from lastActiveTime = %s with newTime = %s\n", lastActiveTimeString, timeString);
+				long rtcElapsed = (seconds - rtcSyncSeconds + 86400) % 86400;
+				long upTimeElapsed = (now - rtcSyncTime) / 1000;
+
+				if(rtcElapsed - upTimeElapsed > RTC_MAX_DRIFT) {
+					clockOffset += (uint64_t)(rtcElapsed - upTimeElapsed) * 1000000;
+					now = getUpTime();
+					LOG_INFO(Time, "syncRtc upTime moved forward by %ld s", rtcElapsed - upTimeElapsed);
+				}
+			}
+
+			if(LOG_ENABLED(Time, LOG_LEVEL_DEBUG)) {
+
+				char timeString[9];
+				convertTimeToString(rtcTime, timeString);
+				LOG_DEBUG(Time, "syncRtc rtc = %s, now = %llu ms", timeString, (unsigned long long)now);
 			}
 
-			lastActiveTime.Hours = newTime.Hours;
-			lastActiveTime.Minutes = newTime.Minutes;
-			lastActiveTime.Seconds = newTime.Seconds;
+			rtcSyncTime = now;
+			rtcSyncSeconds = seconds;
 		}
 	} // namespace Core
 } // namespace CrowOs
@@ -21,8 +21,9 @@ namespace CrowOs {
 			, port(port)
 			, username(username)
 			, password(password)
-			, basePath(basePath) {
-			if(LOG_INFO) Serial.printf("Info : [WebClient] created host = %s, port = %d, basePath = %s\n", host, port, basePath);
+			, basePath(basePath)
+			, cache() {
+			LOG_INFO(WebClient, "created host = %s, port = %d, basePath = %s", host, port, basePath);
 		}
 
 		/**
@@ -30,27 +31,11 @@ namespace CrowOs {
 		 *
 		 * @param path         path on distinct server ressource
 		 * @param responseBody server response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
 		 * @return status      server status response
 		 */
-		int WebClient::sendGET(const char* path, DynamicJsonDocument& responseBody) {
-
-			char uri[strlen(basePath) + strlen(path)];
-			strcpy(uri, basePath);
-			strcat(uri, path);
-			if(LOG_INFO) Serial.printf("Info : [WebClient] sendGET uri = %s\n", uri);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendGET basePath = %s, path = %s\n", basePath, path);
-
-			http.begin(host, port, uri);
-			addGeneralHeaders();
-
-			int status = http.GET();
-			const char* response = http.getString().c_str();
-			deserializeJson(responseBody, response);
-			http.end();
-
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendGET response = %s, status = %d\n", response, status);
-
-			return status;
+		int WebClient::sendGET(const char* path, JsonDocument& responseBody, const DeserializationOption::Filter* filter /* = NULL */) {
+			return send("GET", path, NULL, responseBody, filter);
 		}
 
 		/**
@@ -59,32 +44,17 @@ namespace CrowOs {
 		 * @param path         path on distinct server ressource
 		 * @param payload      payload to send to server
 		 * @param responseBody server response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
 		 * @return status      server status response
 		 */
-		int WebClient::sendPOST(const char* path, const DynamicJsonDocument payload, DynamicJsonDocument& responseBody) {
-
-			char uri[strlen(basePath) + strlen(path)];
-			strcpy(uri, basePath);
-			strcat(uri, path);
-			if(LOG_INFO) Serial.printf("Info : [WebClient] sendPOST uri = %s\n", uri);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPOST basePath = %s, path = %s\n", basePath, path);
-
-			http.begin(host, port, uri);
-			addGeneralHeaders();
+		int WebClient::sendPOST(const char* path, const JsonDocument& payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter /* = NULL */) {
 
 			int jsonSize = measureJson(payload) + 1;
 			char jsonString[jsonSize];
 			serializeJson(payload, jsonString, jsonSize);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPOST payload = %s\n", jsonString);
-
-			int status = http.POST(jsonString);
-			const char* response = http.getString().c_str();
-			deserializeJson(responseBody, response);
-			http.end();
+			LOG_DEBUG(WebClient, "sendPOST payload = %s", jsonString);
 
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPOST response = %s, status = %d\n", response, status);
-
-			return status;
+			return send("POST", path, jsonString, responseBody, filter);
 		}
 
 		/**
@@ -93,32 +63,17 @@ namespace CrowOs {
 		 * @param path         path on distinct server ressource
 		 * @param payload      payload to send to server
 		 * @param responseBody server response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
 		 * @return status      server status response
 		 */
-		int WebClient::sendPUT(const char* path, const DynamicJsonDocument payload, DynamicJsonDocument& responseBody) {
-
-			char uri[strlen(basePath) + strlen(path)];
-			strcpy(uri, basePath);
-			strcat(uri, path);
-			if(LOG_INFO) Serial.printf("Info : [WebClient] sendPUT uri = %s\n", uri);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPUT basePath = %s, path = %s\n", basePath, path);
-
-			http.begin(host, port, uri);
-			addGeneralHeaders();
+		int WebClient::sendPUT(const char* path, const JsonDocument& payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter /* = NULL */) {
 
 			int jsonSize = measureJson(payload) + 1;
 			char jsonString[jsonSize];
 			serializeJson(payload, jsonString, jsonSize);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPUT payload = %s\n", jsonString);
+			LOG_DEBUG(WebClient, "sendPUT payload = %s", jsonString);
 
-			int status = http.PUT(jsonString);
-			const char* response = http.getString().c_str();
-			deserializeJson(responseBody, response);
-			http.end();
-
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPUT response = %s, status = %d\n", response, status);
-
-			return status;
+			return send("PUT", path, jsonString, responseBody, filter);
 		}
 
 		/**
@@ -127,32 +82,17 @@ namespace CrowOs {
 		 * @param path         path on distinct server ressource
 		 * @param payload      payload to send to server
 		 * @param responseBody server response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
 		 * @return status      server status response
 		 */
-		int WebClient::sendPATCH(const char* path, const DynamicJsonDocument payload, DynamicJsonDocument& responseBody) {
-
-			char uri[strlen(basePath) + strlen(path)];
-			strcpy(uri, basePath);
-			strcat(uri, path);
-			if(LOG_INFO) Serial.printf("Info : [WebClient] sendPATCH uri = %s\n", uri);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPATCH basePath = %s, path = %s\n", basePath, path);
-
-			http.begin(host, port, uri);
-			addGeneralHeaders();
+		int WebClient::sendPATCH(const char* path, const JsonDocument& payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter /* = NULL */) {
 
 			int jsonSize = measureJson(payload) + 1;
 			char jsonString[jsonSize];
 			serializeJson(payload, jsonString, jsonSize);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPATCH payload = %s\n", jsonString);
-
-			int status = http.PATCH(jsonString);
-			const char* response = http.getString().c_str();
-			deserializeJson(responseBody, response);
-			http.end();
-
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendPATCH response = %s, status = %d\n", response, status);
+			LOG_DEBUG(WebClient, "sendPATCH payload = %s", jsonString);
 
-			return status;
+			return send("PATCH", path, jsonString, responseBody, filter);
 		}
 
 		/**
@@ -160,36 +100,150 @@ namespace CrowOs {
 		 *
 		 * @param path         path on distinct server ressource
 		 * @param responseBody server response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
 		 * @return status      server status response
 		 */
-		int WebClient::sendDELETE(const char* path, DynamicJsonDocument& responseBody) {
+		int WebClient::sendDELETE(const char* path, JsonDocument& responseBody, const DeserializationOption::Filter* filter /* = NULL */) {
+			return send("DELETE", path, NULL, responseBody, filter);
+		}
+
+		/**
+		 * Submits GET query to distinct server
+		 *
+		 * @param path     path on distinct server ressource
+		 * @param callback called on main loop with server response
+		 * @param context  passed to callback
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @return request handle or NetworkTask::NO_REQUEST if network queue is full
+		 */
+		RequestId WebClient::submitGET(const char* path, ResponseCallback callback, void* context, const JsonDocument* filter /* = NULL */) {
+			return submit("GET", path, NULL, callback, context, filter);
+		}
+
+		/**
+		 * Submits POST query to distinct server
+		 *
+		 * @param path     path on distinct server ressource
+		 * @param payload  payload to send to server
+		 * @param callback called on main loop with server response
+		 * @param context  passed to callback
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+		 */
+		RequestId WebClient::submitPOST(const char* path, const JsonDocument& payload, ResponseCallback callback, void* context, const JsonDocument* filter /* = NULL */) {
+			return submit("POST", path, &payload, callback, context, filter);
+		}
+
+		/**
+		 * Submits PUT query to distinct server
+		 *
+		 * @param path     path on distinct server ressource
+		 * @param payload  payload to send to server
+		 * @param callback called on main loop with server response
+		 * @param context  passed to callback
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+		 */
+		RequestId WebClient::submitPUT(const char* path, const JsonDocument& payload, ResponseCallback callback, void* context, const JsonDocument* filter /* = NULL */) {
+			return submit("PUT", path, &payload, callback, context, filter);
+		}
 
-			char uri[strlen(basePath) + strlen(path)];
+		/**
+		 * Submits PATCH query to distinct server
+		 *
+		 * @param path     path on distinct server ressource
+		 * @param payload  payload to send to server
+		 * @param callback called on main loop with server response
+		 * @param context  passed to callback
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
+		 */
+		RequestId WebClient::submitPATCH(const char* path, const JsonDocument& payload, ResponseCallback callback, void* context, const JsonDocument* filter /* = NULL */) {
+			return submit("PATCH", path, &payload, callback, context, filter);
+		}
+
+		/**
+		 * Submits DELETE query to distinct server
+		 *
+		 * @param path     path on distinct server ressource
+		 * @param callback called on main loop with server response
+		 * @param context  passed to callback
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @return request handle or NetworkTask::NO_REQUEST if network queue is full
+		 */
+		RequestId WebClient::submitDELETE(const char* path, ResponseCallback callback, void* context, const JsonDocument* filter /* = NULL */) {
+			return submit("DELETE", path, NULL, callback, context, filter);
+		}
+
+		/**
+		 * Forgets cached validators of path so that its next GET returns the body
+		 *
+		 * @param path path on distinct server ressource
+		 */
+		void WebClient::invalidate(const char* path) {
+
+			char uri[strlen(basePath) + strlen(path) + 1];
 			strcpy(uri, basePath);
 			strcat(uri, path);
-			if(LOG_INFO) Serial.printf("Info : [WebClient] sendDELETE uri = %s\n", uri);
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendDELETE basePath = %s, path = %s\n", basePath, path);
-
-			http.begin(host, port, uri);
-			addGeneralHeaders();
+			cache.remove(uri);
+		}
 
-			int status = http.sendRequest("DELETE");
-			const char* response = http.getString().c_str();
-			deserializeJson(responseBody, response);
-			http.end();
+		/**
+		 * Sends query to distinct server
+		 *
+		 * @param method       http method
+		 * @param path         path on distinct server ressource
+		 * @param payload      payload to send to server or NULL
+		 * @param responseBody server response body
+		 * @param filter       keeps only matching fields of response body or NULL to keep everything
+		 * @return status      server status response
+		 */
+		int WebClient::send(const char* method, const char* path, const char* payload, JsonDocument& responseBody, const DeserializationOption::Filter* filter) {
 
-			if(LOG_DEBUG) Serial.printf("Debug : [WebClient] sendDELETE response = %s, status = %d\n", response, status);
+			char uri[strlen(basePath) + strlen(path) + 1];
+			strcpy(uri, basePath);
+			strcat(uri, path);
+			LOG_INFO(WebClient, "send %s uri = %s", method, uri);
+			LOG_DEBUG(WebClient, "send basePath = %s, path = %s", basePath, path);
+
+			int status;
+			if(strcmp(method, "GET") == 0) {
+				HttpCache::Entry cacheEntry = cache.get(uri);
+				status = HttpService::request(method, host, port, uri, username, password, payload, responseBody, filter, &cacheEntry);
+				cache.store(cacheEntry);
+			}
+			else {
+				cache.remove(uri);
+				status = HttpService::request(method, host, port, uri, username, password, payload, responseBody, filter);
+			}
+
+			LOG_DEBUG(WebClient, "send status = %d, memoryUsage = %d", status, (int)responseBody.memoryUsage());
 
 			return status;
 		}
 
 		/**
-		 * Adds general server headers
+		 * Submits query to distinct server on network task
+		 *
+		 * @param method   http method
+		 * @param path     path on distinct server ressource
+		 * @param payload  payload to send to server or NULL
+		 * @param callback called on main loop with server response
+		 * @param context  passed to callback
+		 * @param filter   keeps only matching fields of response body or NULL to keep everything, copied
+		 * @return request handle or NetworkTask::NO_REQUEST if network queue is full or payload is too large
 		 */
-		void WebClient::addGeneralHeaders() {
+		RequestId WebClient::submit(const char* method, const char* path, const JsonDocument* payload, ResponseCallback callback, void* context, const JsonDocument* filter) {
+
+			char uri[strlen(basePath) + strlen(path) + 1];
+			strcpy(uri, basePath);
+			strcat(uri, path);
+			LOG_INFO(WebClient, "submit %s uri = %s", method, uri);
+
+			bool cached = strcmp(method, "GET") == 0;
+			if(!cached) cache.remove(uri);
 
-			http.addHeader("Content-Type", "application/json");
-			http.setAuthorization(username, password);
+			return NetworkTask::submit(method, host, port, uri, username, password, payload, filter, cached ? &cache : NULL, callback, context);
 		}
 
 	} // namespace Core
@@ -0,0 +1,39 @@
+/**
+ * Hardware abstraction layer canvas implementation shared by every backend
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/**
+			 * Copies top left area of another canvas
+			 * Both canvas hold pixels in panel byte order so rows are copied as is
+			 *
+			 * @param x      destination x position
+			 * @param y      destination y position
+			 * @param source canvas to copy from
+			 * @param w      area width
+			 * @param h      area height
+			 */
+			void Canvas::pushCanvas(const int32_t x, const int32_t y, const Canvas& source, const int32_t w, const int32_t h) {
+
+				if(buffer == NULL || source.buffer == NULL) return;
+
+				// Clip area to both canvas
+				int32_t sourceX = x < 0 ? -x : 0;
+				int32_t sourceY = y < 0 ? -y : 0;
+				int32_t copyWidth = std::min(std::min(w, source.width), width - x) - sourceX;
+				int32_t copyHeight = std::min(std::min(h, source.height), height - y) - sourceY;
+				if(copyWidth <= 0 || copyHeight <= 0) return;
+
+				for(int32_t row = 0; row < copyHeight; row++) {
+					memcpy(buffer + (y + sourceY + row) * width + x + sourceX, source.buffer + (sourceY + row) * source.width + sourceX, copyWidth * sizeof(uint16_t));
+				}
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
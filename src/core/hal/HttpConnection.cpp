@@ -0,0 +1,190 @@
+/**
+ * Hardware abstraction layer http response body decoding shared by every backend
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			const char* HttpConnection::COLLECTED_HEADERS[HttpConnection::COLLECTED_HEADERS_SIZE] = {"Transfer-Encoding", "ETag", "Last-Modified", "Cache-Control"};
+
+			/**
+			 * Reads one byte from connection through receive buffer
+			 *
+			 * @return read byte or -1 if connection was closed or timed out
+			 */
+			int HttpConnection::readRaw() {
+
+				if(bufferPosition == bufferLength) {
+					bufferPosition = 0;
+					bufferLength = receive(buffer, BUFFER_SIZE);
+					if(bufferLength == 0) return -1;
+				}
+
+				return (unsigned char)buffer[bufferPosition++];
+			}
+
+			/**
+			 * Reads one CRLF terminated line from connection
+			 *
+			 * @param line filled with line content without CRLF
+			 * @return true if a whole line was read
+			 */
+			bool HttpConnection::readLine(String& line) {
+
+				line = "";
+
+				int c;
+				while((c = readRaw()) >= 0) {
+					if(c == '\n') return true;
+					if(c != '\r') line += (char)c;
+				}
+
+				return false;
+			}
+
+			/**
+			 * Starts reading response body
+			 *
+			 * @param length  body length, -1 if unknown
+			 * @param chunked true if body uses chunked transfer encoding
+			 */
+			void HttpConnection::beginBody(const int32_t length, const bool chunked) {
+
+				this->chunked = chunked;
+				bodyRemaining = chunked ? 0 : length;
+				bodyComplete = false;
+				bodyStartTime = Clock::getMicroseconds();
+
+				if(!chunked && length == 0) completeBody();
+			}
+
+			/**
+			 * Reads next chunk size line
+			 *
+			 * @return true if a chunk with data follows
+			 */
+			bool HttpConnection::nextChunk() {
+
+				String line;
+
+				// data of previous chunk is followed by CRLF
+				if(!readLine(line)) return false;
+				if(line.length() == 0 && !readLine(line)) return false;
+
+				bodyRemaining = strtol(line.c_str(), NULL, 16);
+				if(bodyRemaining > 0) return true;
+
+				// last chunk, skip trailers up to the empty line
+				while(readLine(line) && line.length() > 0) {
+				}
+				completeBody();
+				return false;
+			}
+
+			/**
+			 * Marks body as read and stores transfer time
+			 */
+			void HttpConnection::completeBody() {
+
+				bodyComplete = true;
+				timings.transfer = Clock::getMicroseconds() - bodyStartTime;
+			}
+
+			/**
+			 * Reads and drops what is left of the body
+			 *
+			 * @return true if whole body was read
+			 */
+			bool HttpConnection::skipBody() {
+
+				char drop[32];
+				while(!bodyComplete && readBytes(drop, sizeof drop) > 0) {
+				}
+				return bodyComplete;
+			}
+
+			/**
+			 * Reads one byte of response body
+			 *
+			 * @return read byte or -1 at end of body
+			 */
+			int HttpConnection::read() {
+
+				char c;
+				return readBytes(&c, 1) == 1 ? (unsigned char)c : -1;
+			}
+
+			/**
+			 * Reads response body
+			 *
+			 * @param data   to fill
+			 * @param length maximum number of bytes to read
+			 * @return number of read bytes, less than length only at end of body
+			 */
+			size_t HttpConnection::readBytes(char* data, const size_t length) {
+
+				size_t count = 0;
+
+				while(count < length && !bodyComplete) {
+
+					if(chunked && bodyRemaining == 0 && !nextChunk()) break;
+
+					// copy straight from receive buffer, refill it when empty
+					if(bufferPosition == bufferLength) {
+						bufferPosition = 0;
+						bufferLength = receive(buffer, BUFFER_SIZE);
+						if(bufferLength == 0) {
+							// connection closed, that is the end of a body without length
+							if(!chunked && bodyRemaining < 0) completeBody();
+							break;
+						}
+					}
+
+					size_t available = std::min(bufferLength - bufferPosition, length - count);
+					if(bodyRemaining >= 0) available = std::min(available, (size_t)bodyRemaining);
+
+					memcpy(data + count, buffer + bufferPosition, available);
+					bufferPosition += available;
+					count += available;
+
+					if(bodyRemaining >= 0) {
+						bodyRemaining -= available;
+						if(!chunked && bodyRemaining == 0) completeBody();
+					}
+				}
+
+				return count;
+			}
+
+			/**
+			 * Reads whole response body
+			 *
+			 * @return response body
+			 */
+			String HttpConnection::getString() {
+
+				String response;
+				char data[65];
+				size_t count;
+				while((count = readBytes(data, sizeof data - 1)) > 0) {
+					data[count] = '\0';
+					response += data;
+				}
+				return response;
+			}
+
+			/**
+			 * Gets timings of last request
+			 *
+			 * @return timings of last request
+			 */
+			const HttpTimings& HttpConnection::getTimings() const {
+				return timings;
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
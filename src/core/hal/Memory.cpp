@@ -0,0 +1,25 @@
+/**
+ * Hardware abstraction layer heap statistics shared by every backend
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/**
+			 * Gets heap fragmentation, share of free heap that is not in the largest free block
+			 *
+			 * @return fragmentation in percent
+			 */
+			uint8_t Memory::getFragmentation() {
+
+				uint32_t heapFree = getHeapFree();
+				if(heapFree == 0) return 0;
+				return 100 - (uint8_t)((uint64_t)min(getLargestFreeBlock(), heapFree) * 100 / heapFree);
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,243 @@
+/**
+ * Hardware abstraction layer esp32 canvas implementation
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/**
+			 * Initialise empty canvas
+			 */
+			Canvas::Canvas()
+				: buffer(NULL)
+				, width(0)
+				, height(0)
+				, sprite(&M5.Lcd) {
+			}
+
+			/**
+			 * Frees canvas pixels
+			 */
+			Canvas::~Canvas() {
+				if(buffer != NULL) sprite.deleteSprite();
+			}
+
+			/**
+			 * Allocates canvas pixels, previous content is lost
+			 *
+			 * @param width  canvas width
+			 * @param height canvas height
+			 * @return true if pixels are allocated
+			 */
+			bool Canvas::create(const int32_t width, const int32_t height) {
+
+				if(buffer != NULL) sprite.deleteSprite();
+
+				sprite.setColorDepth(16);
+				buffer = (uint16_t*)sprite.createSprite(width, height);
+				this->width = buffer != NULL ? width : 0;
+				this->height = buffer != NULL ? height : 0;
+
+				return buffer != NULL;
+			}
+
+			/**
+			 * Gets canvas width
+			 *
+			 * @return canvas width
+			 */
+			int32_t Canvas::getWidth() const {
+				return width;
+			}
+
+			/**
+			 * Gets canvas height
+			 *
+			 * @return canvas height
+			 */
+			int32_t Canvas::getHeight() const {
+				return height;
+			}
+
+			/**
+			 * Gets canvas pixels
+			 *
+			 * @return canvas pixels in panel byte order or NULL if canvas is not created
+			 */
+			const uint16_t* Canvas::getBuffer() const {
+				return buffer;
+			}
+
+			/**
+			 * Gets text cursor x position
+			 *
+			 * @return cursor x position
+			 */
+			int32_t Canvas::getCursorX() {
+				return sprite.getCursorX();
+			}
+
+			/**
+			 * Gets text cursor y position
+			 *
+			 * @return cursor y position
+			 */
+			int32_t Canvas::getCursorY() {
+				return sprite.getCursorY();
+			}
+
+			/**
+			 * Fills whole canvas with color
+			 *
+			 * @param color to fill with
+			 */
+			void Canvas::fillScreen(const uint16_t color) {
+				sprite.fillSprite(color);
+			}
+
+			/**
+			 * Fills rectangle
+			 *
+			 * @param x     rectangle x position
+			 * @param y     rectangle y position
+			 * @param w     rectangle width
+			 * @param h     rectangle height
+			 * @param color to fill with
+			 */
+			void Canvas::fillRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t color) {
+				sprite.fillRect(x, y, w, h, color);
+			}
+
+			/**
+			 * Fills rounded rectangle
+			 *
+			 * @param x      rectangle x position
+			 * @param y      rectangle y position
+			 * @param w      rectangle width
+			 * @param h      rectangle height
+			 * @param radius corner radius
+			 * @param color  to fill with
+			 */
+			void Canvas::fillRoundRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const int32_t radius, const uint16_t color) {
+				sprite.fillRoundRect(x, y, w, h, radius, color);
+			}
+
+			/**
+			 * Draws rectangle outline
+			 *
+			 * @param x     rectangle x position
+			 * @param y     rectangle y position
+			 * @param w     rectangle width
+			 * @param h     rectangle height
+			 * @param color to draw with
+			 */
+			void Canvas::drawRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t color) {
+				sprite.drawRect(x, y, w, h, color);
+			}
+
+			/**
+			 * Draws line
+			 *
+			 * @param x0    start x position
+			 * @param y0    start y position
+			 * @param x1    end x position
+			 * @param y1    end y position
+			 * @param color to draw with
+			 */
+			void Canvas::drawLine(const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1, const uint16_t color) {
+				sprite.drawLine(x0, y0, x1, y1, color);
+			}
+
+			/**
+			 * Draws circle outline
+			 *
+			 * @param x      center x position
+			 * @param y      center y position
+			 * @param radius circle radius
+			 * @param color  to draw with
+			 */
+			void Canvas::drawCircle(const int32_t x, const int32_t y, const int32_t radius, const uint16_t color) {
+				sprite.drawCircle(x, y, radius, color);
+			}
+
+			/**
+			 * Fills circle
+			 *
+			 * @param x      center x position
+			 * @param y      center y position
+			 * @param radius circle radius
+			 * @param color  to fill with
+			 */
+			void Canvas::fillCircle(const int32_t x, const int32_t y, const int32_t radius, const uint16_t color) {
+				sprite.fillCircle(x, y, radius, color);
+			}
+
+			/**
+			 * Draws RGB565 image
+			 *
+			 * @param x    image x position
+			 * @param y    image y position
+			 * @param w    image width
+			 * @param h    image height
+			 * @param data image pixels
+			 */
+			void Canvas::pushImage(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t* data) {
+				sprite.pushImage(x, y, w, h, data);
+			}
+
+			/**
+			 * Draws RGB565 image skipping transparent pixels
+			 * Sprite has no transparent image copy so pixels are drawn one by one, it stays in ram
+			 *
+			 * @param x           image x position
+			 * @param y           image y position
+			 * @param w           image width
+			 * @param h           image height
+			 * @param data        image pixels
+			 * @param transparent color that is not drawn
+			 */
+			void Canvas::pushImage(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t* data, const uint16_t transparent) {
+
+				for(int32_t j = 0; j < h; j++) {
+					for(int32_t i = 0; i < w; i++) {
+						uint16_t color = pgm_read_word(&data[j * w + i]);
+						if(color != transparent) sprite.drawPixel(x + i, y + j, color);
+					}
+				}
+			}
+
+			/**
+			 * Sets text colors
+			 *
+			 * @param foregroundColor text foreground color
+			 * @param backgroundColor text background color
+			 */
+			void Canvas::setTextColor(const uint16_t foregroundColor, const uint16_t backgroundColor) {
+				sprite.setTextColor(foregroundColor, backgroundColor);
+			}
+
+			/**
+			 * Sets text cursor
+			 *
+			 * @param x cursor x position
+			 * @param y cursor y position
+			 */
+			void Canvas::setCursor(const int32_t x, const int32_t y) {
+				sprite.setCursor(x, y);
+			}
+
+			/**
+			 * Prints text at cursor position wrapping at canvas width
+			 *
+			 * @param text to print
+			 */
+			void Canvas::print(const char* text) {
+				sprite.print(text);
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,698 @@
+/**
+ * Hardware abstraction layer esp32 implementation
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+// Lib includes
+#include <Preferences.h>
+#include "driver/gpio.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/** AXP192 IRQ line, low while a PMIC interrupt is pending */
+			static const uint8_t PMIC_IRQ_PIN = 35;
+
+			/** Main loop task, notified by Idle::wake */
+			static TaskHandle_t mainTask = NULL;
+
+			/** Called when a wake source fires */
+			static void (*wakeHandler)(const WakeSource source) = NULL;
+
+			/** Guards data shared between main loop and interrupts */
+			static portMUX_TYPE idleLock = portMUX_INITIALIZER_UNLOCKED;
+
+			/** Http response read timeout in ms */
+			static const uint32_t HTTP_TIMEOUT = 5000;
+
+			/** NVS namespace of Storage */
+			static Preferences preferences;
+
+			/**
+			 * Home and up buttons gpio interrupt
+			 */
+			static void IRAM_ATTR onButtonInterrupt() {
+				if(wakeHandler != NULL) wakeHandler(WAKE_BUTTON);
+			}
+
+			/**
+			 * PMIC irq line interrupt
+			 */
+			static void IRAM_ATTR onPmicInterrupt() {
+				if(wakeHandler != NULL) wakeHandler(WAKE_POWER_BUTTON);
+			}
+
+			/**
+			 * Arms gpio as light sleep wake up source, pins that are already low are skipped so that they can not wake the device in loop
+			 *
+			 * @param pin to arm
+			 */
+			static void enableGpioWakeup(const uint8_t pin) {
+				if(digitalRead(pin) == HIGH) gpio_wakeup_enable((gpio_num_t)pin, GPIO_INTR_LOW_LEVEL);
+			}
+
+			/**
+			 * Restores gpio edge interrupt replaced by light sleep level wake up
+			 *
+			 * @param pin      to restore
+			 * @param intrType edge interrupt type
+			 */
+			static void disableGpioWakeup(const uint8_t pin, const gpio_int_type_t intrType) {
+				gpio_wakeup_disable((gpio_num_t)pin);
+				gpio_set_intr_type((gpio_num_t)pin, intrType);
+			}
+
+			/**
+			 * Initialise the board
+			 */
+			void begin() {
+				M5.begin();
+			}
+
+			/**
+			 * Initialise display
+			 */
+			void Display::begin() {
+				M5.Lcd.setSwapBytes(true);
+			}
+
+			/**
+			 * Sets display rotation
+			 *
+			 * @param rotation to set
+			 */
+			void Display::setRotation(const uint8_t rotation) {
+				M5.Lcd.setRotation(rotation);
+			}
+
+			/**
+			 * Pushes canvas area at the same position on the display in one bus transaction
+			 *
+			 * @param canvas to push from, must have the display size for current rotation
+			 * @param x      area x position
+			 * @param y      area y position
+			 * @param w      area width
+			 * @param h      area height
+			 */
+			void Display::pushCanvas(const Canvas& canvas, const int32_t x, const int32_t y, const int32_t w, const int32_t h) {
+
+				uint16_t* pixels = (uint16_t*)canvas.getBuffer() + y * canvas.getWidth() + x;
+
+				M5.Lcd.startWrite();
+				M5.Lcd.setWindow(x, y, x + w - 1, y + h - 1);
+
+				// Canvas already holds panel byte order so no swap is needed
+				if(w == canvas.getWidth()) {
+					M5.Lcd.pushColors(pixels, w * h, false);
+				}
+				else {
+					for(int32_t row = 0; row < h; row++) {
+						M5.Lcd.pushColors(pixels + row * canvas.getWidth(), w, false);
+					}
+				}
+
+				M5.Lcd.endWrite();
+			}
+
+			/**
+			 * Initialise power management
+			 */
+			void Pmic::begin() {
+				M5.Axp.begin();
+			}
+
+			/**
+			 * Sets screen back light brightness
+			 *
+			 * @param brightness between 7 and 15
+			 */
+			void Pmic::setScreenBrightness(const uint8_t brightness) {
+				M5.Axp.ScreenBreath(brightness);
+			}
+
+			/**
+			 * Gets battery voltage
+			 *
+			 * @return battery voltage in V
+			 */
+			float Pmic::getBatteryVoltage() {
+				return M5.Axp.GetBatVoltage();
+			}
+
+			/**
+			 * Gets battery current
+			 *
+			 * @return battery current in mA, positive while charging
+			 */
+			float Pmic::getBatteryCurrent() {
+				return M5.Axp.GetBatCurrent();
+			}
+
+			/**
+			 * Gets and clears last power button event
+			 *
+			 * @return power button event
+			 */
+			PowerButtonEvent Pmic::getPowerButtonEvent() {
+				return (PowerButtonEvent)M5.Axp.GetBtnPress();
+			}
+
+			/**
+			 * Puts screen and peripherals on sleep
+			 */
+			void Pmic::sleep() {
+				M5.Axp.SetSleep();
+			}
+
+			/**
+			 * Powers the device off
+			 */
+			void Pmic::powerOff() {
+				M5.Axp.PowerOff();
+			}
+
+			/**
+			 * Sets rtc time
+			 *
+			 * @param time to set
+			 */
+			void Rtc::setTime(const RTC_TimeTypeDef& time) {
+				RTC_TimeTypeDef newTime = time;
+				M5.Rtc.SetTime(&newTime);
+			}
+
+			/**
+			 * Gets rtc time
+			 *
+			 * @param time to store into
+			 */
+			void Rtc::getTime(RTC_TimeTypeDef& time) {
+				M5.Rtc.GetTime(&time);
+			}
+
+			/**
+			 * Initialise imu
+			 */
+			void Imu::begin() {
+				M5.MPU6886.Init();
+			}
+
+			/**
+			 * Gets accelerometer data
+			 *
+			 * @param x acceleration on x axis in g
+			 * @param y acceleration on y axis in g
+			 * @param z acceleration on z axis in g
+			 */
+			void Imu::getAccelData(float* x, float* y, float* z) {
+				M5.MPU6886.getAccelData(x, y, z);
+			}
+
+			/**
+			 * Reads analog pin
+			 *
+			 * @param pin to read
+			 * @return 12 bits value
+			 */
+			int Adc::read(const uint8_t pin) {
+				return analogRead(pin);
+			}
+
+			/**
+			 * Polls button sources that are not plain gpio
+			 */
+			void Buttons::poll() {
+				// Home and up buttons are read by OneButton directly from gpio
+			}
+
+			/**
+			 * Indicates if home button is actually pressed
+			 *
+			 * @return true if home button is pressed
+			 */
+			bool Buttons::isHomePressed() {
+				return M5.BtnA.isPressed();
+			}
+
+			/**
+			 * Gets time since boot from the cpu timer, never wraps and costs no bus transaction
+			 *
+			 * @return microseconds since boot
+			 */
+			uint64_t Clock::getMicroseconds() {
+				return esp_timer_get_time();
+			}
+
+			/**
+			 * Gets cpu cycle counter, wraps around so only differences are meaningful
+			 *
+			 * @return cycle counter
+			 */
+			uint32_t Cpu::getCycleCount() {
+				return ESP.getCycleCount();
+			}
+
+			/**
+			 * Gets number of cycles per microsecond
+			 *
+			 * @return cycles per microsecond
+			 */
+			uint32_t Cpu::getCyclesPerMicrosecond() {
+				return ESP.getCpuFreqMHz();
+			}
+
+			/**
+			 * Gets number of allocated heap bytes
+			 *
+			 * @return allocated heap bytes
+			 */
+			uint32_t Memory::getHeapUsed() {
+				return ESP.getHeapSize() - ESP.getFreeHeap();
+			}
+
+			/**
+			 * Gets number of free heap bytes
+			 *
+			 * @return free heap bytes
+			 */
+			uint32_t Memory::getHeapFree() {
+				return ESP.getFreeHeap();
+			}
+
+			/**
+			 * Gets largest block that can be allocated, approximated natively by the free space at top of the heap
+			 *
+			 * @return largest free block in bytes
+			 */
+			uint32_t Memory::getLargestFreeBlock() {
+				return ESP.getMaxAllocHeap();
+			}
+
+			/**
+			 * Opens storage
+			 *
+			 * @return true if storage is usable
+			 */
+			bool Storage::begin() {
+				return preferences.begin("crowos", false);
+			}
+
+			/**
+			 * Gets value length
+			 *
+			 * @param key value key
+			 * @return value length in bytes, 0 if key does not exist
+			 */
+			size_t Storage::getLength(const char* key) {
+				return preferences.isKey(key) ? preferences.getBytesLength(key) : 0;
+			}
+
+			/**
+			 * Reads value
+			 *
+			 * @param key    value key
+			 * @param data   to fill
+			 * @param length maximum number of bytes to read
+			 * @return number of read bytes, 0 if key does not exist
+			 */
+			size_t Storage::read(const char* key, void* data, const size_t length) {
+				return preferences.isKey(key) ? preferences.getBytes(key, data, length) : 0;
+			}
+
+			/**
+			 * Writes value, replaces previous one
+			 *
+			 * @param key    value key
+			 * @param data   to write
+			 * @param length number of bytes to write
+			 * @return true if value is written
+			 */
+			bool Storage::write(const char* key, const void* data, const size_t length) {
+				return preferences.putBytes(key, data, length) == length;
+			}
+
+			/**
+			 * Removes value
+			 *
+			 * @param key value key
+			 */
+			void Storage::remove(const char* key) {
+				if(preferences.isKey(key)) preferences.remove(key);
+			}
+
+			/**
+			 * Removes every value
+			 */
+			void Storage::clear() {
+				preferences.clear();
+			}
+
+			/**
+			 * Starts function in a new task
+			 *
+			 * @param function  task body, must never return
+			 * @param parameter passed to function
+			 * @param name      task name
+			 * @param stackSize task stack size in bytes
+			 * @param priority  task priority, main loop runs at 1, ignored natively
+			 * @param core      core the task is pinned to, main loop runs on core 1, ignored natively
+			 * @return true if task is started
+			 */
+			bool Task::start(void (*function)(void*), void* parameter, const char* name, const uint32_t stackSize, const uint8_t priority, const uint8_t core) {
+				return xTaskCreatePinnedToCore(function, name, stackSize, parameter, priority, NULL, core) == pdPASS;
+			}
+
+			/**
+			 * Arms wake sources, must be called from the main loop task
+			 *
+			 * @param handler called from interrupt context on device when a wake source fires
+			 */
+			void Idle::begin(void (*handler)(const WakeSource source)) {
+
+				mainTask = xTaskGetCurrentTaskHandle();
+				wakeHandler = handler;
+
+				attachInterrupt(BUTTON_A_PIN, onButtonInterrupt, CHANGE);
+				attachInterrupt(BUTTON_B_PIN, onButtonInterrupt, CHANGE);
+				pinMode(PMIC_IRQ_PIN, INPUT);
+				attachInterrupt(PMIC_IRQ_PIN, onPmicInterrupt, FALLING);
+			}
+
+			/**
+			 * Blocks main loop until wake is called or timeout expires
+			 * Blocking lets the idle task halt the cpu, light sleep also stops clocks until a timer or gpio wakes the device
+			 *
+			 * @param timeout    maximum time to block in ms
+			 * @param lightSleep if true device light sleeps, only allowed while wifi is off as light sleep drops the association
+			 * @return true if woken before timeout
+			 */
+			bool Idle::wait(const uint32_t timeout, const bool lightSleep) {
+
+				if(!lightSleep) return ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout)) > 0;
+				if(ulTaskNotifyTake(pdTRUE, 0) > 0) return true;
+
+				// Uart is stopped during light sleep
+				Serial.flush();
+
+				enableGpioWakeup(BUTTON_A_PIN);
+				enableGpioWakeup(BUTTON_B_PIN);
+				enableGpioWakeup(PMIC_IRQ_PIN);
+				esp_sleep_enable_gpio_wakeup();
+				esp_sleep_enable_timer_wakeup((uint64_t)timeout * 1000);
+
+				esp_light_sleep_start();
+
+				bool woken = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+				esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+				disableGpioWakeup(BUTTON_A_PIN, GPIO_INTR_ANYEDGE);
+				disableGpioWakeup(BUTTON_B_PIN, GPIO_INTR_ANYEDGE);
+				disableGpioWakeup(PMIC_IRQ_PIN, GPIO_INTR_NEGEDGE);
+
+				// Edges are not latched during light sleep so the wake source is reported here
+				if(woken && wakeHandler != NULL) wakeHandler(digitalRead(PMIC_IRQ_PIN) == LOW ? WAKE_POWER_BUTTON : WAKE_BUTTON);
+
+				return ulTaskNotifyTake(pdTRUE, 0) > 0 || woken;
+			}
+
+			/**
+			 * Wakes main loop, callable from interrupts and other tasks
+			 */
+			void IRAM_ATTR Idle::wake() {
+
+				if(mainTask == NULL) return;
+
+				if(xPortInIsrContext()) {
+					BaseType_t higherPriorityTaskWoken = pdFALSE;
+					vTaskNotifyGiveFromISR(mainTask, &higherPriorityTaskWoken);
+					if(higherPriorityTaskWoken) portYIELD_FROM_ISR();
+				}
+				else {
+					xTaskNotifyGive(mainTask);
+				}
+			}
+
+			/**
+			 * Enters critical section shared with interrupts
+			 */
+			void IRAM_ATTR Idle::lock() {
+
+				if(xPortInIsrContext()) {
+					portENTER_CRITICAL_ISR(&idleLock);
+				}
+				else {
+					portENTER_CRITICAL(&idleLock);
+				}
+			}
+
+			/**
+			 * Leaves critical section shared with interrupts
+			 */
+			void IRAM_ATTR Idle::unlock() {
+
+				if(xPortInIsrContext()) {
+					portEXIT_CRITICAL_ISR(&idleLock);
+				}
+				else {
+					portEXIT_CRITICAL(&idleLock);
+				}
+			}
+
+			/**
+			 * Connects using stored credentials
+			 */
+			void Wifi::begin() {
+				WiFi.begin();
+			}
+
+			/**
+			 * Starts smart config
+			 */
+			void Wifi::beginSmartConfig() {
+				WiFi.mode(WIFI_STA);
+				WiFi.beginSmartConfig();
+			}
+
+			/**
+			 * Indicates if smart config is done
+			 *
+			 * @return true if smart config is done
+			 */
+			bool Wifi::smartConfigDone() {
+				return WiFi.smartConfigDone();
+			}
+
+			/**
+			 * Reconnects to the access point
+			 */
+			void Wifi::reconnect() {
+				WiFi.disconnect();
+				WiFi.reconnect();
+			}
+
+			/**
+			 * Disconnects from the access point
+			 *
+			 * @param wifiOff if true wifi radio is turned off
+			 */
+			void Wifi::disconnect(const bool wifiOff /* = false */) {
+				WiFi.disconnect(wifiOff);
+			}
+
+			/**
+			 * Gets connection status
+			 *
+			 * @return connection status
+			 */
+			WifiStatus Wifi::status() {
+
+				switch(WiFi.status()) {
+
+				case WL_IDLE_STATUS:
+					return WIFI_IDLE;
+
+				case WL_NO_SSID_AVAIL:
+					return WIFI_NO_SSID_AVAILABLE;
+
+				case WL_SCAN_COMPLETED:
+					return WIFI_SCAN_COMPLETED;
+
+				case WL_CONNECTED:
+					return WIFI_CONNECTED;
+
+				case WL_DISCONNECTED:
+					return WIFI_DISCONNECTED;
+
+				default:
+					return WIFI_ERROR;
+				}
+			}
+
+			/**
+			 * Gets connected network SSID
+			 *
+			 * @return SSID
+			 */
+			String Wifi::ssid() {
+				return WiFi.SSID();
+			}
+
+			/**
+			 * Gets local ip address
+			 *
+			 * @return local ip address
+			 */
+			String Wifi::localIp() {
+				return WiFi.localIP().toString();
+			}
+
+			/**
+			 * Initialise new http connection
+			 */
+			HttpConnection::HttpConnection()
+				: connectedHost()
+				, connectedPort(0)
+				, timings()
+				, bufferPosition(0)
+				, bufferLength(0)
+				, bodyRemaining(0)
+				, chunked(false)
+				, bodyComplete(true)
+				, bodyStartTime(0) {
+
+				http.setReuse(true);
+				http.collectHeaders(COLLECTED_HEADERS, COLLECTED_HEADERS_SIZE);
+			}
+
+			/**
+			 * Prepares request
+			 *
+			 * @param host to connect to
+			 * @param port to connect to
+			 * @param uri  to request
+			 * @return true if request is prepared
+			 */
+			bool HttpConnection::begin(const char* host, const uint16_t port, const char* uri) {
+
+				timings = HttpTimings();
+				bufferPosition = 0;
+				bufferLength = 0;
+				beginBody(0, false);
+
+				if(client.connected() && (connectedHost != host || connectedPort != port)) close();
+
+				// connect ourselves so that connect time is not hidden inside sendRequest, HTTPClient reuses connected client
+				timings.reused = client.connected();
+				if(!timings.reused) {
+					uint64_t startTime = Clock::getMicroseconds();
+					if(!client.connect(host, port)) return false;
+					timings.connect = Clock::getMicroseconds() - startTime;
+					connectedHost = host;
+					connectedPort = port;
+				}
+
+				return http.begin(client, host, port, uri);
+			}
+
+			/**
+			 * Adds request header
+			 *
+			 * @param name  header name
+			 * @param value header value
+			 */
+			void HttpConnection::addHeader(const char* name, const char* value) {
+				http.addHeader(name, value);
+			}
+
+			/**
+			 * Sets basic authorization
+			 *
+			 * @param username server username
+			 * @param password server password
+			 */
+			void HttpConnection::setAuthorization(const char* username, const char* password) {
+				http.setAuthorization(username, password);
+			}
+
+			/**
+			 * Sends request and receives response headers
+			 *
+			 * @param method  http method
+			 * @param payload request body or NULL
+			 * @return http status or negative value on connection error
+			 */
+			int HttpConnection::sendRequest(const char* method, const char* payload /* = NULL */) {
+
+				uint64_t startTime = Clock::getMicroseconds();
+
+				// HTTPClient returns once response headers are parsed, body is left in client for read
+				int status = payload == NULL ? http.sendRequest(method) : http.sendRequest(method, (uint8_t*)payload, strlen(payload));
+				timings.firstByte = Clock::getMicroseconds() - startTime;
+
+				if(status < 0) {
+					close();
+					return status;
+				}
+
+				bool chunkedBody = strstr(http.header("Transfer-Encoding").c_str(), "chunked") != NULL;
+				if(strcmp(method, "HEAD") == 0 || status == 204 || status == 304) beginBody(0, false);
+				else beginBody(http.getSize(), chunkedBody);
+
+				return status;
+			}
+
+			/**
+			 * Gets response header, only Transfer-Encoding, ETag, Last-Modified and Cache-Control are kept
+			 *
+			 * @param name header name
+			 * @return header value or empty string if response has no such header
+			 */
+			String HttpConnection::header(const char* name) {
+				return http.header(name);
+			}
+
+			/**
+			 * Receives bytes from connection, implemented by each backend
+			 *
+			 * @param data   to fill
+			 * @param length maximum number of bytes to receive
+			 * @return number of received bytes, 0 if connection was closed or timed out
+			 */
+			size_t HttpConnection::receive(char* data, const size_t length) {
+
+				uint32_t startTime = millis();
+				while(client.available() <= 0) {
+					if(!client.connected() || millis() - startTime > HTTP_TIMEOUT) return 0;
+					delay(1);
+				}
+
+				int received = client.read((uint8_t*)data, length);
+				return received > 0 ? received : 0;
+			}
+
+			/**
+			 * Ends request, unread body is dropped and tcp connection is kept open for next request
+			 */
+			void HttpConnection::end() {
+
+				bool complete = skipBody();
+				http.end();
+				if(!complete) close();
+			}
+
+			/**
+			 * Closes tcp connection
+			 */
+			void HttpConnection::close() {
+
+				client.stop();
+				connectedHost = "";
+				connectedPort = 0;
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,350 @@
+/**
+ * Hardware abstraction layer native canvas implementation
+ *
+ * Software rasterizer over a heap RGB565 buffer
+ *
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/**
+			 * Initialise empty canvas
+			 */
+			Canvas::Canvas()
+				: buffer(NULL)
+				, width(0)
+				, height(0)
+				, cursorX(0)
+				, cursorY(0)
+				, textForegroundColor(TFT_WHITE)
+				, textBackgroundColor(TFT_BLACK) {
+			}
+
+			/**
+			 * Frees canvas pixels
+			 */
+			Canvas::~Canvas() {
+				delete[] buffer;
+			}
+
+			/**
+			 * Allocates canvas pixels, previous content is lost
+			 *
+			 * @param width  canvas width
+			 * @param height canvas height
+			 * @return true if pixels are allocated
+			 */
+			bool Canvas::create(const int32_t width, const int32_t height) {
+
+				delete[] buffer;
+				buffer = new uint16_t[width * height]();
+				this->width = width;
+				this->height = height;
+
+				return true;
+			}
+
+			/**
+			 * Gets canvas width
+			 *
+			 * @return canvas width
+			 */
+			int32_t Canvas::getWidth() const {
+				return width;
+			}
+
+			/**
+			 * Gets canvas height
+			 *
+			 * @return canvas height
+			 */
+			int32_t Canvas::getHeight() const {
+				return height;
+			}
+
+			/**
+			 * Gets canvas pixels
+			 *
+			 * @return canvas pixels in panel byte order or NULL if canvas is not created
+			 */
+			const uint16_t* Canvas::getBuffer() const {
+				return buffer;
+			}
+
+			/**
+			 * Gets text cursor x position
+			 *
+			 * @return cursor x position
+			 */
+			int32_t Canvas::getCursorX() {
+				return cursorX;
+			}
+
+			/**
+			 * Gets text cursor y position
+			 *
+			 * @return cursor y position
+			 */
+			int32_t Canvas::getCursorY() {
+				return cursorY;
+			}
+
+			/**
+			 * Writes one pixel clipping it to the canvas
+			 *
+			 * @param x     pixel x position
+			 * @param y     pixel y position
+			 * @param color to write
+			 */
+			void Canvas::writePixel(const int32_t x, const int32_t y, const uint16_t color) {
+
+				if(x < 0 || y < 0 || x >= width || y >= height) return;
+				buffer[y * width + x] = color;
+			}
+
+			/**
+			 * Fills whole canvas with color
+			 *
+			 * @param color to fill with
+			 */
+			void Canvas::fillScreen(const uint16_t color) {
+				fillRect(0, 0, width, height, color);
+			}
+
+			/**
+			 * Fills rectangle
+			 *
+			 * @param x     rectangle x position
+			 * @param y     rectangle y position
+			 * @param w     rectangle width
+			 * @param h     rectangle height
+			 * @param color to fill with
+			 */
+			void Canvas::fillRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t color) {
+
+				for(int32_t j = y; j < y + h; j++) {
+					for(int32_t i = x; i < x + w; i++) {
+						writePixel(i, j, color);
+					}
+				}
+			}
+
+			/**
+			 * Fills rounded rectangle
+			 *
+			 * @param x      rectangle x position
+			 * @param y      rectangle y position
+			 * @param w      rectangle width
+			 * @param h      rectangle height
+			 * @param radius corner radius
+			 * @param color  to fill with
+			 */
+			void Canvas::fillRoundRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const int32_t radius, const uint16_t color) {
+
+				for(int32_t j = 0; j < h; j++) {
+					for(int32_t i = 0; i < w; i++) {
+
+						int32_t dx = i < radius ? radius - i : (i >= w - radius ? i - (w - radius - 1) : 0);
+						int32_t dy = j < radius ? radius - j : (j >= h - radius ? j - (h - radius - 1) : 0);
+						if(dx * dx + dy * dy <= radius * radius) writePixel(x + i, y + j, color);
+					}
+				}
+			}
+
+			/**
+			 * Draws rectangle outline
+			 *
+			 * @param x     rectangle x position
+			 * @param y     rectangle y position
+			 * @param w     rectangle width
+			 * @param h     rectangle height
+			 * @param color to draw with
+			 */
+			void Canvas::drawRect(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t color) {
+
+				fillRect(x, y, w, 1, color);
+				fillRect(x, y + h - 1, w, 1, color);
+				fillRect(x, y, 1, h, color);
+				fillRect(x + w - 1, y, 1, h, color);
+			}
+
+			/**
+			 * Draws line
+			 *
+			 * @param x0    start x position
+			 * @param y0    start y position
+			 * @param x1    end x position
+			 * @param y1    end y position
+			 * @param color to draw with
+			 */
+			void Canvas::drawLine(const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1, const uint16_t color) {
+
+				int32_t dx = abs(x1 - x0);
+				int32_t dy = -abs(y1 - y0);
+				int32_t stepX = x0 < x1 ? 1 : -1;
+				int32_t stepY = y0 < y1 ? 1 : -1;
+				int32_t error = dx + dy;
+				int32_t x = x0;
+				int32_t y = y0;
+
+				for(;;) {
+					writePixel(x, y, color);
+					if(x == x1 && y == y1) break;
+
+					int32_t error2 = 2 * error;
+					if(error2 >= dy) {
+						error += dy;
+						x += stepX;
+					}
+					if(error2 <= dx) {
+						error += dx;
+						y += stepY;
+					}
+				}
+			}
+
+			/**
+			 * Draws circle outline
+			 *
+			 * @param x      center x position
+			 * @param y      center y position
+			 * @param radius circle radius
+			 * @param color  to draw with
+			 */
+			void Canvas::drawCircle(const int32_t x, const int32_t y, const int32_t radius, const uint16_t color) {
+
+				int32_t i = radius;
+				int32_t j = 0;
+				int32_t error = 1 - radius;
+
+				while(i >= j) {
+					writePixel(x + i, y + j, color);
+					writePixel(x + j, y + i, color);
+					writePixel(x - j, y + i, color);
+					writePixel(x - i, y + j, color);
+					writePixel(x - i, y - j, color);
+					writePixel(x - j, y - i, color);
+					writePixel(x + j, y - i, color);
+					writePixel(x + i, y - j, color);
+
+					j++;
+					if(error < 0) {
+						error += 2 * j + 1;
+					}
+					else {
+						i--;
+						error += 2 * (j - i) + 1;
+					}
+				}
+			}
+
+			/**
+			 * Fills circle
+			 *
+			 * @param x      center x position
+			 * @param y      center y position
+			 * @param radius circle radius
+			 * @param color  to fill with
+			 */
+			void Canvas::fillCircle(const int32_t x, const int32_t y, const int32_t radius, const uint16_t color) {
+
+				for(int32_t j = -radius; j <= radius; j++) {
+					for(int32_t i = -radius; i <= radius; i++) {
+						if(i * i + j * j <= radius * radius) writePixel(x + i, y + j, color);
+					}
+				}
+			}
+
+			/**
+			 * Draws RGB565 image
+			 *
+			 * @param x    image x position
+			 * @param y    image y position
+			 * @param w    image width
+			 * @param h    image height
+			 * @param data image pixels
+			 */
+			void Canvas::pushImage(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t* data) {
+
+				for(int32_t j = 0; j < h; j++) {
+					for(int32_t i = 0; i < w; i++) {
+						writePixel(x + i, y + j, data[j * w + i]);
+					}
+				}
+			}
+
+			/**
+			 * Draws RGB565 image skipping transparent pixels
+			 *
+			 * @param x           image x position
+			 * @param y           image y position
+			 * @param w           image width
+			 * @param h           image height
+			 * @param data        image pixels
+			 * @param transparent color that is not drawn
+			 */
+			void Canvas::pushImage(const int32_t x, const int32_t y, const int32_t w, const int32_t h, const uint16_t* data, const uint16_t transparent) {
+
+				for(int32_t j = 0; j < h; j++) {
+					for(int32_t i = 0; i < w; i++) {
+						if(data[j * w + i] != transparent) writePixel(x + i, y + j, data[j * w + i]);
+					}
+				}
+			}
+
+			/**
+			 * Sets text colors
+			 *
+			 * @param foregroundColor text foreground color
+			 * @param backgroundColor text background color
+			 */
+			void Canvas::setTextColor(const uint16_t foregroundColor, const uint16_t backgroundColor) {
+				textForegroundColor = foregroundColor;
+				textBackgroundColor = backgroundColor;
+			}
+
+			/**
+			 * Sets text cursor
+			 *
+			 * @param x cursor x position
+			 * @param y cursor y position
+			 */
+			void Canvas::setCursor(const int32_t x, const int32_t y) {
+				cursorX = x;
+				cursorY = y;
+			}
+
+			/**
+			 * Prints text at cursor position wrapping at canvas width
+			 * Glyph shapes are not rasterized, each visible character is drawn as a 5x7 block in its 6x8 cell
+			 *
+			 * @param text to print
+			 */
+			void Canvas::print(const char* text) {
+
+				for(const char* c = text; *c != '\0'; c++) {
+
+					if(*c == '\n') {
+						cursorX = 0;
+						cursorY += 8;
+						continue;
+					}
+
+					if(cursorX + 6 > width) {
+						cursorX = 0;
+						cursorY += 8;
+					}
+
+					fillRect(cursorX, cursorY, 6, 8, textBackgroundColor);
+					if(*c != ' ') fillRect(cursorX, cursorY, 5, 7, textForegroundColor);
+					cursorX += 6;
+				}
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
@@ -0,0 +1,680 @@
+/**
+ * Hardware abstraction layer native implementation
+ *
+ * Emulates the M5StickC on a Linux workstation :
+ * display is an 80x160 RGB565 framebuffer, sensors are synthetic waves and buttons are driven from stdin
+ * type a (home), b (up), p (power click), l (power long click) or s (dump screen to crowos_screen.ppm) followed by enter
+ *
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+// Lib includes
+#include <chrono>
+#include <condition_variable>
+#include <dirent.h>
+#include <malloc.h>
+#include <mutex>
+#include <poll.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/** Time a simulated gpio button stays pressed in ms */
+			static const unsigned long BUTTON_PRESS_DURATION = 100;
+
+			/** Emulated framebuffer in panel orientation */
+			static uint16_t framebuffer[TFT_WIDTH * TFT_HEIGHT];
+
+			/** Current display rotation */
+			static uint8_t displayRotation = 0;
+
+			/** Pending power button event */
+			static PowerButtonEvent powerButtonEvent = POWER_BUTTON_NONE;
+
+			/** Time when simulated home button is released */
+			static unsigned long homeButtonReleaseTime = 0;
+
+			/** Time when simulated up button is released */
+			static unsigned long upButtonReleaseTime = 0;
+
+			/** Rtc seconds at millis() == 0 */
+			static long rtcOffset = 0;
+
+			/** Emulated wifi status */
+			static WifiStatus wifiStatus = WIFI_DISCONNECTED;
+
+			/** Called when a wake source fires */
+			static void (*wakeHandler)(const WakeSource source) = NULL;
+
+			/** Guards wakePending */
+			static std::mutex idleMutex;
+
+			/** Signaled by Idle::wake */
+			static std::condition_variable idleCondition;
+
+			/** Indicates if Idle::wake was called since last Idle::wait */
+			static bool wakePending = false;
+
+			/** Critical section of Idle::lock */
+			static std::mutex criticalMutex;
+
+			/**
+			 * Gets emulated boot time, initialised on first call so that static constructors get a valid clock
+			 *
+			 * @return emulated boot time
+			 */
+			static std::chrono::steady_clock::time_point bootTime() {
+				static const std::chrono::steady_clock::time_point BOOT_TIME = std::chrono::steady_clock::now();
+				return BOOT_TIME;
+			}
+
+			/**
+			 * Emulates button interrupts, reports a wake up each time stdin gets input
+			 *
+			 * @param parameter unused
+			 */
+			static void inputTask(void* /* parameter */) {
+
+				for(;;) {
+
+					struct pollfd fd = {STDIN_FILENO, POLLIN, 0};
+					if(poll(&fd, 1, -1) > 0 && (fd.revents & POLLIN)) {
+						if(wakeHandler != NULL) wakeHandler(WAKE_BUTTON);
+					}
+
+					// Leaves main loop time to consume input, closed stdin is reported without POLLIN
+					delay(BUTTON_PRESS_DURATION);
+				}
+			}
+
+			/**
+			 * Gets logical display width for current rotation
+			 *
+			 * @return display width
+			 */
+			static int32_t displayWidth() {
+				return displayRotation % 2 == 0 ? TFT_WIDTH : TFT_HEIGHT;
+			}
+
+			/**
+			 * Gets logical display height for current rotation
+			 *
+			 * @return display height
+			 */
+			static int32_t displayHeight() {
+				return displayRotation % 2 == 0 ? TFT_HEIGHT : TFT_WIDTH;
+			}
+
+			/**
+			 * Writes one pixel into the framebuffer applying rotation and clipping
+			 *
+			 * @param x     logical x position
+			 * @param y     logical y position
+			 * @param color to write
+			 */
+			static void writePixel(const int32_t x, const int32_t y, const uint16_t color) {
+
+				if(x < 0 || y < 0 || x >= displayWidth() || y >= displayHeight()) return;
+
+				int32_t panelX = x;
+				int32_t panelY = y;
+
+				switch(displayRotation % 4) {
+				case 1:
+					panelX = TFT_WIDTH - 1 - y;
+					panelY = x;
+					break;
+				case 2:
+					panelX = TFT_WIDTH - 1 - x;
+					panelY = TFT_HEIGHT - 1 - y;
+					break;
+				case 3:
+					panelX = y;
+					panelY = TFT_HEIGHT - 1 - x;
+					break;
+				}
+
+				framebuffer[panelY * TFT_WIDTH + panelX] = color;
+			}
+
+			/**
+			 * Dumps framebuffer into a binary ppm file
+			 *
+			 * @param path of the file to write
+			 */
+			static void dumpFramebuffer(const char* path) {
+
+				FILE* file = fopen(path, "wb");
+				if(file == NULL) return;
+
+				fprintf(file, "P6\n%d %d\n255\n", TFT_WIDTH, TFT_HEIGHT);
+				for(int i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
+					uint8_t rgb[3] = {(uint8_t)((framebuffer[i] >> 8) & 0xF8), (uint8_t)((framebuffer[i] >> 3) & 0xFC), (uint8_t)((framebuffer[i] << 3) & 0xF8)};
+					fwrite(rgb, 1, 3, file);
+				}
+				fclose(file);
+
+				LOG_INFO(Hal, "dumpFramebuffer path = %s", path);
+			}
+
+			/**
+			 * Initialise the board
+			 */
+			void begin() {
+				LOG_INFO(Hal, "native board, keys : a = home, b = up, p = power, l = power long, s = screenshot");
+			}
+
+			/**
+			 * Initialise display
+			 */
+			void Display::begin() {
+			}
+
+			/**
+			 * Sets display rotation
+			 *
+			 * @param rotation to set
+			 */
+			void Display::setRotation(const uint8_t rotation) {
+				displayRotation = rotation;
+			}
+
+			/**
+			 * Pushes canvas area at the same position on the display in one bus transaction
+			 *
+			 * @param canvas to push from, must have the display size for current rotation
+			 * @param x      area x position
+			 * @param y      area y position
+			 * @param w      area width
+			 * @param h      area height
+			 */
+			void Display::pushCanvas(const Canvas& canvas, const int32_t x, const int32_t y, const int32_t w, const int32_t h) {
+
+				const uint16_t* pixels = canvas.getBuffer();
+				if(pixels == NULL) return;
+
+				for(int32_t j = y; j < y + h && j < canvas.getHeight(); j++) {
+					for(int32_t i = x; i < x + w && i < canvas.getWidth(); i++) {
+						writePixel(i, j, pixels[j * canvas.getWidth() + i]);
+					}
+				}
+			}
+
+			/**
+			 * Initialise power management
+			 */
+			void Pmic::begin() {
+			}
+
+			/**
+			 * Sets screen back light brightness
+			 *
+			 * @param brightness between 7 and 15
+			 */
+			void Pmic::setScreenBrightness(const uint8_t /* brightness */) {
+			}
+
+			/**
+			 * Gets battery voltage
+			 *
+			 * @return battery voltage in V
+			 */
+			float Pmic::getBatteryVoltage() {
+				return 3.9;
+			}
+
+			/**
+			 * Gets battery current
+			 *
+			 * @return battery current in mA, positive while charging
+			 */
+			float Pmic::getBatteryCurrent() {
+				return -45.5;
+			}
+
+			/**
+			 * Gets and clears last power button event
+			 *
+			 * @return power button event
+			 */
+			PowerButtonEvent Pmic::getPowerButtonEvent() {
+
+				PowerButtonEvent event = powerButtonEvent;
+				powerButtonEvent = POWER_BUTTON_NONE;
+				return event;
+			}
+
+			/**
+			 * Puts screen and peripherals on sleep
+			 */
+			void Pmic::sleep() {
+				LOG_INFO(Hal, "sleep, press p to wake up");
+			}
+
+			/**
+			 * Powers the device off
+			 */
+			void Pmic::powerOff() {
+
+				LOG_INFO(Hal, "powerOff");
+				Serial.flush();
+				exit(0);
+			}
+
+			/**
+			 * Sets rtc time
+			 *
+			 * @param time to set
+			 */
+			void Rtc::setTime(const RTC_TimeTypeDef& time) {
+				rtcOffset = time.Hours * 3600L + time.Minutes * 60L + time.Seconds - (long)(millis() / 1000);
+			}
+
+			/**
+			 * Gets rtc time
+			 *
+			 * @param time to store into
+			 */
+			void Rtc::getTime(RTC_TimeTypeDef& time) {
+
+				long seconds = (rtcOffset + (long)(millis() / 1000)) % 86400;
+				time.Hours = seconds / 3600;
+				time.Minutes = (seconds / 60) % 60;
+				time.Seconds = seconds % 60;
+			}
+
+			/**
+			 * Initialise imu
+			 */
+			void Imu::begin() {
+			}
+
+			/**
+			 * Gets accelerometer data
+			 *
+			 * @param x acceleration on x axis in g
+			 * @param y acceleration on y axis in g
+			 * @param z acceleration on z axis in g
+			 */
+			void Imu::getAccelData(float* x, float* y, float* z) {
+
+				float t = millis() / 1000.0;
+				*x = 0;
+				*y = 0.08 * sin(t);
+				*z = 0.12 * cos(t * 0.7);
+			}
+
+			/**
+			 * Reads analog pin
+			 *
+			 * @param pin to read
+			 * @return 12 bits value
+			 */
+			int Adc::read(const uint8_t /* pin */) {
+				return 1550 + (int)(1500 * sin(millis() / 2000.0));
+			}
+
+			/**
+			 * Polls button sources that are not plain gpio
+			 * Reads pending key presses from Serial and drives emulated button pins
+			 */
+			void Buttons::poll() {
+
+				unsigned long now = millis();
+				if(homeButtonReleaseTime != 0 && now >= homeButtonReleaseTime) {
+					digitalWrite(BUTTON_A_PIN, HIGH);
+					homeButtonReleaseTime = 0;
+				}
+				if(upButtonReleaseTime != 0 && now >= upButtonReleaseTime) {
+					digitalWrite(BUTTON_B_PIN, HIGH);
+					upButtonReleaseTime = 0;
+				}
+
+				while(Serial.available()) {
+
+					switch(Serial.peek()) {
+					case 'a':
+						digitalWrite(BUTTON_A_PIN, LOW);
+						homeButtonReleaseTime = now + BUTTON_PRESS_DURATION;
+						break;
+					case 'b':
+						digitalWrite(BUTTON_B_PIN, LOW);
+						upButtonReleaseTime = now + BUTTON_PRESS_DURATION;
+						break;
+					case 'p':
+						powerButtonEvent = POWER_BUTTON_CLICK;
+						break;
+					case 'l':
+						powerButtonEvent = POWER_BUTTON_LONG_CLICK;
+						break;
+					case 's':
+						dumpFramebuffer("crowos_screen.ppm");
+						break;
+					case ' ':
+					case '\r':
+					case '\n':
+						break;
+					default:
+						// leave unknown input to other Serial readers
+						return;
+					}
+					Serial.read();
+				}
+			}
+
+			/**
+			 * Indicates if home button is actually pressed
+			 *
+			 * @return true if home button is pressed
+			 */
+			bool Buttons::isHomePressed() {
+				return digitalRead(BUTTON_A_PIN) == LOW;
+			}
+
+			/**
+			 * Gets time since boot from the cpu timer, never wraps and costs no bus transaction
+			 *
+			 * @return microseconds since boot
+			 */
+			uint64_t Clock::getMicroseconds() {
+				return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime()).count();
+			}
+
+			/**
+			 * Gets cpu cycle counter, wraps around so only differences are meaningful
+			 *
+			 * @return cycle counter
+			 */
+			uint32_t Cpu::getCycleCount() {
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+
+			/**
+			 * Gets number of cycles per microsecond
+			 *
+			 * @return cycles per microsecond
+			 */
+			uint32_t Cpu::getCyclesPerMicrosecond() {
+				return 1000;
+			}
+
+			/**
+			 * Gets number of allocated heap bytes
+			 *
+			 * @return allocated heap bytes
+			 */
+			uint32_t Memory::getHeapUsed() {
+				return mallinfo2().uordblks;
+			}
+
+			/**
+			 * Gets number of free heap bytes
+			 *
+			 * @return free heap bytes
+			 */
+			uint32_t Memory::getHeapFree() {
+				return mallinfo2().fordblks;
+			}
+
+			/**
+			 * Gets largest block that can be allocated, approximated natively by the free space at top of the heap
+			 *
+			 * @return largest free block in bytes
+			 */
+			uint32_t Memory::getLargestFreeBlock() {
+				return mallinfo2().keepcost;
+			}
+
+			/** Directory holding one file per Storage key */
+			static const char* STORAGE_DIRECTORY = "crowos_storage";
+
+			/**
+			 * Builds file path of storage key
+			 *
+			 * @param key  value key
+			 * @param path to fill
+			 * @param size path capacity
+			 */
+			static void storagePath(const char* key, char* path, const size_t size) {
+				snprintf(path, size, "%s/%s", STORAGE_DIRECTORY, key);
+			}
+
+			/**
+			 * Opens storage
+			 *
+			 * @return true if storage is usable
+			 */
+			bool Storage::begin() {
+
+				struct stat directory;
+				bool ready = (stat(STORAGE_DIRECTORY, &directory) == 0 && S_ISDIR(directory.st_mode)) || mkdir(STORAGE_DIRECTORY, 0755) == 0;
+				LOG_INFO(Hal, "Storage begin directory = %s, ready = %d", STORAGE_DIRECTORY, ready);
+				return ready;
+			}
+
+			/**
+			 * Gets value length
+			 *
+			 * @param key value key
+			 * @return value length in bytes, 0 if key does not exist
+			 */
+			size_t Storage::getLength(const char* key) {
+
+				char path[64];
+				storagePath(key, path, sizeof path);
+				struct stat file;
+				return stat(path, &file) == 0 ? file.st_size : 0;
+			}
+
+			/**
+			 * Reads value
+			 *
+			 * @param key    value key
+			 * @param data   to fill
+			 * @param length maximum number of bytes to read
+			 * @return number of read bytes, 0 if key does not exist
+			 */
+			size_t Storage::read(const char* key, void* data, const size_t length) {
+
+				char path[64];
+				storagePath(key, path, sizeof path);
+				FILE* file = fopen(path, "rb");
+				if(file == NULL) return 0;
+				size_t count = fread(data, 1, length, file);
+				fclose(file);
+				return count;
+			}
+
+			/**
+			 * Writes value, replaces previous one
+			 *
+			 * @param key    value key
+			 * @param data   to write
+			 * @param length number of bytes to write
+			 * @return true if value is written
+			 */
+			bool Storage::write(const char* key, const void* data, const size_t length) {
+
+				char path[64];
+				char temporaryPath[68];
+				storagePath(key, path, sizeof path);
+				snprintf(temporaryPath, sizeof temporaryPath, "%s.tmp", path);
+
+				// written aside then renamed so that a crash never leaves half a value
+				FILE* file = fopen(temporaryPath, "wb");
+				if(file == NULL) return false;
+				bool written = fwrite(data, 1, length, file) == length;
+				written = fclose(file) == 0 && written;
+				return written && rename(temporaryPath, path) == 0;
+			}
+
+			/**
+			 * Removes value
+			 *
+			 * @param key value key
+			 */
+			void Storage::remove(const char* key) {
+
+				char path[64];
+				storagePath(key, path, sizeof path);
+				::remove(path);
+			}
+
+			/**
+			 * Removes every value
+			 */
+			void Storage::clear() {
+
+				DIR* directory = opendir(STORAGE_DIRECTORY);
+				if(directory == NULL) return;
+
+				char path[64];
+				for(struct dirent* file = readdir(directory); file != NULL; file = readdir(directory)) {
+					if(file->d_name[0] == '.') continue;
+					storagePath(file->d_name, path, sizeof path);
+					::remove(path);
+				}
+				closedir(directory);
+			}
+
+			/**
+			 * Starts function in a new task
+			 *
+			 * @param function  task body, must never return
+			 * @param parameter passed to function
+			 * @param name      task name
+			 * @param stackSize task stack size in bytes
+			 * @param priority  task priority, main loop runs at 1, ignored natively
+			 * @param core      core the task is pinned to, main loop runs on core 1, ignored natively
+			 * @return true if task is started
+			 */
+			bool Task::start(void (*function)(void*), void* parameter, const char* /* name */, const uint32_t /* stackSize */, const uint8_t /* priority */, const uint8_t /* core */) {
+				std::thread(function, parameter).detach();
+				return true;
+			}
+
+			/**
+			 * Arms wake sources, must be called from the main loop task
+			 *
+			 * @param handler called from interrupt context on device when a wake source fires
+			 */
+			void Idle::begin(void (*handler)(const WakeSource source)) {
+
+				wakeHandler = handler;
+				Task::start(inputTask, NULL, "input", 2048, 1, 0);
+			}
+
+			/**
+			 * Blocks main loop until wake is called or timeout expires
+			 *
+			 * @param timeout    maximum time to block in ms
+			 * @param lightSleep ignored natively
+			 * @return true if woken before timeout
+			 */
+			bool Idle::wait(const uint32_t timeout, const bool /* lightSleep */) {
+
+				std::unique_lock<std::mutex> lock(idleMutex);
+				bool woken = idleCondition.wait_for(lock, std::chrono::milliseconds(timeout), [] { return wakePending; });
+				wakePending = false;
+				return woken;
+			}
+
+			/**
+			 * Wakes main loop, callable from interrupts and other tasks
+			 */
+			void Idle::wake() {
+				{
+					std::lock_guard<std::mutex> lock(idleMutex);
+					wakePending = true;
+				}
+				idleCondition.notify_one();
+			}
+
+			/**
+			 * Enters critical section shared with interrupts
+			 */
+			void Idle::lock() {
+				criticalMutex.lock();
+			}
+
+			/**
+			 * Leaves critical section shared with interrupts
+			 */
+			void Idle::unlock() {
+				criticalMutex.unlock();
+			}
+
+			/**
+			 * Connects using stored credentials
+			 */
+			void Wifi::begin() {
+				wifiStatus = WIFI_CONNECTED;
+			}
+
+			/**
+			 * Starts smart config
+			 */
+			void Wifi::beginSmartConfig() {
+			}
+
+			/**
+			 * Indicates if smart config is done
+			 *
+			 * @return true if smart config is done
+			 */
+			bool Wifi::smartConfigDone() {
+				return true;
+			}
+
+			/**
+			 * Reconnects to the access point
+			 */
+			void Wifi::reconnect() {
+				wifiStatus = WIFI_CONNECTED;
+			}
+
+			/**
+			 * Disconnects from the access point
+			 *
+			 * @param wifiOff if true wifi radio is turned off
+			 */
+			void Wifi::disconnect(const bool /* wifiOff = false */) {
+				wifiStatus = WIFI_DISCONNECTED;
+			}
+
+			/**
+			 * Gets connection status
+			 *
+			 * @return connection status
+			 */
+			WifiStatus Wifi::status() {
+				return wifiStatus;
+			}
+
+			/**
+			 * Gets connected network SSID
+			 *
+			 * @return SSID
+			 */
+			String Wifi::ssid() {
+				return wifiStatus == WIFI_CONNECTED ? "native" : "";
+			}
+
+			/**
+			 * Gets local ip address
+			 *
+			 * @return local ip address
+			 */
+			String Wifi::localIp() {
+				return wifiStatus == WIFI_CONNECTED ? "127.0.0.1" : "0.0.0.0";
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
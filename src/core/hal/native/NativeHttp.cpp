@@ -0,0 +1,355 @@
+/**
+ * Hardware abstraction layer native http implementation
+ *
+ * Plain HTTP/1.1 over posix sockets, connection is kept alive between requests to the same host
+ *
+ * @author error23
+ */
+#include "core/Hal.hpp"
+
+// Lib includes
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace CrowOs {
+	namespace Core {
+		namespace Hal {
+
+			/** Connection refused, same value as esp32 HTTPC_ERROR_CONNECTION_REFUSED */
+			static const int HTTP_ERROR_CONNECTION_REFUSED = -1;
+
+			/** Send failed, same value as esp32 HTTPC_ERROR_SEND_HEADER_FAILED */
+			static const int HTTP_ERROR_SEND_FAILED = -2;
+
+			/** Connection lost, same value as esp32 HTTPC_ERROR_CONNECTION_LOST */
+			static const int HTTP_ERROR_CONNECTION_LOST = -5;
+
+			/** Socket read and write timeout in s */
+			static const int HTTP_TIMEOUT = 5;
+
+			/**
+			 * Encodes text into base64
+			 *
+			 * @param text to encode
+			 * @return encoded text
+			 */
+			static String encodeBase64(const String& text) {
+
+				static const char* ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+				String encoded;
+				const unsigned char* data = (const unsigned char*)text.c_str();
+				unsigned int length = text.length();
+
+				for(unsigned int i = 0; i < length; i += 3) {
+
+					uint32_t block = data[i] << 16;
+					if(i + 1 < length) block |= data[i + 1] << 8;
+					if(i + 2 < length) block |= data[i + 2];
+
+					encoded += ALPHABET[(block >> 18) & 0x3F];
+					encoded += ALPHABET[(block >> 12) & 0x3F];
+					encoded += i + 1 < length ? ALPHABET[(block >> 6) & 0x3F] : '=';
+					encoded += i + 2 < length ? ALPHABET[block & 0x3F] : '=';
+				}
+
+				return encoded;
+			}
+
+			/**
+			 * Opens tcp connection
+			 *
+			 * @param host to connect to
+			 * @param port to connect to
+			 * @return socket or -1 on failure
+			 */
+			static int openSocket(const char* host, const uint16_t port) {
+
+				struct addrinfo hints;
+				memset(&hints, 0, sizeof hints);
+				hints.ai_family = AF_UNSPEC;
+				hints.ai_socktype = SOCK_STREAM;
+
+				char portString[6];
+				snprintf(portString, sizeof portString, "%u", port);
+
+				struct addrinfo* addresses = NULL;
+				if(getaddrinfo(host, portString, &hints, &addresses) != 0) return -1;
+
+				int fd = -1;
+				for(struct addrinfo* address = addresses; address != NULL; address = address->ai_next) {
+
+					fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+					if(fd < 0) continue;
+
+					struct timeval timeout = {HTTP_TIMEOUT, 0};
+					setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+					setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof timeout);
+
+					// request headers and payload are written separately
+					int noDelay = 1;
+					setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof noDelay);
+
+					if(connect(fd, address->ai_addr, address->ai_addrlen) == 0) break;
+					::close(fd);
+					fd = -1;
+				}
+
+				freeaddrinfo(addresses);
+				return fd;
+			}
+
+			/**
+			 * Writes whole buffer into socket
+			 *
+			 * @param fd     socket to write into
+			 * @param buffer to write
+			 * @param length of buffer
+			 * @return true if everything was written
+			 */
+			static bool writeAll(const int fd, const char* buffer, size_t length) {
+
+				while(length > 0) {
+					ssize_t written = send(fd, buffer, length, MSG_NOSIGNAL);
+					if(written <= 0) return false;
+					buffer += written;
+					length -= written;
+				}
+				return true;
+			}
+
+			/**
+			 * Checks if idle keep alive socket was closed by server
+			 *
+			 * @param fd socket to check
+			 * @return true if socket is still usable
+			 */
+			static bool isAlive(const int fd) {
+
+				struct pollfd pollFd = {fd, POLLIN, 0};
+				if(poll(&pollFd, 1, 0) == 0) return true;
+
+				// idle connection is readable only when server closed it
+				char c;
+				return !(pollFd.revents & (POLLHUP | POLLERR)) && recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) > 0;
+			}
+
+			/**
+			 * Initialise new http connection
+			 */
+			HttpConnection::HttpConnection()
+				: connectedHost()
+				, connectedPort(0)
+				, timings()
+				, bufferPosition(0)
+				, bufferLength(0)
+				, bodyRemaining(0)
+				, chunked(false)
+				, bodyComplete(true)
+				, bodyStartTime(0)
+				, fd(-1)
+				, host()
+				, port(80)
+				, uri()
+				, headers()
+				, keepAlive(false) {
+			}
+
+			/**
+			 * Prepares request
+			 *
+			 * @param host to connect to
+			 * @param port to connect to
+			 * @param uri  to request
+			 * @return true if request is prepared
+			 */
+			bool HttpConnection::begin(const char* host, const uint16_t port, const char* uri) {
+
+				this->host = host;
+				this->port = port;
+				this->uri = uri;
+				headers = "";
+				return true;
+			}
+
+			/**
+			 * Adds request header
+			 *
+			 * @param name  header name
+			 * @param value header value
+			 */
+			void HttpConnection::addHeader(const char* name, const char* value) {
+
+				headers += name;
+				headers += ": ";
+				headers += value;
+				headers += "\r\n";
+			}
+
+			/**
+			 * Sets basic authorization
+			 *
+			 * @param username server username
+			 * @param password server password
+			 */
+			void HttpConnection::setAuthorization(const char* username, const char* password) {
+
+				String credentials(username);
+				credentials += ':';
+				credentials += password;
+				String authorization("Basic ");
+				authorization += encodeBase64(credentials);
+				addHeader("Authorization", authorization.c_str());
+			}
+
+			/**
+			 * Sends request and receives response headers
+			 *
+			 * @param method  http method
+			 * @param payload request body or NULL
+			 * @return http status or negative value on connection error
+			 */
+			int HttpConnection::sendRequest(const char* method, const char* payload /* = NULL */) {
+
+				timings = HttpTimings();
+				bufferPosition = 0;
+				bufferLength = 0;
+				beginBody(0, false);
+
+				if(fd >= 0 && (connectedHost != host || connectedPort != port || !isAlive(fd))) close();
+
+				uint64_t startTime = Clock::getMicroseconds();
+				timings.reused = fd >= 0;
+				if(fd < 0) {
+					fd = openSocket(host.c_str(), port);
+					if(fd < 0) return HTTP_ERROR_CONNECTION_REFUSED;
+					connectedHost = host;
+					connectedPort = port;
+					timings.connect = Clock::getMicroseconds() - startTime;
+				}
+
+				size_t payloadLength = payload != NULL ? strlen(payload) : 0;
+
+				char requestLine[512];
+				snprintf(requestLine, sizeof requestLine, "%s %s HTTP/1.1\r\nHost: %s:%u\r\nConnection: keep-alive\r\nContent-Length: %lu\r\n", method, uri.c_str(), host.c_str(), port, (unsigned long)payloadLength);
+
+				String request(requestLine);
+				request += headers;
+				request += "\r\n";
+
+				uint64_t sentTime = Clock::getMicroseconds();
+				if(!writeAll(fd, request.c_str(), request.length()) || (payloadLength > 0 && !writeAll(fd, payload, payloadLength))) {
+					close();
+					return HTTP_ERROR_SEND_FAILED;
+				}
+
+				String line;
+				if(!readLine(line) || strncmp(line.c_str(), "HTTP/", 5) != 0) {
+					close();
+					return HTTP_ERROR_CONNECTION_LOST;
+				}
+				timings.firstByte = Clock::getMicroseconds() - sentTime;
+
+				int status = atoi(line.c_str() + line.indexOf(' ') + 1);
+
+				int32_t length = -1;
+				bool chunkedBody = false;
+				keepAlive = true;
+				for(uint8_t i = 0; i < COLLECTED_HEADERS_SIZE; i++) {
+					collectedHeaders[i] = "";
+				}
+
+				for(;;) {
+					if(!readLine(line)) {
+						close();
+						return HTTP_ERROR_CONNECTION_LOST;
+					}
+					if(line.length() == 0) break;
+
+					std::string header(line.c_str());
+					std::transform(header.begin(), header.end(), header.begin(), ::tolower);
+
+					if(header.compare(0, 15, "content-length:") == 0) length = atol(header.c_str() + 15);
+					else if(header.compare(0, 18, "transfer-encoding:") == 0) chunkedBody = header.find("chunked") != std::string::npos;
+					else if(header.compare(0, 11, "connection:") == 0) keepAlive = header.find("close") == std::string::npos;
+
+					int separator = line.indexOf(':');
+					for(uint8_t i = 0; separator > 0 && i < COLLECTED_HEADERS_SIZE; i++) {
+						if(strncasecmp(line.c_str(), COLLECTED_HEADERS[i], separator) == 0 && COLLECTED_HEADERS[i][separator] == '\0') {
+							unsigned int start = separator + 1;
+							while(start < line.length() && line[start] == ' ') start++;
+							collectedHeaders[i] = line.substring(start);
+						}
+					}
+				}
+
+				if(strcmp(method, "HEAD") == 0 || status == 204 || status == 304) {
+					length = 0;
+					chunkedBody = false;
+				}
+
+				// without length the body ends when server closes the connection
+				if(!chunkedBody && length < 0) keepAlive = false;
+
+				beginBody(length, chunkedBody);
+				return status;
+			}
+
+			/**
+			 * Receives bytes from connection, implemented by each backend
+			 *
+			 * @param data   to fill
+			 * @param length maximum number of bytes to receive
+			 * @return number of received bytes, 0 if connection was closed or timed out
+			 */
+			size_t HttpConnection::receive(char* data, const size_t length) {
+
+				if(fd < 0) return 0;
+
+				ssize_t received = recv(fd, data, length, 0);
+				return received > 0 ? received : 0;
+			}
+
+			/**
+			 * Gets response header, only Transfer-Encoding, ETag, Last-Modified and Cache-Control are kept
+			 *
+			 * @param name header name
+			 * @return header value or empty string if response has no such header
+			 */
+			String HttpConnection::header(const char* name) {
+
+				for(uint8_t i = 0; i < COLLECTED_HEADERS_SIZE; i++) {
+					if(strcasecmp(name, COLLECTED_HEADERS[i]) == 0) return collectedHeaders[i];
+				}
+				return String();
+			}
+
+			/**
+			 * Ends request, unread body is dropped and tcp connection is kept open for next request
+			 */
+			void HttpConnection::end() {
+
+				if(!skipBody() || !keepAlive) close();
+				headers = "";
+			}
+
+			/**
+			 * Closes tcp connection
+			 */
+			void HttpConnection::close() {
+
+				if(fd >= 0) ::close(fd);
+				fd = -1;
+				connectedHost = "";
+				connectedPort = 0;
+			}
+
+		} // namespace Hal
+	} // namespace Core
+} // namespace CrowOs
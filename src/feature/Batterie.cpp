@@ -20,33 +20,33 @@ namespace CrowOs {
 			, warningLevel(10)
 			, warning(false)
 			, chargingAnimationLevel(0)
-			, lastAnimationChange(0) {
+			, animationChanged(true)
+			, animationTimer(Core::Scheduler::NO_TIMER) {
 		}
 
 		/**
 		 * Called after Feature creation before loop when state changes to this feature
-		 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+		 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 		 *
 		 * @param screenHelper Screen helper used to manage screen
 		 * @param timeHelper   Time helper used to manage upTime and sleepTime
 		 * @param ledHelper    Led helper used to manage Led state
-		 * @param savedData    pointer to feature persistent data
 		 */
-		void Battery::onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) {
+		void Battery::onStart(Core::Screen* screenHelper, Core::Time* /* timeHelper */, Core::Led* ledHelper) {
 
-			if(LOG_INFO) Serial.println("Info : [Battery] onStart");
+			LOG_INFO(Battery, "onStart");
 			screen = screenHelper;
 			led = ledHelper;
 		}
 
 		/**
 		 * Called before Feature destroying after loop when state changes from this feature to another
-		 * You should destroy all your variables here and save the persistent one into savedData pointer
-		 *
-		 * @param savedData pointer to feature persistent data
+		 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
 		 */
-		void Battery::onStop(DynamicJsonDocument* savedData) {
-			if(LOG_INFO) Serial.println("Info : [Battery] onStop");
+		void Battery::onStop() {
+
+			LOG_INFO(Battery, "onStop");
+			Core::Scheduler::cancel(animationTimer);
 		}
 
 		/**
@@ -55,13 +55,14 @@ namespace CrowOs {
 		 */
 		void Battery::loop() {
 
-			if(M5.Axp.GetBatVoltage() > 0) voltage = (voltage + M5.Axp.GetBatVoltage()) / 2;
-			current = (current + M5.Axp.GetBatCurrent()) / 2;
+			float batteryVoltage = Core::Hal::Pmic::getBatteryVoltage();
+			if(batteryVoltage > 0) voltage = (voltage + batteryVoltage) / 2;
+			current = (current + Core::Hal::Pmic::getBatteryCurrent()) / 2;
 			updateBatteryLevel();
 			showBatteryLevel();
 			blinkLedWarning();
 
-			if(LOG_DEBUG) Serial.printf("Debug : [Battery] loop voltage = %f, current = %f, level = %d\n", voltage, current, level);
+			LOG_DEBUG(Battery, "loop voltage = %f, current = %f, level = %d", voltage, current, level);
 		}
 
 		/**
@@ -76,6 +77,16 @@ namespace CrowOs {
 		void Battery::onHomeDoubleClick() {
 		}
 
+		/**
+		 * Indicates if feature has something to draw at next frame
+		 * Battery is sampled at idle main loop rate, charging animation and led blink are driven by timers
+		 *
+		 * @return true if loop should be called again as soon as possible
+		 */
+		const bool Battery::needsFrame() const {
+			return false;
+		}
+
 		/**
 		 * Calculates battery level in fonction of battery voltage and current
 		 */
@@ -104,7 +115,8 @@ namespace CrowOs {
 			if(current > 0)
 				animateCharging(x, y);
 			else {
-				M5.Lcd.pushImage(x, y, 16, 10, getBatteryLevelIcon(level));
+				Core::Scheduler::cancel(animationTimer);
+				screen->pushAsset(x, y, *getBatteryLevelIcon(level));
 			}
 
 			// Show percentage
@@ -128,7 +140,7 @@ namespace CrowOs {
 		void Battery::blinkLedWarning() {
 
 			if(level <= warningLevel) {
-				if(LOG_DEBUG) Serial.println("Debug : [Battery] blinkLedWarning");
+				LOG_DEBUG(Battery, "blinkLedWarning");
 				warning = true;
 				led->blink(ANIMATION_DELAY);
 			}
@@ -146,30 +158,46 @@ namespace CrowOs {
 		 */
 		void Battery::animateCharging(const int x, const int y) {
 
-			if(millis() - lastAnimationChange > ANIMATION_DELAY) {
-				M5.Lcd.pushImage(x, y, 16, 10, getBatteryLevelIcon(chargingAnimationLevel));
-				lastAnimationChange = millis();
-
-				switch(chargingAnimationLevel) {
-				case 0:
-					chargingAnimationLevel = 11;
-					break;
-				case 11:
-					chargingAnimationLevel = 36;
-					break;
-				case 36:
-					chargingAnimationLevel = 51;
-					break;
-				case 51:
-					chargingAnimationLevel = 66;
-					break;
-				case 66:
-					chargingAnimationLevel = 81;
-					break;
-				case 81:
-					chargingAnimationLevel = 0;
-					break;
-				}
+			if(!Core::Scheduler::isScheduled(animationTimer)) {
+				animationTimer = Core::Scheduler::scheduleEvery(ANIMATION_DELAY, onAnimationTimer, this);
+				animationChanged = true;
+			}
+
+			if(animationChanged) {
+				screen->pushAsset(x, y, *getBatteryLevelIcon(chargingAnimationLevel));
+				animationChanged = false;
+			}
+		}
+
+		/**
+		 * Moves charging animation to next level, called by animationTimer
+		 *
+		 * @param battery to animate
+		 */
+		void Battery::onAnimationTimer(void* battery) {
+
+			Battery* self = (Battery*)battery;
+			self->animationChanged = true;
+
+			switch(self->chargingAnimationLevel) {
+			case 0:
+				self->chargingAnimationLevel = 11;
+				break;
+			case 11:
+				self->chargingAnimationLevel = 36;
+				break;
+			case 36:
+				self->chargingAnimationLevel = 51;
+				break;
+			case 51:
+				self->chargingAnimationLevel = 66;
+				break;
+			case 66:
+				self->chargingAnimationLevel = 81;
+				break;
+			case 81:
+				self->chargingAnimationLevel = 0;
+				break;
 			}
 		}
 
@@ -179,14 +207,14 @@ namespace CrowOs {
 		 * @param  batteryLevel to calculate for
 		 * @return image correspending icon
 		 */
-		const unsigned short* Battery::getBatteryLevelIcon(const int batteryLevel) const {
-
-			if(batteryLevel > 80) return res_battery_100;
-			if(batteryLevel > 65) return res_battery_80;
-			if(batteryLevel > 50) return res_battery_65;
-			if(batteryLevel > 35) return res_battery_50;
-			if(batteryLevel > 10) return res_battery_35;
-			return res_battery_10;
+		const Core::Asset* Battery::getBatteryLevelIcon(const int batteryLevel) const {
+
+			if(batteryLevel > 80) return &res_battery_100;
+			if(batteryLevel > 65) return &res_battery_80;
+			if(batteryLevel > 50) return &res_battery_65;
+			if(batteryLevel > 35) return &res_battery_50;
+			if(batteryLevel > 10) return &res_battery_35;
+			return &res_battery_10;
 		}
 
 		/**
@@ -11,7 +11,7 @@ namespace CrowOs {
 		 * Initialise battery factory
 		 */
 		BatteryFactory::BatteryFactory()
-			: FeatureFactory("BatteryFactory", true) {
+			: FeatureFactory(NAME, true) {
 		}
 
 		/**
@@ -24,7 +24,7 @@ namespace CrowOs {
 		 * @return Feature* your feature
 		 */
 		Core::Feature* BatteryFactory::createFeature() {
-			if(LOG_INFO) Serial.println("Info : [BatteryFactory] createFeature Battery");
+			LOG_INFO(BatteryFactory, "createFeature Battery");
 			return new Battery();
 		}
 
@@ -4,16 +4,41 @@
 #include "feature/OmniLevelFactory.hpp"
 #include "feature/PrinterFeatureFactory.hpp"
 
+using CrowOs::Core::FeatureDescriptor;
+using CrowOs::Core::FeatureRegistry;
+
+/** Battery factory */
+static CrowOs::Feature::BatteryFactory batteryFactory;
+
+/** Printer feature factory */
+static CrowOs::Feature::PrinterFeatureFactory printerFeatureFactory;
+
+/** Libelle factory */
+static CrowOs::Feature::LibelleFactory libelleFactory;
+
+/** OmniLevel factory */
+static CrowOs::Feature::OmniLevelFactory omniLevelFactory;
+
 /**
- * Initialise all feature factories
- * You should implement this method in order to declare feature factories to the os
+ * Descriptors of features switched by the user in switching order
+ * You should define this table in order to declare feature factories to the os, see FeatureInitialiser.cpp
  */
-void initialiseFeatureFactories() {
-
-	if(LOG_INFO) Serial.println("Info : [initialiseFeatureFactories] Initializing Factories ...");
-	new CrowOs::Feature::BatteryFactory();
-	new CrowOs::Feature::PrinterFeatureFactory();
-	new CrowOs::Feature::LibelleFactory();
-	new CrowOs::Feature::OmniLevelFactory();
-	if(LOG_INFO) Serial.println("Info : [initialiseFeatureFactories] Initializing Factories Done");
-}
+constexpr FeatureDescriptor FEATURE_DESCRIPTORS[] = {
+	FeatureRegistry::describe(CrowOs::Feature::PrinterFeatureFactory::NAME, &printerFeatureFactory),
+	FeatureRegistry::describe(CrowOs::Feature::LibelleFactory::NAME, &libelleFactory),
+	FeatureRegistry::describe(CrowOs::Feature::OmniLevelFactory::NAME, &omniLevelFactory)};
+
+/** Number of FEATURE_DESCRIPTORS */
+const size_t FEATURE_DESCRIPTORS_SIZE = sizeof FEATURE_DESCRIPTORS / sizeof FEATURE_DESCRIPTORS[0];
+
+/**
+ * Descriptors of alwaysLoop = true features
+ * You should define this table in order to declare permanent feature factories to the os, see FeatureInitialiser.cpp
+ */
+constexpr FeatureDescriptor PERMANENT_FEATURE_DESCRIPTORS[] = {
+	FeatureRegistry::describe(CrowOs::Feature::BatteryFactory::NAME, &batteryFactory)};
+
+/** Number of PERMANENT_FEATURE_DESCRIPTORS */
+const size_t PERMANENT_FEATURE_DESCRIPTORS_SIZE = sizeof PERMANENT_FEATURE_DESCRIPTORS / sizeof PERMANENT_FEATURE_DESCRIPTORS[0];
+
+static_assert(FEATURE_DESCRIPTORS_SIZE <= FeatureRegistry::MAX_FACTORIES && PERMANENT_FEATURE_DESCRIPTORS_SIZE <= FeatureRegistry::MAX_FACTORIES, "raise MAX_FEATURE_FACTORIES");
@@ -8,8 +8,10 @@ namespace CrowOs {
 
 		/**
 		 * Initialise new Libelle
+		 *
+		 * @param state calibration kept by factory
 		 */
-		Libelle::Libelle()
+		Libelle::Libelle(LibelleState& state)
 			: Feature("Libelle")
 			, time(NULL)
 			, screen(NULL)
@@ -20,59 +22,53 @@ namespace CrowOs {
 			, accelerometerYAvg(0)
 			, positionX(30)
 			, positionY(30)
-			, calibrationX(-3)
-			, calibrationY(-29)
-			, radius(15) {
+			, state(state)
+			, radius(15)
+			, sprite()
+			, drawnX(-1)
+			, drawnY(-1)
+			, drawnCalibrationColor(-1) {
 		}
 
 		/**
 		 * Called after Feature creation before loop when state changes to this feature
-		 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+		 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 		 *
 		 * @param screenHelper Screen helper used to manage screen
 		 * @param timeHelper   Time helper used to manage upTime and sleepTime
 		 * @param ledHelper    Led helper used to manage Led state
-		 * @param savedData    pointer to feature persistent data
 		 */
-		void Libelle::onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) {
+		void Libelle::onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* /* ledHelper */) {
 
-			if(LOG_INFO) Serial.println("Info : [Libelle] onStart");
+			LOG_INFO(Libelle, "onStart");
 
 			// Strore useful helpers
 			screen = screenHelper;
 			time = timeHelper;
 
-			// Get saved data
-			if(LOG_DEBUG) Serial.printf("Debug : [Libelle] onStart calibrationX = %f, calibrationY = %f", calibrationX, calibrationY);
-			if(savedData != NULL) {
-				calibrationX = (*savedData)["calibrationX"];
-				calibrationY = (*savedData)["calibrationY"];
-			}
-			if(LOG_DEBUG) Serial.printf(", new calibrationX = %f, calibrationY = %f\n", calibrationX, calibrationY);
+			LOG_DEBUG(Libelle, "onStart calibrationX = %f, calibrationY = %f", state.calibrationX, state.calibrationY);
 
 			// Clear screen
 			screen->setScreenOrientation(Core::Screen::SCREEN_RIGHT_LANDSCAPE);
 			screen->setBackground(backgroundColor);
 			screen->clearLCD();
 			screen->printText("Calibrate", 15, 152, TFT_CYAN);
+
+			// Nothing of the libelle is on screen yet
+			if(sprite.getWidth() != SPRITE_SIZE) sprite.create(SPRITE_SIZE, SPRITE_SIZE);
+			drawnX = -1;
+			drawnY = -1;
+			drawnCalibrationColor = -1;
 		}
 
 		/**
 		 * Called before Feature destroying after loop when state changes from this feature to another
-		 * You should destroy all your variables here and save the persistent one into savedData pointer
-		 *
-		 * @param savedData pointer to feature persistent data
+		 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
 		 */
-		void Libelle::onStop(DynamicJsonDocument* savedData) {
+		void Libelle::onStop() {
 
-			if(LOG_INFO) Serial.println("Info : [Libelle] onStop");
-
-			if(savedData != NULL) {
-				(*savedData)["calibrationX"] = calibrationX;
-				(*savedData)["calibrationY"] = calibrationY;
-
-				if(LOG_DEBUG) Serial.printf("Debug : [Libelle] onStop saved calibrationX = %f, calibrationY = %f\n", calibrationX, calibrationY);
-			}
+			LOG_INFO(Libelle, "onStop");
+			LOG_DEBUG(Libelle, "onStop calibrationX = %f, calibrationY = %f", state.calibrationX, state.calibrationY);
 		}
 
 		/**
@@ -81,10 +77,9 @@ namespace CrowOs {
 		 */
 		void Libelle::loop() {
 
-			drawCalibrationCircle();
-			drawCircle(true);
 			updatePositions();
-			drawCircle();
+			bool calibrationChanged = drawCalibrationCircle();
+			drawCircle(calibrationChanged);
 		}
 
 		/**
@@ -94,9 +89,9 @@ namespace CrowOs {
 
 			time->keepWokedUp();
 
-			calibrationX = -accelerometerXAvg;
-			calibrationY = -accelerometerYAvg;
-			if(LOG_DEBUG) Serial.printf("Debug : [Libelle] onHomeClick calibrate calibrationX = %f, calibrationY = %f\n", calibrationX, calibrationY);
+			state.calibrationX = -accelerometerXAvg;
+			state.calibrationY = -accelerometerYAvg;
+			LOG_DEBUG(Libelle, "onHomeClick calibrate calibrationX = %f, calibrationY = %f", state.calibrationX, state.calibrationY);
 		}
 
 		/**
@@ -106,9 +101,9 @@ namespace CrowOs {
 
 			time->keepWokedUp();
 
-			calibrationX = -3;
-			calibrationY = -29;
-			if(LOG_DEBUG) Serial.printf("Debug : [Libelle] onHomeDoubleClick reset calibrate calibrationX = %f, calibrationY = %f\n", calibrationX, calibrationY);
+			state.calibrationX = -3;
+			state.calibrationY = -29;
+			LOG_DEBUG(Libelle, "onHomeDoubleClick reset calibrate calibrationX = %f, calibrationY = %f", state.calibrationX, state.calibrationY);
 		}
 
 		/**
@@ -121,7 +116,7 @@ namespace CrowOs {
 			float accZ = 0;
 
 			// Get data from mpu
-			M5.MPU6886.getAccelData(&accX, &accY, &accZ);
+			Core::Hal::Imu::getAccelData(&accX, &accY, &accZ);
 
 			// push back values
 			accelerometerX.push_back(round(accY * 100) * 2);
@@ -149,8 +144,8 @@ namespace CrowOs {
 			}
 
 			// Calculate x and y positions
-			positionX = accelerometerXAvg + ((screen->getMaxX() / 2) + calibrationX);
-			positionY = accelerometerYAvg + ((screen->getMaxY() / 2 + screen->getMinY() / 2) + calibrationY);
+			positionX = accelerometerXAvg + ((screen->getMaxX() / 2) + state.calibrationX);
+			positionY = accelerometerYAvg + ((screen->getMaxY() / 2 + screen->getMinY() / 2) + state.calibrationY);
 
 			// Be sure we are not out of the screen on x axis
 			if(positionX + radius >= screen->getMaxX()) positionX = screen->getMaxX() - radius;
@@ -161,38 +156,95 @@ namespace CrowOs {
 			if(positionY - radius <= screen->getMinY(positionX - radius)) positionY = screen->getMinY(positionX - radius) + radius;
 			if(positionY - radius <= screen->getMinY(positionX + radius)) positionY = screen->getMinY(positionX + radius) + radius;
 
-			if(LOG_DEBUG) Serial.printf("Debug : [Libelle] updatePositions positionX = %d, positionY = %d, accelerometerXAvg = %f, accelerometerYAvg = %f\n", positionX, positionY, accelerometerXAvg, accelerometerYAvg);
+			LOG_DEBUG(Libelle, "updatePositions positionX = %d, positionY = %d, accelerometerXAvg = %f, accelerometerYAvg = %f", positionX, positionY, accelerometerXAvg, accelerometerYAvg);
 		}
 
 		/**
 		 * Draw accelerometer circle
+		 * Union of old and new circle boxes is composited off screen and pushed once, nothing is drawn if circle did not move
 		 *
-		 * @param clear if true than it will use background color
+		 * @param force if true circle is drawn even if it did not move
 		 */
-		void Libelle::drawCircle(const bool clear /* = false */) {
+		void Libelle::drawCircle(const bool force /* = false */) {
 
-			if(clear) {
-				M5.Lcd.fillCircle(positionX, positionY, radius, backgroundColor);
-				if(LOG_DEBUG) Serial.printf("Debug : [Libelle] drawCircle clear = true, positionX = %d, positionY = %d\n", positionX, positionY);
+			if(!force && positionX == drawnX && positionY == drawnY) return;
+
+			int size = 2 * radius + 1;
+			int x = positionX - radius;
+			int y = positionY - radius;
+
+			if(drawnX == -1) {
+				compositeArea(x, y, size, size);
 			}
 			else {
-				M5.Lcd.pushImage(positionX - radius + 1, positionY - radius + 1, 29, 28, res_circle, 0x0000);
-				if(LOG_DEBUG) Serial.printf("Debug : [Libelle] drawCircle clear = false, positionX = %d, positionY = %d\n", positionX, positionY);
+
+				int left = std::min(x, drawnX - radius);
+				int top = std::min(y, drawnY - radius);
+				int width = std::max(x, drawnX - radius) + size - left;
+				int height = std::max(y, drawnY - radius) + size - top;
+
+				// Circle moved too far for the sprite, composite old and new boxes separately
+				if(width > SPRITE_SIZE || height > SPRITE_SIZE) {
+					compositeArea(drawnX - radius, drawnY - radius, size, size);
+					compositeArea(x, y, size, size);
+				}
+				else {
+					compositeArea(left, top, width, height);
+				}
 			}
+
+			drawnX = positionX;
+			drawnY = positionY;
+			LOG_DEBUG(Libelle, "drawCircle positionX = %d, positionY = %d", positionX, positionY);
 		}
 
 		/**
-		 * Draw calibration circle
+		 * Composites screen area into sprite with background, calibration circle and accelerometer circle then pushes it
+		 *
+		 * @param x area x position
+		 * @param y area y position
+		 * @param w area width, at most SPRITE_SIZE
+		 * @param h area height, at most SPRITE_SIZE
 		 */
-		void Libelle::drawCalibrationCircle() {
+		void Libelle::compositeArea(const int x, const int y, const int w, const int h) {
+
+			int centerX = (screen->getMaxX() / 2);
+			int centerY = (screen->getMaxY() / 2 + screen->getMinY() / 2);
+
+			sprite.fillScreen(backgroundColor);
+			sprite.drawCircle(centerX - x, centerY - y, radius + 5, drawnCalibrationColor);
+			Core::Screen::drawAsset(sprite, positionX - radius + 1 - x, positionY - radius + 1 - y, res_circle, 0x0000);
+			screen->pushSprite(x, y, sprite, w, h);
+		}
+
+		/**
+		 * Draw calibration circle when its color changes
+		 *
+		 * @return true if calibration circle was drawn
+		 */
+		const bool Libelle::drawCalibrationCircle() {
 
 			uint16_t color = TFT_RED;
 			int x = (screen->getMaxX() / 2);
 			int y = (screen->getMaxY() / 2 + screen->getMinY() / 2);
 
 			if(abs(x - positionX) < 5 && abs(y - positionY) < 5) color = TFT_GREEN;
+			if(color == drawnCalibrationColor) return false;
+
+			// Calibration circle may be drawn over accelerometer circle so it has to be redrawn
+			screen->drawCircle(x, y, radius + 5, color);
+			drawnCalibrationColor = color;
+			return true;
+		}
 
-			M5.Lcd.drawCircle(x, y, radius + 5, color);
+		/**
+		 * Gets frame rate wanted while feature needs frames
+		 * Bubble follows the imu, a higher rate makes it glide instead of jump
+		 *
+		 * @return target fps
+		 */
+		const double Libelle::getTargetFps() const {
+			return 50;
 		}
 
 	} // namespace Feature
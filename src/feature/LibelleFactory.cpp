@@ -11,7 +11,7 @@ namespace CrowOs {
 		 * Initialise libelle factory
 		 */
 		LibelleFactory::LibelleFactory()
-			: FeatureFactory("LibelleFactory") {
+			: StatefulFeatureFactory(NAME, {-3, -29}) {
 		}
 
 		/**
@@ -24,8 +24,28 @@ namespace CrowOs {
 		 * @return Feature* your feature
 		 */
 		Core::Feature* LibelleFactory::createFeature() {
-			if(LOG_INFO) Serial.println("Info : [LibelleFactory] createFeature Libelle");
-			return new Libelle();
+			LOG_INFO(LibelleFactory, "createFeature Libelle");
+			return new Libelle(state);
+		}
+
+		/**
+		 * Restores state from saved data, missing fields keep their actual value
+		 *
+		 * @param savedData parsed saved data
+		 */
+		void LibelleFactory::readState(const JsonDocument& savedData) {
+			state.calibrationX = savedData["calibrationX"] | state.calibrationX;
+			state.calibrationY = savedData["calibrationY"] | state.calibrationY;
+		}
+
+		/**
+		 * Writes state into saved data
+		 *
+		 * @param savedData to fill
+		 */
+		void LibelleFactory::writeState(JsonDocument& savedData) const {
+			savedData["calibrationX"] = state.calibrationX;
+			savedData["calibrationY"] = state.calibrationY;
 		}
 
 	} // namespace Feature
@@ -6,31 +6,46 @@
 namespace CrowOs {
 	namespace Feature {
 
+// Expands to the rainbow colors of 4, 16 and 64 consecutive values
+#define RAINBOW_4(value) rainbow(value), rainbow(value + 1), rainbow(value + 2), rainbow(value + 3)
+#define RAINBOW_16(value) RAINBOW_4(value), RAINBOW_4(value + 4), RAINBOW_4(value + 8), RAINBOW_4(value + 12)
+#define RAINBOW_64(value) RAINBOW_16(value), RAINBOW_16(value + 16), RAINBOW_16(value + 32), RAINBOW_16(value + 48)
+
+		/** Progress bar color of each pressure value */
+		const uint16_t OmniLevel::RAINBOW[128] = {RAINBOW_64(0), RAINBOW_64(64)};
+
+#undef RAINBOW_64
+#undef RAINBOW_16
+#undef RAINBOW_4
+
 		/**
 		 * Initialise new OmniLevel
+		 *
+		 * @param state calibration kept by factory
 		 */
-		OmniLevel::OmniLevel()
+		OmniLevel::OmniLevel(OmniLevelState& state)
 			: Feature("OmniLevel")
 			, ERROR_THRESHOLD(5.0)
 			, screen(NULL)
 			, led(NULL)
 			, time(NULL)
 			, currentPressure(0)
-			, savedPressure(50) {
+			, state(state)
+			, drawnPressure(-1)
+			, shownIndicator(NULL) {
 		}
 
 		/**
 		 * Called after Feature creation before loop when state changes to this feature
-		 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+		 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 		 *
 		 * @param screenHelper Screen helper used to manage screen
 		 * @param timeHelper   Time helper used to manage upTime and sleepTime
 		 * @param ledHelper    Led helper used to manage Led state
-		 * @param savedData    pointer to feature persistent data
 		 */
-		void OmniLevel::onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) {
+		void OmniLevel::onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper) {
 
-			if(LOG_INFO) Serial.println("Info : [OmniLevel] onStart");
+			LOG_INFO(OmniLevel, "onStart");
 
 			// Strore useful helpers
 			screen = screenHelper;
@@ -41,18 +56,17 @@ namespace CrowOs {
 			screen->setScreenOrientation(Core::Screen::SCREEN_NORMAL_PORTRET);
 			screen->setBackground(TFT_BLACK);
 			screen->clearLCD();
+			drawnPressure = -1;
+			shownIndicator = NULL;
 
-			// Get saved data
-			if(LOG_DEBUG) Serial.printf("Debug : [OmniLevel] onStart savedPressure = %d", savedPressure);
-			if(savedData != NULL) savedPressure = (*savedData)["pressure"];
-			if(LOG_DEBUG) Serial.printf(", new savedPressure = %d\n", savedPressure);
+			LOG_DEBUG(OmniLevel, "onStart savedPressure = %d", state.savedPressure);
 
 			// Draw progress bar rectangle
-			M5.Lcd.drawRect(5, 17, 21, 134, 0x7bef);
+			screen->drawRect(5, 17, 21, 134, 0x7bef);
 
 			// Draw calibration line
-			M5.Lcd.drawLine(1, 18 + (127 - savedPressure), 4, 18 + (127 - savedPressure), 0x7bef);
-			M5.Lcd.drawLine(26, 18 + (127 - savedPressure), 29, 18 + (127 - savedPressure), 0x7bef);
+			screen->drawLine(1, 18 + (127 - state.savedPressure), 4, 18 + (127 - state.savedPressure), 0x7bef);
+			screen->drawLine(26, 18 + (127 - state.savedPressure), 29, 18 + (127 - state.savedPressure), 0x7bef);
 
 			// Draw calibration instructions
 			screen->clearText(9, 15, 152);
@@ -61,15 +75,12 @@ namespace CrowOs {
 
 		/**
 		 * Called before Feature destroying after loop when state changes from this feature to another
-		 * You should destroy all your variables here and save the persistent one into savedData pointer
-		 *
-		 * @param savedData pointer to feature persistent data
+		 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
 		 */
-		void OmniLevel::onStop(DynamicJsonDocument* savedData) {
+		void OmniLevel::onStop() {
 
-			if(LOG_INFO) Serial.println("Info : [OmniLevel] onStop");
-			if(savedData != NULL) (*savedData)["pressure"] = savedPressure;
-			if(LOG_INFO) Serial.printf("Info : [OmniLevel] onStop savedPressure = %d\n", savedPressure);
+			LOG_INFO(OmniLevel, "onStop");
+			LOG_INFO(OmniLevel, "onStop savedPressure = %d", state.savedPressure);
 		}
 
 		/**
@@ -78,23 +89,23 @@ namespace CrowOs {
 		 */
 		void OmniLevel::loop() {
 
-			currentPressure = map(analogRead(G36), 0, 3095, 0, 127);
-			if(LOG_DEBUG) Serial.printf("Debug : [OmniLevel] loop currentPressure = %d, savedPressure = %d\n", currentPressure, savedPressure);
+			currentPressure = min(max((int)map(Core::Hal::Adc::read(G36), 0, 3095, 0, 127), 0), 127);
+			LOG_DEBUG(OmniLevel, "loop currentPressure = %d, savedPressure = %d", currentPressure, state.savedPressure);
 
 			progressBar();
 
-			if(getPercentError(currentPressure, savedPressure) < ERROR_THRESHOLD) {
+			if(getPercentError(currentPressure, state.savedPressure) < ERROR_THRESHOLD) {
 				led->on();
-				M5.Lcd.pushImage(40, 50, 32, 32, thumbs_up);
+				showIndicator(thumbs_up);
 			}
 			else {
 				led->off();
 
-				if(currentPressure > savedPressure) {
-					M5.Lcd.pushImage(40, 50, 32, 32, rotate_left);
+				if(currentPressure > state.savedPressure) {
+					showIndicator(rotate_left);
 				}
 				else {
-					M5.Lcd.pushImage(40, 50, 32, 32, rotate_right);
+					showIndicator(rotate_right);
 				}
 			}
 		}
@@ -135,77 +146,61 @@ namespace CrowOs {
 		 */
 		void OmniLevel::updateCalibration(const int pressure) {
 
-			if(pressure == savedPressure) return;
+			if(pressure == state.savedPressure) return;
 
-			if(LOG_DEBUG) Serial.printf("Debug : [OmniLevel] updateCalibration new pressure = %d\n", pressure);
+			LOG_DEBUG(OmniLevel, "updateCalibration new pressure = %d", pressure);
 
 			// clear old line
-			M5.Lcd.drawLine(1, 18 + (127 - savedPressure), 4, 18 + (127 - savedPressure), BLACK);
-			M5.Lcd.drawLine(26, 18 + (127 - savedPressure), 29, 18 + (127 - savedPressure), BLACK);
+			screen->drawLine(1, 18 + (127 - state.savedPressure), 4, 18 + (127 - state.savedPressure), BLACK);
+			screen->drawLine(26, 18 + (127 - state.savedPressure), 29, 18 + (127 - state.savedPressure), BLACK);
 
-			savedPressure = pressure;
-			M5.Lcd.drawLine(1, 18 + (127 - savedPressure), 4, 18 + (127 - savedPressure), 0x7bef);
-			M5.Lcd.drawLine(26, 18 + (127 - savedPressure), 29, 18 + (127 - savedPressure), 0x7bef);
+			state.savedPressure = pressure;
+			screen->drawLine(1, 18 + (127 - state.savedPressure), 4, 18 + (127 - state.savedPressure), 0x7bef);
+			screen->drawLine(26, 18 + (127 - state.savedPressure), 29, 18 + (127 - state.savedPressure), 0x7bef);
 		}
 
 		/**
 		 * Draw progress bar from currentPressure
+		 * Only rows between drawnPressure and currentPressure are painted
 		 */
 		void OmniLevel::progressBar() {
 
-			for(int i = currentPressure; i <= 127; i++) {
-				M5.Lcd.fillRect(8, 147 - i, 15, 1, BLACK);
+			if(currentPressure == drawnPressure) return;
+
+			// Grow bar with its gradient
+			for(int i = drawnPressure + 1; i <= currentPressure; i++) {
+				screen->fillRect(8, 147 - i, 15, 1, RAINBOW[i]);
 			}
-			for(int i = 0; i <= currentPressure; i++) {
-				M5.Lcd.fillRect(8, 147 - i, 15, 1, rainbow(i));
+			// Shrink bar, first drawing also clears the whole column
+			for(int i = currentPressure + 1; i <= (drawnPressure == -1 ? 127 : drawnPressure); i++) {
+				screen->fillRect(8, 147 - i, 15, 1, BLACK);
 			}
-			// Draw progress bar rectangle
-			M5.Lcd.drawRect(5, 17, 21, 134, 0x7bef);
+
+			LOG_DEBUG(OmniLevel, "progressBar drawnPressure = %d, currentPressure = %d", drawnPressure, currentPressure);
+			drawnPressure = currentPressure;
 		}
 
 		/**
-		 * Gets progresss bar rainbow colour
-		 * The value is converted to a spectrum colour from 0 = blue through to red = blue
+		 * Shows leveling indicator image if it changed
 		 *
-		 * @method rainbow
-		 * @param value expected to be in range 0-127
-		 *
-		 * @return a spectrum colour from 0 = blue through to red = blue
+		 * @param indicator image to show
 		 */
-		unsigned int OmniLevel::rainbow(int value) {
-
-			// Red is the top 5 bits of a 16 bit colour value
-			byte red = 0;
+		void OmniLevel::showIndicator(const Core::Asset& indicator) {
 
-			// Green is the middle 6 bits
-			byte green = 0;
+			if(shownIndicator == &indicator) return;
 
-			// Blue is the bottom 5 bits
-			byte blue = 0;
-
-			byte quadrant = value / 32;
+			screen->pushAsset(40, 50, indicator);
+			shownIndicator = &indicator;
+		}
 
-			if(quadrant == 0) {
-				blue = 31;
-				green = 2 * (value % 32);
-				red = 0;
-			}
-			if(quadrant == 1) {
-				blue = 31 - (value % 32);
-				green = 63;
-				red = 0;
-			}
-			if(quadrant == 2) {
-				blue = 0;
-				green = 63;
-				red = value % 32;
-			}
-			if(quadrant == 3) {
-				blue = 0;
-				green = 63 - 2 * (value % 32);
-				red = 31;
-			}
-			return (red << 11) + (green << 5) + blue;
+		/**
+		 * Gets frame rate wanted while feature needs frames
+		 * Pressure gauge only needs to follow the hand
+		 *
+		 * @return target fps
+		 */
+		const double OmniLevel::getTargetFps() const {
+			return 20;
 		}
 
 	} // namespace Feature
@@ -11,7 +11,7 @@ namespace CrowOs {
 		 * Initialise OmniLevelFactory factory
 		 */
 		OmniLevelFactory::OmniLevelFactory()
-			: FeatureFactory("OmniLevelFactory") {
+			: StatefulFeatureFactory(NAME, {50}) {
 		}
 
 		/**
@@ -24,8 +24,26 @@ namespace CrowOs {
 		 * @return Feature* your feature
 		 */
 		Core::Feature* OmniLevelFactory::createFeature() {
-			if(LOG_INFO) Serial.println("Info : [OmniLevelFactory] createFeature OmniLevel");
-			return new OmniLevel();
+			LOG_INFO(OmniLevelFactory, "createFeature OmniLevel");
+			return new OmniLevel(state);
+		}
+
+		/**
+		 * Restores state from saved data, missing fields keep their actual value
+		 *
+		 * @param savedData parsed saved data
+		 */
+		void OmniLevelFactory::readState(const JsonDocument& savedData) {
+			state.savedPressure = savedData["pressure"] | state.savedPressure;
+		}
+
+		/**
+		 * Writes state into saved data
+		 *
+		 * @param savedData to fill
+		 */
+		void OmniLevelFactory::writeState(JsonDocument& savedData) const {
+			savedData["pressure"] = state.savedPressure;
 		}
 
 	} // namespace Feature
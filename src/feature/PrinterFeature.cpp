@@ -8,43 +8,47 @@ namespace CrowOs {
 
 		/**
 		 * Initialise new PrinterFeature
+		 *
+		 * @param state       current printer kept by factory
+		 * @param webClient   web client kept by factory
+		 * @param printerList fetched printers kept by factory
 		 */
-		PrinterFeature::PrinterFeature()
+		PrinterFeature::PrinterFeature(PrinterFeatureState& state, Core::WebClient& webClient, PrinterList& printerList)
 			: Feature("PrinterFeature")
 			, FETCH_BACKEND_DELAY(5000)
 			, screen(NULL)
-			, webClient(BACKEND_HOST, BACKEND_PORT, BACKEND_USER_USERNAME, BACKEND_USER_PASSWORD, BACKEND_BASE_PATH)
+			, webClient(webClient)
 			, shouldRedrawScreen(true)
-			, lastPrinterListFetch(0)
-			, lastPrinterFetch(0)
+			, printerListFetchTimer(Core::Scheduler::NO_TIMER)
+			, printerFetchTimer(Core::Scheduler::NO_TIMER)
+			, printerListRequest(Core::NetworkTask::NO_REQUEST)
+			, printerRequest(Core::NetworkTask::NO_REQUEST)
+			, ledColorRequest(Core::NetworkTask::NO_REQUEST)
+			, fetchedPrinterIndex(0)
 			, foregroundColor(TFT_CYAN)
 			, backgroundColor(0x2A)
-			, printerSize(0)
-			, printerIndex(0)
+			, state(state)
 			, viewIndex(0)
-			, printers({}) {
+			, printerList(printerList)
+			, drawnListVersion(printerList.version) {
 		}
 
 		/**
 		 * Called after Feature creation before loop when state changes to this feature
-		 * You should initialise all your variables here and restore savedData to your class if savedData is not null
+		 * You should initialise all your variables here, persistent ones are read from state given by the feature factory
 		 *
 		 * @param screenHelper Screen helper used to manage screen
 		 * @param timeHelper   Time helper used to manage upTime and sleepTime
 		 * @param ledHelper    Led helper used to manage Led state
-		 * @param savedData    pointer to feature persistent data
 		 */
-		void PrinterFeature::onStart(Core::Screen* screenHelper, Core::Time* timeHelper, Core::Led* ledHelper, DynamicJsonDocument* savedData) {
+		void PrinterFeature::onStart(Core::Screen* screenHelper, Core::Time* /* timeHelper */, Core::Led* /* ledHelper */) {
 
-			if(LOG_INFO) Serial.println("Info : [PrinterFeature] onStart");
+			LOG_INFO(PrinterFeature, "onStart");
 
 			// Strore useful helpers
 			screen = screenHelper;
 
-			// Get saved data
-			if(LOG_DEBUG) Serial.printf("Debug : [PrinterFeature] onStart printerIndex = %d", printerIndex);
-			if(savedData != NULL) printerIndex = (*savedData)["printerIndex"];
-			if(LOG_DEBUG) Serial.printf(", new printerIndex = %d\n", printerIndex);
+			LOG_DEBUG(PrinterFeature, "onStart printerIndex = %d, printerSize = %d", state.printerIndex, printerList.printerSize);
 
 			// Clear screen and show frame fro progress bar
 			screen->setScreenOrientation(Core::Screen::SCREEN_RIGHT_LANDSCAPE);
@@ -54,15 +58,69 @@ namespace CrowOs {
 
 		/**
 		 * Called before Feature destroying after loop when state changes from this feature to another
-		 * You should destroy all your variables here and save the persistent one into savedData pointer
+		 * You should destroy all your variables here, persistent ones are already in state given by the feature factory
+		 */
+		void PrinterFeature::onStop() {
+
+			LOG_INFO(PrinterFeature, "onStop");
+			Core::Scheduler::cancel(printerListFetchTimer);
+			Core::Scheduler::cancel(printerFetchTimer);
+
+			// responses must not call back into a destroyed feature
+			Core::NetworkTask::cancel(printerListRequest);
+			Core::NetworkTask::cancel(printerRequest);
+			Core::NetworkTask::cancel(ledColorRequest);
+			LOG_INFO(PrinterFeature, "onStop printerIndex = %d", state.printerIndex);
+		}
+
+		/**
+		 * Indicates if feature can be suspended instead of being destroyed when state changes from this feature to another
+		 * Hold off timers are kept so that switching back shows printers without fetching them again
 		 *
-		 * @param savedData pointer to feature persistent data
+		 * @return true
+		 */
+		const bool PrinterFeature::canSuspend() const {
+			return true;
+		}
+
+		/**
+		 * Called after loop instead of onStop when state changes from this feature to another and feature can be suspended
+		 * Pending requests are cancelled, printers are kept
 		 */
-		void PrinterFeature::onStop(DynamicJsonDocument* savedData) {
+		void PrinterFeature::onSuspend() {
+
+			LOG_INFO(PrinterFeature, "onSuspend printerSize = %d", printerList.printerSize);
 
-			if(LOG_INFO) Serial.println("Info : [PrinterFeature] onStop");
-			if(savedData != NULL) (*savedData)["printerIndex"] = printerIndex;
-			if(LOG_INFO) Serial.printf("Info : [PrinterFeature] onStop printerIndex = %d\n", printerIndex);
+			// a cancelled fetch is sent again as soon as feature is resumed, otherwise hold off timers keep running
+			if(Core::NetworkTask::isPending(printerListRequest)) Core::Scheduler::cancel(printerListFetchTimer);
+			if(Core::NetworkTask::isPending(printerRequest)) Core::Scheduler::cancel(printerFetchTimer);
+
+			// responses must not call back into a feature that is not shown
+			Core::NetworkTask::cancel(printerListRequest);
+			Core::NetworkTask::cancel(printerRequest);
+			Core::NetworkTask::cancel(ledColorRequest);
+		}
+
+		/**
+		 * Called instead of onStart when state changes back to this suspended feature
+		 * Kept printers are drawn on first frame
+		 *
+		 * @param screenHelper Screen helper used to manage screen
+		 * @param timeHelper   Time helper used to manage upTime and sleepTime
+		 * @param ledHelper    Led helper used to manage Led state
+		 */
+		void PrinterFeature::onResume(Core::Screen* screenHelper, Core::Time* /* timeHelper */, Core::Led* /* ledHelper */) {
+
+			LOG_INFO(PrinterFeature, "onResume printerSize = %d", printerList.printerSize);
+
+			// Strore useful helpers
+			screen = screenHelper;
+
+			// kept printers are redrawn on a cleared screen, they are fetched again once hold off timers expire
+			screen->setScreenOrientation(Core::Screen::SCREEN_RIGHT_LANDSCAPE);
+			screen->setBackground(backgroundColor);
+			screen->clearLCD();
+			shouldRedrawScreen = true;
 		}
 
 		/**
@@ -71,6 +129,12 @@ namespace CrowOs {
 		 */
 		void PrinterFeature::loop() {
 
+			// printers list may have been prefetched by factory while this feature was shown
+			if(drawnListVersion != printerList.version) {
+				drawnListVersion = printerList.version;
+				shouldRedrawScreen = true;
+			}
+
 			if(viewIndex == 0) {
 				fetchPrinterList();
 				showPrintersMenu();
@@ -86,37 +150,93 @@ namespace CrowOs {
 		 */
 		void PrinterFeature::fetchPrinterList() {
 
-			if(millis() - lastPrinterListFetch > FETCH_BACKEND_DELAY) {
+			if(!Core::Scheduler::isScheduled(printerListFetchTimer) && !Core::NetworkTask::isPending(printerListRequest)) {
 
-				if(LOG_INFO) Serial.println("Info : [PrinterFeature] fetchPrinterList");
+				LOG_INFO(PrinterFeature, "fetchPrinterList");
 
-				DynamicJsonDocument responseBody(MAX_JSON_DOCUMENT_SIZE);
-				int status = webClient.sendGET("printer", responseBody);
-				if(status != 200) {
-					char err[15];
-					sprintf(err, "server er:%d", status);
-					screen->showError(err, FETCH_BACKEND_DELAY);
-					shouldRedrawScreen = false;
-					return;
-				}
+				printerListFetchTimer = Core::Scheduler::schedule(FETCH_BACKEND_DELAY, NULL, NULL);
+				printerListRequest = submitPrinterList(webClient, onPrinterListResponse, this);
+			}
+		}
+
+		/**
+		 * Submits printer list request
+		 *
+		 * @param webClient used to send request
+		 * @param callback  called on main loop when request completes
+		 * @param context   passed to callback
+		 * @return request handle
+		 */
+		Core::RequestId PrinterFeature::submitPrinterList(Core::WebClient& webClient, Core::ResponseCallback callback, void* context) {
+
+			// printer list only needs the fields of the menu, filter applies to every array element
+			StaticJsonDocument<JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(4)> filter;
+			filter[0]["id"] = true;
+			filter[0]["machineName"] = true;
+			filter[0]["machineIp"] = true;
+			filter[0]["machinePort"] = true;
+
+			return webClient.submitGET("printer", callback, context, &filter);
+		}
 
-				JsonArray printerDtos = responseBody.as<JsonArray>();
-				printerSize = printerDtos.size();
+		/**
+		 * Stores fetched printer list
+		 *
+		 * @param status       http status
+		 * @param responseBody fetched printer list
+		 */
+		void PrinterFeature::onPrinterList(const int status, JsonDocument& responseBody) {
 
-				for(int i = 0; i < printerSize; i++) {
+			LOG_INFO(PrinterFeature, "onPrinterList status = %d", status);
 
-					Printer printer;
+			// list did not change since last response, neither parse nor redraw it
+			if(status == Core::HttpCache::NOT_MODIFIED) return;
 
-					printer.id = printerDtos[i]["id"];
-					strncpy(printer.machineName, printerDtos[i]["machineName"] | "\0", 27);
-					strncpy(printer.machineIp, printerDtos[i]["machineIp"] | "\0", 27);
-					printer.machinePort = printerDtos[i]["machinePort"];
-					printers[i] = printer;
+			if(status != 200) {
+				char err[15];
+				sprintf(err, "server er:%d", status);
+				screen->showError(err, FETCH_BACKEND_DELAY);
+				shouldRedrawScreen = false;
+				return;
+			}
+
+			readPrinterList(responseBody, printerList, webClient);
+			drawnListVersion = printerList.version;
+			shouldRedrawScreen = true;
+		}
+
+		/**
+		 * Reads fetched printer list
+		 *
+		 * @param responseBody fetched printer list
+		 * @param printerList  to fill
+		 * @param webClient    whose cached printers are invalidated when they moved in list
+		 */
+		void PrinterFeature::readPrinterList(JsonDocument& responseBody, PrinterList& printerList, Core::WebClient& webClient) {
+
+			JsonArray printerDtos = responseBody.as<JsonArray>();
+			printerList.printerSize = min((int)printerDtos.size(), 5);
+
+			for(int i = 0; i < printerList.printerSize; i++) {
+
+				// details of a printer that moved are stale, they have to be fetched again instead of being reported unchanged
+				long id = printerDtos[i]["id"];
+				if(printerList.printers[i].id != id) {
+					char uri[16];
+					sprintf(uri, "printer/%ld", id);
+					webClient.invalidate(uri);
+					printerList.printers[i] = Printer();
 				}
 
-				lastPrinterListFetch = millis();
-				shouldRedrawScreen = true;
+				Printer& printer = printerList.printers[i];
+
+				printer.id = id;
+				strncpy(printer.machineName, printerDtos[i]["machineName"] | "\0", 27);
+				strncpy(printer.machineIp, printerDtos[i]["machineIp"] | "\0", 27);
+				printer.machinePort = printerDtos[i]["machinePort"];
 			}
+
+			printerList.version++;
 		}
 
 		/**
@@ -124,60 +244,81 @@ namespace CrowOs {
 		 */
 		void PrinterFeature::fetchPrinter() {
 
-			if(millis() - lastPrinterFetch > FETCH_BACKEND_DELAY) {
+			if(!Core::Scheduler::isScheduled(printerFetchTimer) && !Core::NetworkTask::isPending(printerRequest)) {
+
+				LOG_INFO(PrinterFeature, "fetchPrinter");
 
-				if(LOG_INFO) Serial.println("Info : [PrinterFeature] fetchPrinter");
+				printerFetchTimer = Core::Scheduler::schedule(FETCH_BACKEND_DELAY, NULL, NULL);
 
-				lastPrinterFetch = millis();
+				StaticJsonDocument<JSON_OBJECT_SIZE(15)> filter;
+				const char* fields[] = {"id", "machineName", "machineIp", "machinePort", "ledColor", "x", "maxX", "y", "maxY", "z", "maxZ", "temperatureExtruderLeft", "temperatureExtruderRight", "temperatureBed", "printingProgress"};
+				for(const char* field : fields) {
+					filter[field] = true;
+				}
 
-				DynamicJsonDocument printerDto(MAX_JSON_DOCUMENT_SIZE);
 				char uri[16];
-				sprintf(uri, "printer/%ld", printers[printerIndex].id);
+				sprintf(uri, "printer/%ld", printerList.printers[state.printerIndex].id);
 
-				int status = webClient.sendGET(uri, printerDto);
-				if(status != 200) {
-					char err[screen->getMaxXCharacters()];
+				fetchedPrinterIndex = state.printerIndex;
+				printerRequest = webClient.submitGET(uri, onPrinterResponse, this, &filter);
+			}
+		}
 
-					if(status == 503) {
-						sprintf(err, "server er: printer is off");
-					}
-					else {
-						sprintf(err, "server er:%d", status);
-					}
+		/**
+		 * Stores fetched printer
+		 *
+		 * @param status     http status
+		 * @param printerDto fetched printer
+		 */
+		void PrinterFeature::onPrinter(const int status, JsonDocument& printerDto) {
+
+			LOG_INFO(PrinterFeature, "onPrinter status = %d", status);
 
-					screen->showError(err, FETCH_BACKEND_DELAY);
-					viewIndex = 0;
-					shouldRedrawScreen = false;
-					screen->clearLCD();
-					return;
+			if(status == Core::HttpCache::NOT_MODIFIED) return;
+
+			if(status != 200) {
+				char err[screen->getMaxXCharacters()];
+
+				if(status == 503) {
+					sprintf(err, "server er: printer is off");
+				}
+				else {
+					sprintf(err, "server er:%d", status);
 				}
 
-				printers[printerIndex].id = printerDto["id"];
+				screen->showError(err, FETCH_BACKEND_DELAY);
+				viewIndex = 0;
+				shouldRedrawScreen = false;
+				screen->clearLCD();
+				return;
+			}
 
-				strncpy(printers[printerIndex].machineName, printerDto["machineName"] | "\0", 27);
-				strncpy(printers[printerIndex].machineIp, printerDto["machineIp"] | "\0", 27);
+			Printer& printer = printerList.printers[fetchedPrinterIndex];
 
-				printers[printerIndex].machinePort = printerDto["machinePort"];
+			printer.id = printerDto["id"];
 
-				strncpy(printers[printerIndex].ledColor, printerDto["ledColor"] | "\0", 27);
+			strncpy(printer.machineName, printerDto["machineName"] | "\0", 27);
+			strncpy(printer.machineIp, printerDto["machineIp"] | "\0", 27);
 
-				printers[printerIndex].x = printerDto["x"];
-				printers[printerIndex].maxX = printerDto["maxX"];
+			printer.machinePort = printerDto["machinePort"];
 
-				printers[printerIndex].y = printerDto["y"];
-				printers[printerIndex].maxY = printerDto["maxY"];
+			strncpy(printer.ledColor, printerDto["ledColor"] | "\0", 27);
 
-				printers[printerIndex].z = printerDto["z"];
-				printers[printerIndex].maxZ = printerDto["maxZ"];
+			printer.x = printerDto["x"];
+			printer.maxX = printerDto["maxX"];
 
-				printers[printerIndex].temperatureExtruderLeft = printerDto["temperatureExtruderLeft"];
-				printers[printerIndex].temperatureExtruderRight = printerDto["temperatureExtruderRight"];
-				printers[printerIndex].temperatureBed = printerDto["temperatureBed"];
-				printers[printerIndex].printingProgress = printerDto["printingProgress"];
+			printer.y = printerDto["y"];
+			printer.maxY = printerDto["maxY"];
 
-				lastPrinterFetch = millis();
-				shouldRedrawScreen = true;
-			}
+			printer.z = printerDto["z"];
+			printer.maxZ = printerDto["maxZ"];
+
+			printer.temperatureExtruderLeft = printerDto["temperatureExtruderLeft"];
+			printer.temperatureExtruderRight = printerDto["temperatureExtruderRight"];
+			printer.temperatureBed = printerDto["temperatureBed"];
+			printer.printingProgress = printerDto["printingProgress"];
+
+			shouldRedrawScreen = true;
 		}
 
 		/**
@@ -188,15 +329,15 @@ namespace CrowOs {
 		void PrinterFeature::showPrintersMenu() {
 
 			if(shouldRedrawScreen) {
-				if(LOG_INFO) Serial.println("Info : [PrinterFeature] showPrintersMenu");
+				LOG_INFO(PrinterFeature, "showPrintersMenu");
 
-				for(int i = 0; i < printerSize; i++) {
+				for(int i = 0; i < printerList.printerSize; i++) {
 					char displayName[screen->getMaxXCharacters()];
 
 					short textColor = foregroundColor;
 					short highlightColor = backgroundColor;
 
-					if(i == printerIndex) {
+					if(i == state.printerIndex) {
 						strncpy(displayName, "> \0", 3);
 						textColor = backgroundColor;
 						highlightColor = foregroundColor;
@@ -205,17 +346,16 @@ namespace CrowOs {
 						displayName[0] = '\0';
 					}
 
-					if(strcmp(printers[i].machineName, "\0") != 0) {
-						strncat(displayName, printers[i].machineName, screen->getMaxXCharacters());
+					if(strcmp(printerList.printers[i].machineName, "\0") != 0) {
+						strncat(displayName, printerList.printers[i].machineName, screen->getMaxXCharacters());
 					}
-					else if(strcmp(printers[i].machineIp, "\0") != 0) {
-						strncat(displayName, printers[i].machineIp, screen->getMaxXCharacters());
+					else if(strcmp(printerList.printers[i].machineIp, "\0") != 0) {
+						strncat(displayName, printerList.printers[i].machineIp, screen->getMaxXCharacters());
 					}
 
-					screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 5 + (10 * i));
-					screen->printText(displayName, 5, screen->getMinY() + 5 + (10 * i), textColor, highlightColor);
+					screen->printCells(displayName, 1, 2 + i, textColor, highlightColor, screen->getMaxXCharacters());
 
-					if(LOG_DEBUG) Serial.printf("Debug : [PrinterFeature] showPrintersMenu displayName = %s\n", displayName);
+					LOG_DEBUG(PrinterFeature, "showPrintersMenu displayName = %s", displayName);
 				}
 				shouldRedrawScreen = false;
 			}
@@ -226,66 +366,57 @@ namespace CrowOs {
 		 */
 		void PrinterFeature::showPrinterDetails() {
 			if(shouldRedrawScreen) {
-				if(LOG_INFO) Serial.println("Info : [PrinterFeature] showPrinterDetails");
+				LOG_INFO(PrinterFeature, "showPrinterDetails");
 
 				char displayName[10];
-				if(strcmp(printers[printerIndex].machineName, "\0") != 0) {
-					strncpy(displayName, printers[printerIndex].machineName, 9);
+				if(strcmp(printerList.printers[state.printerIndex].machineName, "\0") != 0) {
+					strncpy(displayName, printerList.printers[state.printerIndex].machineName, 9);
 				}
-				else if(strcmp(printers[printerIndex].machineIp, "\0") != 0) {
-					strncpy(displayName, printers[printerIndex].machineIp, 9);
+				else if(strcmp(printerList.printers[state.printerIndex].machineIp, "\0") != 0) {
+					strncpy(displayName, printerList.printers[state.printerIndex].machineIp, 9);
 				}
 				displayName[9] = '\0';
 
-				screen->clearText(9, 49, 3);
-				screen->printText(displayName, 49, 3, foregroundColor);
+				screen->printCells(displayName, 8, 0, foregroundColor, -1, 9);
 
 				char buff[screen->getMaxXCharacters()];
 
-				sprintf(buff, "IP : %s", printers[printerIndex].machineIp);
-				screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 2);
-				screen->printText(buff, 5, screen->getMinY() + 2, foregroundColor);
+				sprintf(buff, "IP : %s", printerList.printers[state.printerIndex].machineIp);
+				screen->printCells(buff, 1, 2, foregroundColor, -1, screen->getMaxXCharacters());
 
-				sprintf(buff, "PORT : %d", printers[printerIndex].machinePort);
-				screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 12);
-				screen->printText(buff, 5, screen->getMinY() + 12, foregroundColor);
+				sprintf(buff, "PORT : %d", printerList.printers[state.printerIndex].machinePort);
+				screen->printCells(buff, 1, 3, foregroundColor, -1, screen->getMaxXCharacters());
 
-				if(printers[printerIndex].printingProgress == -1 || printers[printerIndex].printingProgress == 100) {
-					sprintf(buff, "LED : %s", printers[printerIndex].ledColor);
-					screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 22);
-					screen->printText(buff, 5, screen->getMinY() + 22, foregroundColor);
+				if(printerList.printers[state.printerIndex].printingProgress == -1 || printerList.printers[state.printerIndex].printingProgress == 100) {
+					sprintf(buff, "LED : %s", printerList.printers[state.printerIndex].ledColor);
 				}
 				else {
-
-					sprintf(buff, "Progress : %.2f%%", printers[printerIndex].printingProgress);
-					screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 22);
-					screen->printText(buff, 5, screen->getMinY() + 22, foregroundColor);
+					sprintf(buff, "Progress : %.2f%%", printerList.printers[state.printerIndex].printingProgress);
 				}
+				screen->printCells(buff, 1, 4, foregroundColor, -1, screen->getMaxXCharacters());
 
-				M5.Lcd.drawLine(5, screen->getMinY() + 31, screen->getMaxX() - 5, screen->getMinY() + 31, foregroundColor);
-
-				sprintf(buff, "X : %.0f/%.0f", printers[printerIndex].x, printers[printerIndex].maxX);
-				screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 35);
-				screen->printText(buff, 5, screen->getMinY() + 35, foregroundColor);
+				// Left column stops before the separator column
+				sprintf(buff, "X : %.0f/%.0f", printerList.printers[state.printerIndex].x, printerList.printers[state.printerIndex].maxX);
+				screen->printCells(buff, 1, 6, foregroundColor, -1, 12);
 
-				sprintf(buff, "Y : %.0f/%.0f", printers[printerIndex].y, printers[printerIndex].maxY);
-				screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 45);
-				screen->printText(buff, 5, screen->getMinY() + 45, foregroundColor);
+				sprintf(buff, "Y : %.0f/%.0f", printerList.printers[state.printerIndex].y, printerList.printers[state.printerIndex].maxY);
+				screen->printCells(buff, 1, 7, foregroundColor, -1, 12);
 
-				sprintf(buff, "Z : %.0f/%.0f", printers[printerIndex].z, printers[printerIndex].maxZ);
-				screen->clearText(screen->getMaxXCharacters(), 5, screen->getMinY() + 55);
-				screen->printText(buff, 5, screen->getMinY() + 55, foregroundColor);
+				sprintf(buff, "Z : %.0f/%.0f", printerList.printers[state.printerIndex].z, printerList.printers[state.printerIndex].maxZ);
+				screen->printCells(buff, 1, 8, foregroundColor, -1, 12);
 
-				M5.Lcd.drawLine(80, screen->getMinY() + 31, 80, screen->getMaxY(), foregroundColor);
+				sprintf(buff, "TL : %d °", printerList.printers[state.printerIndex].temperatureExtruderLeft);
+				screen->printCells(buff, 15, 6, foregroundColor, -1, 11);
 
-				sprintf(buff, "TL : %d °", printers[printerIndex].temperatureExtruderLeft);
-				screen->printText(buff, 90, screen->getMinY() + 35, foregroundColor);
+				sprintf(buff, "TR : %d °", printerList.printers[state.printerIndex].temperatureExtruderRight);
+				screen->printCells(buff, 15, 7, foregroundColor, -1, 11);
 
-				sprintf(buff, "TR : %d °", printers[printerIndex].temperatureExtruderRight);
-				screen->printText(buff, 90, screen->getMinY() + 45, foregroundColor);
+				sprintf(buff, "TB : %d °", printerList.printers[state.printerIndex].temperatureBed);
+				screen->printCells(buff, 15, 8, foregroundColor, -1, 11);
 
-				sprintf(buff, "TB : %d °", printers[printerIndex].temperatureBed);
-				screen->printText(buff, 90, screen->getMinY() + 55, foregroundColor);
+				// Separators are drawn after the cells that may cross them
+				screen->drawLine(5, 44, screen->getMaxX() - 5, 44, foregroundColor);
+				screen->drawLine(80, 44, 80, screen->getMaxY(), foregroundColor);
 
 				shouldRedrawScreen = false;
 			}
@@ -295,28 +426,40 @@ namespace CrowOs {
 		 * Toggles printer led color
 		 */
 		void PrinterFeature::toggleLedColor() {
-			if(LOG_INFO) Serial.println("Info : [PrinterFeature] toggleLedColor");
+			LOG_INFO(PrinterFeature, "toggleLedColor");
 
 			unsigned int size = sizeof(COLORS) / sizeof(COLORS[0]);
 			int i = 0;
 			for(i = 0; i < size; i++) {
-				if(strcmp(COLORS[i], printers[printerIndex].ledColor) == 0) {
+				if(strcmp(COLORS[i], printerList.printers[state.printerIndex].ledColor) == 0) {
 					break;
 				}
 			}
 
-			if(LOG_DEBUG) Serial.printf("Debug : [PrinterFeature] toggleLedColor COLOR = %s, i = %d\n", printers[printerIndex].ledColor, i);
+			LOG_DEBUG(PrinterFeature, "toggleLedColor COLOR = %s, i = %d", printerList.printers[state.printerIndex].ledColor, i);
 			if(++i >= size) i = 0;
 
-			strcpy(printers[printerIndex].ledColor, COLORS[i]);
-			if(LOG_DEBUG) Serial.printf("Debug : [PrinterFeature] toggleLedColor COLOR = %s\n", COLORS[i]);
+			strcpy(printerList.printers[state.printerIndex].ledColor, COLORS[i]);
+			LOG_DEBUG(PrinterFeature, "toggleLedColor COLOR = %s", COLORS[i]);
 
-			DynamicJsonDocument printerDto(MAX_JSON_DOCUMENT_SIZE);
-			DynamicJsonDocument emptyJson(32);
+			StaticJsonDocument<16> emptyJson;
 			char uri[50];
-			sprintf(uri, "printer/%ld/color?color=%s", printers[printerIndex].id, printers[printerIndex].ledColor);
+			sprintf(uri, "printer/%ld/color?color=%s", printerList.printers[state.printerIndex].id, printerList.printers[state.printerIndex].ledColor);
+
+			// only last clicked color matters, a queued previous one is dropped
+			Core::NetworkTask::cancel(ledColorRequest);
+			ledColorRequest = webClient.submitPATCH(uri, emptyJson, onLedColorResponse, this);
+		}
+
+		/**
+		 * Shows led color change error
+		 *
+		 * @param status http status
+		 */
+		void PrinterFeature::onLedColor(const int status) {
+
+			LOG_INFO(PrinterFeature, "onLedColor status = %d", status);
 
-			int status = webClient.sendPATCH(uri, emptyJson, printerDto);
 			if(status != 202) {
 				char err[screen->getMaxXCharacters()];
 
@@ -331,13 +474,46 @@ namespace CrowOs {
 			}
 		}
 
+		/**
+		 * Called on main loop when printer list request completes
+		 *
+		 * @param status       http status
+		 * @param responseBody fetched printer list
+		 * @param context      PrinterFeature instance
+		 */
+		void PrinterFeature::onPrinterListResponse(const int status, JsonDocument& responseBody, void* context) {
+			static_cast<PrinterFeature*>(context)->onPrinterList(status, responseBody);
+		}
+
+		/**
+		 * Called on main loop when printer request completes
+		 *
+		 * @param status       http status
+		 * @param responseBody fetched printer
+		 * @param context      PrinterFeature instance
+		 */
+		void PrinterFeature::onPrinterResponse(const int status, JsonDocument& responseBody, void* context) {
+			static_cast<PrinterFeature*>(context)->onPrinter(status, responseBody);
+		}
+
+		/**
+		 * Called on main loop when led color request completes
+		 *
+		 * @param status       http status
+		 * @param responseBody unused
+		 * @param context      PrinterFeature instance
+		 */
+		void PrinterFeature::onLedColorResponse(const int status, JsonDocument& /* responseBody */, void* context) {
+			static_cast<PrinterFeature*>(context)->onLedColor(status);
+		}
+
 		/**
 		 * Called when home button is clicked
 		 */
 		void PrinterFeature::onHomeClick() {
 
 			if(viewIndex == 0) {
-				if(++printerIndex >= printerSize) printerIndex = 0;
+				if(++state.printerIndex >= printerList.printerSize) state.printerIndex = 0;
 			}
 			else {
 				toggleLedColor();
@@ -354,5 +530,25 @@ namespace CrowOs {
 			shouldRedrawScreen = true;
 		}
 
+		/**
+		 * Indicates if feature has something to draw at next frame
+		 * Printers are fetched in background when hold off timers expire, screen is redrawn only after a changed response, a prefetched list or a click
+		 *
+		 * @return true if loop should be called again as soon as possible
+		 */
+		const bool PrinterFeature::needsFrame() const {
+			return shouldRedrawScreen || drawnListVersion != printerList.version;
+		}
+
+		/**
+		 * Gets frame rate wanted while feature needs frames
+		 * Screen is redrawn only after a fetch or a click
+		 *
+		 * @return target fps
+		 */
+		const double PrinterFeature::getTargetFps() const {
+			return 10;
+		}
+
 	} // namespace Feature
 } // namespace CrowOs
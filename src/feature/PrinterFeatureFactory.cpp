@@ -11,7 +11,11 @@ namespace CrowOs {
 		 * Initialise printer feature factory
 		 */
 		PrinterFeatureFactory::PrinterFeatureFactory()
-			: FeatureFactory("PrinterFeatureFactory") {
+			: StatefulFeatureFactory(NAME, {0})
+			, webClient(BACKEND_HOST, BACKEND_PORT, BACKEND_USER_USERNAME, BACKEND_USER_PASSWORD, BACKEND_BASE_PATH)
+			, printerList()
+			, prefetchTimer(Core::Scheduler::NO_TIMER)
+			, prefetchRequest(Core::NetworkTask::NO_REQUEST) {
 		}
 
 		/**
@@ -24,8 +28,58 @@ namespace CrowOs {
 		 * @return Feature* your feature
 		 */
 		Core::Feature* PrinterFeatureFactory::createFeature() {
-			if(LOG_INFO) Serial.println("Info : [PrinterFeatureFactory] createFeature PrinterFeature");
-			return new PrinterFeature();
+			LOG_INFO(PrinterFeatureFactory, "createFeature PrinterFeature");
+			return new PrinterFeature(state, webClient, printerList);
+		}
+
+		/**
+		 * Prefetches printer list so that printer feature shows it on its first frame
+		 */
+		void PrinterFeatureFactory::prefetch() {
+
+			if(!Core::Scheduler::isScheduled(prefetchTimer) && !Core::NetworkTask::isPending(prefetchRequest)) {
+
+				LOG_INFO(PrinterFeatureFactory, "prefetch version = %u", (unsigned int)printerList.version);
+
+				prefetchTimer = Core::Scheduler::schedule(PREFETCH_DELAY, NULL, NULL);
+				prefetchRequest = PrinterFeature::submitPrinterList(webClient, onPrefetchResponse, this);
+			}
+		}
+
+		/**
+		 * Called on main loop when prefetch request completes
+		 *
+		 * @param status       http status
+		 * @param responseBody fetched printer list
+		 * @param context      PrinterFeatureFactory instance
+		 */
+		void PrinterFeatureFactory::onPrefetchResponse(const int status, JsonDocument& responseBody, void* context) {
+
+			LOG_INFO(PrinterFeatureFactory, "onPrefetchResponse status = %d", status);
+
+			// errors are shown by printer feature once it fetches list itself
+			if(status != 200) return;
+
+			PrinterFeatureFactory* factory = static_cast<PrinterFeatureFactory*>(context);
+			PrinterFeature::readPrinterList(responseBody, factory->printerList, factory->webClient);
+		}
+
+		/**
+		 * Restores state from saved data, missing fields keep their actual value
+		 *
+		 * @param savedData parsed saved data
+		 */
+		void PrinterFeatureFactory::readState(const JsonDocument& savedData) {
+			state.printerIndex = savedData["printerIndex"] | state.printerIndex;
+		}
+
+		/**
+		 * Writes state into saved data
+		 *
+		 * @param savedData to fill
+		 */
+		void PrinterFeatureFactory::writeState(JsonDocument& savedData) const {
+			savedData["printerIndex"] = state.printerIndex;
 		}
 
 	} // namespace Feature
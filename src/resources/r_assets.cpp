@@ -0,0 +1,677 @@
+/**
+ * Compressed assets
+ * Generated by tools/asset_converter.py, do not edit
+ */
+#include "resources/r_assets.hpp"
+
+static const uint8_t res_logo_data[8602] PROGMEM = {
+	0x88, 0x00, 0x00, 0x03, 0x35, 0xB5, 0x52, 0xA4, 0x6A, 0x93, 0x22, 0xC6, 0xC1, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x38, 0xC6, 0x34, 0xA5, 0x50,
+	0x8C, 0x4F, 0x8C, 0xC2, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0xB7, 0xB5, 0x72, 0x8C, 0xAF, 0x73, 0xF1, 0x7B, 0x55, 0x86, 0xC1, 0x00, 0x00, 0x87,
+	0x00, 0x00, 0x04, 0x30, 0x84, 0xEC, 0x5A, 0x6B, 0x4A, 0xF0, 0x7B, 0x96, 0x9D, 0xC1, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x4C, 0x63, 0x2A, 0x42,
+	0x0A, 0x3A, 0x6E, 0x6B, 0x74, 0xAD, 0xC1, 0x00, 0x00, 0x87, 0x00, 0x00, 0x05, 0xD2, 0x9C, 0x8E, 0x6B, 0x68, 0x21, 0x2A, 0x42, 0x54, 0xA5, 0xB5,
+	0xB5, 0xC0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x05, 0x95, 0xB5, 0xD3, 0x9C, 0x28, 0x19, 0xC9, 0x31, 0xD3, 0x94, 0xF3, 0x9C, 0xC0, 0x00, 0x00, 0x86,
+	0x00, 0x00, 0x06, 0xC0, 0xD6, 0xF0, 0x7B, 0x6E, 0x6B, 0x28, 0x19, 0x88, 0x29, 0xAF, 0x73, 0xCF, 0x73, 0xC0, 0x00, 0x00, 0x86, 0x00, 0x00, 0x06,
+	0x6E, 0xEF, 0x2D, 0x63, 0xAB, 0x52, 0x48, 0x19, 0xA8, 0x29, 0x6E, 0x6B, 0x8E, 0x6B, 0xC0, 0x00, 0x00, 0x86, 0x00, 0x00, 0x06, 0x57, 0xDE, 0x71,
+	0x8C, 0x10, 0x7C, 0x68, 0x21, 0x27, 0x19, 0xE9, 0x39, 0xA8, 0x29, 0xC0, 0x00, 0x00, 0x86, 0x00, 0x00, 0x06, 0xF7, 0xED, 0x2D, 0x63, 0xEC, 0x5A,
+	0x48, 0x19, 0x27, 0x19, 0xE9, 0x39, 0x55, 0xAD, 0xC0, 0x00, 0x00, 0x83, 0x00, 0x00, 0x09, 0x7A, 0xDF, 0x1A, 0xDF, 0x11, 0xC6, 0xD9, 0xEE, 0x8E,
+	0x6B, 0xC9, 0x31, 0x07, 0x11, 0xA8, 0x29, 0x6E, 0x6B, 0x9A, 0xD6, 0xC0, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0A, 0x55, 0xAD, 0x75, 0xAD, 0xF7, 0xBD,
+	0xB5, 0xA5, 0x58, 0xCE, 0xD3, 0x9C, 0x2A, 0x42, 0x07, 0x11, 0x88, 0x29, 0x6E, 0x6B, 0x59, 0xCE, 0x81, 0x00, 0x00, 0x02, 0xAD, 0x8C, 0x14, 0xD7,
+	0x34, 0xC7, 0xBB, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0F, 0xCF, 0x7B, 0xF0, 0x7B, 0x72, 0x8C, 0x13, 0x95, 0xD1, 0x9C, 0x6E, 0x6B, 0x88, 0x29, 0xE6,
+	0x08, 0xA8, 0x29, 0x6E, 0x6B, 0x59, 0xCE, 0x00, 0x00, 0xF9, 0xDE, 0xD3, 0x94, 0x51, 0x84, 0x51, 0x7C, 0xBB, 0x00, 0x00, 0x81, 0x00, 0x00, 0x13,
+	0x76, 0xC5, 0x71, 0x8C, 0x0C, 0x5B, 0x6E, 0x6B, 0x4F, 0x84, 0xB1, 0x94, 0xCF, 0x73, 0x47, 0x19, 0xC6, 0x08, 0x88, 0x29, 0x6E, 0x6B, 0x59, 0xCE,
+	0x00, 0x00, 0xF6, 0xBD, 0x51, 0x84, 0x4E, 0x63, 0x2D, 0x63, 0x95, 0xAD, 0x33, 0x96, 0x95, 0xC3, 0xB8, 0x00, 0x00, 0x81, 0x00, 0x00, 0x14, 0xB6,
+	0xB5, 0xD3, 0x9C, 0x0A, 0x3A, 0x92, 0x8C, 0xB2, 0x94, 0xEF, 0x7B, 0x6E, 0x6B, 0x27, 0x19, 0xA6, 0x00, 0x88, 0x29, 0x6E, 0x6B, 0x79, 0xCE, 0x00,
+	0x00, 0xB2, 0x94, 0xAF, 0x73, 0x07, 0x11, 0xE9, 0x31, 0xD3, 0x94, 0x34, 0xA6, 0xF6, 0xBC, 0xD7, 0xBD, 0xB7, 0x00, 0x00, 0x14, 0x00, 0x00, 0x79,
+	0xE4, 0x6F, 0x8C, 0x8F, 0x73, 0xA9, 0x31, 0xAF, 0x73, 0xF0, 0x7B, 0x2C, 0x63, 0xCB, 0x52, 0x07, 0x11, 0xA5, 0x00, 0x88, 0x29, 0x6E, 0x6B, 0xBA,
+	0xD6, 0x00, 0x00, 0xAF, 0x73, 0x2D, 0x63, 0xE7, 0x08, 0xA9, 0x29, 0xCF, 0x73, 0xF6, 0xAC, 0x81, 0x51, 0x8C, 0x01, 0x39, 0xC6, 0x20, 0x43, 0xB5,
+	0x00, 0x00, 0x12, 0x00, 0x00, 0xB4, 0xD5, 0x70, 0x8C, 0xAF, 0x73, 0x88, 0x29, 0xEC, 0x5A, 0x2D, 0x63, 0x30, 0x84, 0xAF, 0x73, 0x27, 0x19, 0xA5,
+	0x00, 0x46, 0x21, 0xAB, 0x52, 0x59, 0xCE, 0xFF, 0xFF, 0xCF, 0x73, 0x0A, 0x3A, 0xE7, 0x08, 0x0A, 0x3A, 0x81, 0x10, 0x7C, 0x02, 0x4D, 0x6B, 0x4E,
+	0x6B, 0x34, 0xA5, 0xB6, 0x00, 0x00, 0x18, 0x00, 0x00, 0xEC, 0x9D, 0x2D, 0x6B, 0x8A, 0x4A, 0x47, 0x21, 0x6A, 0x4A, 0x8A, 0x52, 0x0B, 0x63, 0xAB,
+	0x52, 0xE6, 0x10, 0xA5, 0x08, 0xC5, 0x08, 0x05, 0x19, 0x00, 0x00, 0x38, 0xC6, 0x71, 0x8C, 0x68, 0x21, 0xC7, 0x08, 0x88, 0x29, 0xEC, 0x5A, 0x4E,
+	0x6B, 0x6B, 0x4A, 0x0A, 0x3A, 0xCF, 0x73, 0xFE, 0xFF, 0xB5, 0x00, 0x00, 0x18, 0x00, 0x00, 0x14, 0xAE, 0xF3, 0x9C, 0xAC, 0x52, 0x27, 0x19, 0xC8,
+	0x31, 0xAF, 0x73, 0x51, 0x84, 0x87, 0x29, 0xC5, 0x08, 0xA5, 0x08, 0xC5, 0x08, 0x46, 0x21, 0x47, 0x21, 0x10, 0x84, 0x0D, 0x5B, 0xE6, 0x10, 0xC6,
+	0x08, 0x47, 0x19, 0xCB, 0x52, 0x4E, 0x6B, 0x48, 0x21, 0xC9, 0x31, 0x0D, 0x5B, 0x77, 0xCE, 0xB5, 0x00, 0x00, 0x08, 0x00, 0x00, 0x95, 0xAD, 0xF3,
+	0x9C, 0x68, 0x21, 0xE6, 0x10, 0x87, 0x29, 0xF3, 0x9C, 0x55, 0xAD, 0x66, 0x29, 0x81, 0xA5, 0x08, 0x04, 0xC5, 0x08, 0x46, 0x21, 0xAC, 0x52, 0xF0,
+	0x83, 0x2D, 0x63, 0x81, 0xC6, 0x08, 0x06, 0x47, 0x21, 0xCB, 0x52, 0xEC, 0x5A, 0xC7, 0x08, 0x28, 0x19, 0x2A, 0x42, 0x95, 0xAD, 0xB5, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0xB0, 0x73, 0x8F, 0x6B, 0x88, 0x21, 0xC6, 0x08, 0x26, 0x19, 0x30, 0x84, 0x51, 0x8C, 0x26, 0x19, 0x81, 0xA5, 0x08, 0x0F, 0xC5,
+	0x08, 0x66, 0x29, 0x4B, 0x63, 0x6D, 0x6B, 0xAB, 0x52, 0xC6, 0x08, 0xC6, 0x00, 0x67, 0x21, 0x2A, 0x42, 0xE6, 0x10, 0xC7, 0x08, 0xA6, 0x00, 0x8B,
+	0x4A, 0x58, 0xC6, 0x71, 0x94, 0x30, 0x84, 0xB3, 0x00, 0x00, 0x10, 0x7C, 0xEF, 0x71, 0x8C, 0xCC, 0x52, 0x88, 0x29, 0xE6, 0x10, 0x09, 0x3A, 0x34,
+	0xA5, 0xEC, 0x5A, 0xC5, 0x10, 0xA4, 0x00, 0x84, 0x00, 0xE5, 0x10, 0xC7, 0x31, 0x67, 0x63, 0x2C, 0x63, 0x6A, 0x4A, 0xC6, 0x08, 0x82, 0xA5, 0x08,
+	0x81, 0xC6, 0x08, 0x02, 0x86, 0x00, 0xCC, 0x52, 0xF7, 0xBD, 0x81, 0x10, 0x84, 0xB3, 0x00, 0x00, 0x08, 0xB9, 0xD6, 0x34, 0xA5, 0xAB, 0x52, 0x88,
+	0x29, 0x26, 0x19, 0xEC, 0x5A, 0xD6, 0xBD, 0xEC, 0x5A, 0xA4, 0x08, 0x81, 0x84, 0x00, 0x04, 0x26, 0x19, 0x8A, 0x4A, 0x4F, 0x8C, 0x4D, 0x6B, 0xC8,
+	0x31, 0x82, 0xA5, 0x08, 0x00, 0xA5, 0x00, 0x82, 0xC6, 0x08, 0x03, 0x2A, 0x42, 0x31, 0x84, 0x6E, 0x6B, 0x10, 0x84, 0xB3, 0x00, 0x00, 0x0E, 0x55,
+	0xAD, 0x71, 0x8C, 0x6B, 0x4A, 0x68, 0x21, 0xE6, 0x10, 0x09, 0x42, 0x92, 0x94, 0xF0, 0x7B, 0xC5, 0x10, 0x84, 0x08, 0x84, 0x00, 0x87, 0x29, 0xCF,
+	0x73, 0xD3, 0x9C, 0x4D, 0x6B, 0x82, 0xA5, 0x08, 0x08, 0xA5, 0x00, 0xA5, 0x08, 0xC6, 0x08, 0xA6, 0x00, 0x67, 0x21, 0x8B, 0x4A, 0x6B, 0x4A, 0x2A,
+	0x42, 0xCF, 0x73, 0xB3, 0x00, 0x00, 0x0E, 0xAF, 0x73, 0x0D, 0x63, 0xC8, 0x31, 0x47, 0x19, 0xC5, 0x08, 0x46, 0x21, 0xCF, 0x7B, 0x10, 0x84, 0xE5,
+	0x18, 0x84, 0x08, 0x64, 0x00, 0xC8, 0x39, 0x10, 0x84, 0x6E, 0x6B, 0x6A, 0x4A, 0x81, 0xA5, 0x08, 0x81, 0x84, 0x00, 0x07, 0xA5, 0x08, 0xA6, 0x08,
+	0xA5, 0x00, 0xA8, 0x29, 0xAB, 0x52, 0xC9, 0x31, 0xE9, 0x31, 0x4D, 0x63, 0xB3, 0x00, 0x00, 0x0E, 0xCB, 0x52, 0x4A, 0x42, 0x67, 0x29, 0x06, 0x19,
+	0xA4, 0x08, 0x46, 0x21, 0x92, 0x94, 0x6E, 0x6B, 0xC4, 0x10, 0x84, 0x08, 0x64, 0x00, 0x66, 0x29, 0xCB, 0x5A, 0x66, 0x29, 0x64, 0x00, 0x83, 0x84,
+	0x00, 0x82, 0xA5, 0x08, 0x07, 0xE5, 0x10, 0x47, 0x21, 0xC7, 0x00, 0x4A, 0x42, 0xAF, 0x73, 0xFF, 0xFF, 0x99, 0xCE, 0x38, 0xC6, 0xB0, 0x00, 0x00,
+	0x0D, 0x8A, 0x4A, 0x29, 0x3A, 0x26, 0x21, 0xE5, 0x10, 0x84, 0x00, 0x66, 0x29, 0x72, 0x8C, 0xCB, 0x52, 0xA4, 0x08, 0x84, 0x00, 0x64, 0x00, 0x63,
+	0x00, 0x23, 0x00, 0x64, 0x00, 0x84, 0x84, 0x00, 0x82, 0xA5, 0x08, 0x05, 0x85, 0x08, 0xA6, 0x08, 0xC6, 0x08, 0x88, 0x29, 0x6A, 0x42, 0x34, 0xAD,
+	0x81, 0x10, 0x84, 0x00, 0x3C, 0xE7, 0xAF, 0x00, 0x00, 0x09, 0x0C, 0x63, 0x6A, 0x4A, 0x46, 0x21, 0xC4, 0x08, 0x84, 0x00, 0x26, 0x21, 0x8E, 0x73,
+	0x08, 0x42, 0x84, 0x08, 0x64, 0x00, 0x82, 0x63, 0x00, 0x81, 0x84, 0x00, 0x07, 0x84, 0x08, 0x64, 0x00, 0x63, 0x00, 0x84, 0x00, 0xA4, 0x08, 0xA4,
+	0x00, 0x84, 0x00, 0x85, 0x08, 0x81, 0xC6, 0x08, 0x05, 0x27, 0x19, 0xE9, 0x39, 0x30, 0x84, 0xEC, 0x5A, 0xCC, 0x52, 0x34, 0xA5, 0xAF, 0x00, 0x00,
+	0x08, 0xCF, 0x7B, 0x2D, 0x63, 0xA7, 0x31, 0xA4, 0x08, 0x84, 0x00, 0x46, 0x29, 0x8E, 0x73, 0x87, 0x31, 0x63, 0x08, 0x88, 0x63, 0x00, 0x83, 0x84,
+	0x00, 0x00, 0xA5, 0x00, 0x81, 0xC6, 0x08, 0x05, 0x07, 0x19, 0x6A, 0x4A, 0x4D, 0x6B, 0xC9, 0x31, 0x68, 0x21, 0xCB, 0x52, 0xAF, 0x00, 0x00, 0x08,
+	0x34, 0xAD, 0x51, 0x8C, 0x29, 0x42, 0xA4, 0x10, 0x63, 0x00, 0x05, 0x19, 0xCB, 0x5A, 0x49, 0x4A, 0x83, 0x08, 0x88, 0x63, 0x00, 0x81, 0x84, 0x00,
+	0x81, 0x84, 0x08, 0x00, 0xA5, 0x08, 0x81, 0xA6, 0x08, 0x05, 0xE6, 0x10, 0xE9, 0x39, 0x2A, 0x42, 0xC6, 0x00, 0xA8, 0x31, 0x8E, 0x73, 0xAF, 0x00,
+	0x00, 0x08, 0x58, 0xCE, 0x13, 0xA5, 0x8A, 0x52, 0xC4, 0x10, 0x63, 0x00, 0x83, 0x08, 0x66, 0x29, 0x8A, 0x52, 0xA4, 0x08, 0x81, 0x63, 0x00, 0x00,
+	0x42, 0x00, 0x85, 0x63, 0x00, 0x03, 0x84, 0x00, 0x84, 0x08, 0x64, 0x00, 0x84, 0x00, 0x84, 0xA5, 0x08, 0x05, 0xC6, 0x00, 0xC6, 0x08, 0x6A, 0x4A,
+	0x14, 0xA5, 0x00, 0x00, 0x8E, 0x3A, 0xAD, 0x00, 0x00, 0x03, 0x1A, 0xE7, 0xB1, 0x94, 0x08, 0x42, 0xA3, 0x08, 0x81, 0x63, 0x00, 0x04, 0xA4, 0x10,
+	0x46, 0x29, 0x63, 0x08, 0x63, 0x00, 0x43, 0x00, 0x85, 0x42, 0x00, 0x83, 0x63, 0x00, 0x00, 0x84, 0x00, 0x82, 0xA5, 0x08, 0x01, 0xA5, 0x00, 0xA5,
+	0x08, 0x81, 0xC6, 0x08, 0x01, 0x6A, 0x4A, 0x55, 0xA5, 0xAF, 0x00, 0x00, 0x07, 0x00, 0x00, 0xAA, 0x52, 0x29, 0x42, 0xA4, 0x10, 0x64, 0x00, 0x43,
+	0x00, 0x42, 0x00, 0x22, 0x00, 0x88, 0x42, 0x00, 0x83, 0x63, 0x00, 0x02, 0x84, 0x00, 0xA4, 0x08, 0x85, 0x08, 0x81, 0x84, 0x00, 0x06, 0xA5, 0x08,
+	0xC6, 0x08, 0x26, 0x19, 0x8B, 0x52, 0x17, 0xC6, 0xF3, 0x9C, 0x51, 0x8C, 0xAD, 0x00, 0x00, 0x05, 0x00, 0x00, 0xCF, 0x7B, 0x8E, 0x73, 0x06, 0x19,
+	0xA5, 0x08, 0x43, 0x00, 0x8B, 0x42, 0x00, 0x82, 0x63, 0x00, 0x82, 0x84, 0x08, 0x08, 0x84, 0x00, 0x84, 0x08, 0xA5, 0x08, 0x85, 0x00, 0x09, 0x3A,
+	0xAF, 0x73, 0xF3, 0xA4, 0x8F, 0x73, 0x4E, 0x63, 0xAD, 0x00, 0x00, 0x08, 0x00, 0x00, 0xCF, 0x7B, 0x6E, 0x6B, 0xE5, 0x10, 0xA5, 0x08, 0x64, 0x00,
+	0x42, 0x00, 0x63, 0x00, 0x64, 0x00, 0x83, 0x42, 0x00, 0x81, 0x22, 0x00, 0x01, 0x42, 0x00, 0x22, 0x00, 0x81, 0x42, 0x00, 0x00, 0x63, 0x00, 0x81,
+	0x84, 0x00, 0x00, 0x84, 0x08, 0x81, 0x84, 0x00, 0x82, 0xA5, 0x08, 0x05, 0x8B, 0x52, 0xB2, 0x94, 0x6E, 0x6B, 0x0A, 0x3A, 0x8B, 0x4A, 0xFF, 0xFF,
+	0xAC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x2F, 0x84, 0x4D, 0x6B, 0x81, 0xA4, 0x10, 0x01, 0x84, 0x08, 0x42, 0x00, 0x81, 0xA5, 0x08, 0x03, 0x42, 0x00,
+	0x43, 0x00, 0x85, 0x00, 0x63, 0x00, 0x83, 0x21, 0x00, 0x81, 0x42, 0x00, 0x00, 0x63, 0x00, 0x81, 0x64, 0x00, 0x81, 0x63, 0x00, 0x09, 0x84, 0x08,
+	0xA5, 0x08, 0x84, 0x00, 0x46, 0x21, 0x6A, 0x4A, 0xEC, 0x5A, 0x09, 0x3A, 0x67, 0x21, 0x2D, 0x63, 0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x94, 0xB5, 0x71, 0x8C, 0x29, 0x42, 0xE4, 0x18, 0xA3, 0x10, 0x83, 0x08, 0x81, 0xA5, 0x08, 0x03, 0x63, 0x00, 0x64, 0x00, 0xC6, 0x08, 0x84, 0x00,
+	0x83, 0x21, 0x00, 0x01, 0x42, 0x00, 0x43, 0x00, 0x84, 0x63, 0x00, 0x81, 0x84, 0x00, 0x07, 0x64, 0x00, 0xA7, 0x31, 0x49, 0x42, 0xA6, 0x08, 0xA6,
+	0x00, 0x47, 0x21, 0xAB, 0x52, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x1D, 0xE7, 0xA9, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xCF, 0xBD, 0x8E, 0x73, 0xCB,
+	0x5A, 0x05, 0x21, 0xA4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x84, 0x08, 0x63, 0x00, 0x84, 0x08, 0xA5, 0x08, 0x84, 0x08, 0x82, 0x21, 0x00, 0x81, 0x42,
+	0x00, 0x84, 0x63, 0x00, 0x82, 0x84, 0x00, 0x02, 0x64, 0x00, 0x26, 0x21, 0x87, 0x29, 0x81, 0xA5, 0x00, 0x07, 0xE8, 0x31, 0xCC, 0x5A, 0x00, 0x00,
+	0x91, 0x94, 0x10, 0x84, 0x8F, 0x73, 0x72, 0x8C, 0x1C, 0xE7, 0xA7, 0x00, 0x00, 0x09, 0x00, 0x00, 0xB1, 0xB5, 0xAF, 0x73, 0xCB, 0x5A, 0x05, 0x21,
+	0xA4, 0x10, 0xA3, 0x10, 0x83, 0x10, 0x62, 0x08, 0x63, 0x00, 0x81, 0x84, 0x08, 0x00, 0x64, 0x00, 0x81, 0x21, 0x00, 0x03, 0x84, 0x00, 0x85, 0x08,
+	0x42, 0x00, 0x63, 0x00, 0x81, 0x42, 0x00, 0x81, 0x63, 0x00, 0x81, 0x64, 0x00, 0x81, 0x63, 0x00, 0x0B, 0x84, 0x00, 0x85, 0x00, 0xA5, 0x08, 0x65,
+	0x00, 0x09, 0x42, 0xAF, 0x73, 0x50, 0x84, 0x0C, 0x5B, 0x6A, 0x4A, 0xAC, 0x52, 0xAF, 0x73, 0x7D, 0xEF, 0xA7, 0x00, 0x00, 0x09, 0x00, 0x00, 0x4D,
+	0xCE, 0x10, 0x84, 0x6E, 0x6B, 0x46, 0x29, 0xC4, 0x18, 0xA3, 0x10, 0x63, 0x08, 0x62, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x08, 0x43, 0x00, 0x21,
+	0x00, 0x63, 0x00, 0xA5, 0x08, 0x85, 0x08, 0x42, 0x00, 0x43, 0x00, 0x63, 0x00, 0x42, 0x00, 0x85, 0x63, 0x00, 0x0A, 0x84, 0x00, 0x84, 0x08, 0x84,
+	0x00, 0x26, 0x19, 0xAB, 0x52, 0x30, 0x84, 0xEC, 0x5A, 0xC8, 0x31, 0xA6, 0x08, 0x8B, 0x52, 0x51, 0x8C, 0xA8, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0,
+	0xBD, 0xF3, 0x9C, 0x92, 0x94, 0x87, 0x31, 0xE5, 0x18, 0xA3, 0x10, 0x62, 0x08, 0x83, 0x42, 0x00, 0x01, 0x22, 0x00, 0x42, 0x00, 0x81, 0x84, 0x00,
+	0x04, 0x63, 0x00, 0x64, 0x00, 0xA5, 0x00, 0x84, 0x00, 0x42, 0x00, 0x82, 0x63, 0x00, 0x01, 0x43, 0x00, 0x63, 0x00, 0x83, 0x84, 0x00, 0x0B, 0x66,
+	0x29, 0x6A, 0x4A, 0xAB, 0x52, 0xC8, 0x31, 0x25, 0x00, 0x4A, 0x42, 0xF0, 0x7B, 0xDA, 0xD6, 0xFF, 0xFF, 0xBA, 0xD6, 0x58, 0xCE, 0xFA, 0xE6, 0xA4,
+	0x00, 0x00, 0x81, 0x00, 0x00, 0x05, 0x95, 0xB5, 0xD3, 0x9C, 0xE8, 0x39, 0x66, 0x29, 0xA3, 0x10, 0x41, 0x00, 0x82, 0x21, 0x00, 0x81, 0x22, 0x00,
+	0x03, 0x63, 0x00, 0x84, 0x00, 0x83, 0x00, 0x64, 0x00, 0x81, 0xA5, 0x08, 0x00, 0x84, 0x00, 0x84, 0x42, 0x00, 0x00, 0x63, 0x00, 0x82, 0x84, 0x00,
+	0x0C, 0x64, 0x00, 0xE5, 0x10, 0x26, 0x21, 0xE5, 0x10, 0x85, 0x00, 0xE5, 0x18, 0xEC, 0x5A, 0x34, 0xA5, 0x51, 0x84, 0x6E, 0x6B, 0x0D, 0x63, 0x2D,
+	0x63, 0x4D, 0x6B, 0xA4, 0x00, 0x00, 0x81, 0x00, 0x00, 0x08, 0x30, 0xA5, 0xEF, 0x7B, 0x2D, 0x63, 0x09, 0x42, 0xC4, 0x18, 0x41, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x81, 0x22, 0x00, 0x81, 0x42, 0x00, 0x01, 0x43, 0x00, 0x64, 0x00, 0x83, 0x84, 0x00, 0x00, 0x63, 0x00, 0x82, 0x42, 0x00,
+	0x85, 0x63, 0x00, 0x81, 0x84, 0x00, 0x0B, 0x64, 0x00, 0xA7, 0x31, 0xEC, 0x5A, 0x0C, 0x5B, 0x4A, 0x42, 0x09, 0x3A, 0xA8, 0x29, 0x29, 0x42, 0x8B,
+	0x4A, 0x00, 0x00, 0x12, 0x5D, 0x35, 0x5D, 0xA1, 0x00, 0x00, 0x82, 0x00, 0x00, 0x04, 0xCF, 0x73, 0xAE, 0x73, 0x4A, 0x4A, 0x05, 0x21, 0x83, 0x08,
+	0x82, 0x01, 0x00, 0x83, 0x22, 0x00, 0x03, 0x42, 0x00, 0x43, 0x00, 0x63, 0x00, 0x64, 0x00, 0x81, 0xA5, 0x08, 0x03, 0x84, 0x00, 0x22, 0x00, 0x42,
+	0x00, 0x43, 0x00, 0x85, 0x63, 0x00, 0x81, 0x84, 0x00, 0x0A, 0x64, 0x00, 0x26, 0x21, 0xE8, 0x39, 0x67, 0x29, 0x65, 0x00, 0x85, 0x00, 0xA5, 0x08,
+	0x6A, 0x4A, 0xCF, 0x73, 0xFF, 0xFF, 0x9F, 0xF7, 0xA2, 0x00, 0x00, 0x82, 0x00, 0x00, 0x05, 0xCF, 0x73, 0x8E, 0x73, 0x49, 0x4A, 0x66, 0x29, 0xA3,
+	0x10, 0x42, 0x08, 0x81, 0x01, 0x00, 0x00, 0x02, 0x00, 0x83, 0x22, 0x00, 0x81, 0x42, 0x00, 0x05, 0x64, 0x00, 0xA5, 0x08, 0x84, 0x00, 0x63, 0x00,
+	0x42, 0x00, 0x43, 0x00, 0x84, 0x42, 0x00, 0x84, 0x63, 0x00, 0x84, 0x84, 0x00, 0x00, 0x66, 0x21, 0x82, 0x6A, 0x4A, 0x01, 0x8E, 0x73, 0xF7, 0xBD,
+	0xA1, 0x00, 0x00, 0x82, 0x00, 0x00, 0x06, 0xAF, 0x73, 0x4D, 0x6B, 0x08, 0x42, 0xC8, 0x39, 0xA3, 0x10, 0x82, 0x10, 0x21, 0x00, 0x82, 0x01, 0x00,
+	0x83, 0x22, 0x00, 0x00, 0x42, 0x00, 0x82, 0x63, 0x00, 0x02, 0x84, 0x00, 0xA5, 0x00, 0x64, 0x00, 0x84, 0x42, 0x00, 0x83, 0x63, 0x00, 0x00, 0x64,
+	0x00, 0x82, 0x84, 0x00, 0x07, 0x64, 0x00, 0x84, 0x00, 0x05, 0x19, 0x67, 0x29, 0x05, 0x19, 0x09, 0x42, 0x4D, 0x63, 0xFB, 0xDE, 0xA1, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x06, 0xD3, 0x9C, 0x10, 0x84, 0xE8, 0x39, 0x09, 0x42, 0xC4, 0x18, 0x83, 0x10, 0x42, 0x08, 0x84, 0x01, 0x00, 0x82, 0x22, 0x00,
+	0x81, 0x42, 0x00, 0x03, 0x63, 0x00, 0x84, 0x00, 0xA4, 0x00, 0x63, 0x00, 0x81, 0x22, 0x00, 0x82, 0x42, 0x00, 0x02, 0x63, 0x00, 0x43, 0x00, 0x62,
+	0x00, 0x81, 0x63, 0x00, 0x00, 0x83, 0x00, 0x82, 0x63, 0x00, 0x81, 0x84, 0x00, 0x05, 0x64, 0x00, 0xE5, 0x10, 0x29, 0x42, 0x51, 0x84, 0x93, 0x94,
+	0xB3, 0x94, 0xA0, 0x00, 0x00, 0x82, 0x00, 0x00, 0x08, 0xD7, 0xBD, 0xF0, 0x7B, 0xCB, 0x5A, 0x4A, 0x4A, 0xE4, 0x18, 0x83, 0x10, 0x62, 0x08, 0x01,
+	0x00, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x21, 0x00, 0x82, 0x22, 0x00, 0x00, 0x42, 0x00, 0x83, 0x63, 0x00, 0x86, 0x42, 0x00, 0x85, 0x63, 0x00,
+	0x81, 0x84, 0x00, 0x06, 0x64, 0x00, 0x86, 0x29, 0x6A, 0x4A, 0x4D, 0x6B, 0xCB, 0x5A, 0xE8, 0x39, 0xEC, 0x5A, 0xA0, 0x00, 0x00, 0x83, 0x00, 0x00,
+	0x07, 0x8E, 0x73, 0x6E, 0x6B, 0x29, 0x42, 0x66, 0x29, 0xA3, 0x10, 0x83, 0x10, 0x42, 0x08, 0x00, 0x00, 0x83, 0x01, 0x00, 0x83, 0x22, 0x00, 0x81,
+	0x42, 0x00, 0x00, 0x43, 0x00, 0x81, 0x84, 0x00, 0x85, 0x42, 0x00, 0x81, 0x63, 0x00, 0x01, 0x62, 0x00, 0x42, 0x00, 0x83, 0x63, 0x00, 0x0A, 0x43,
+	0x00, 0xA7, 0x31, 0x29, 0x42, 0xE8, 0x39, 0x66, 0x29, 0xC4, 0x10, 0x49, 0x4A, 0xEF, 0x7B, 0xFF, 0xFF, 0x16, 0xDF, 0xC5, 0x9C, 0x9C, 0x00, 0x00,
+	0x83, 0x00, 0x00, 0x01, 0xD3, 0x9C, 0x51, 0x8C, 0x81, 0xE8, 0x39, 0x03, 0xA3, 0x10, 0x83, 0x10, 0x62, 0x08, 0x41, 0x08, 0x86, 0x01, 0x00, 0x00,
+	0x21, 0x00, 0x81, 0x22, 0x00, 0x02, 0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 0x81, 0x42, 0x00, 0x81, 0x22, 0x00, 0x85, 0x42, 0x00, 0x82, 0x63, 0x00,
+	0x0A, 0x62, 0x00, 0x42, 0x00, 0xE4, 0x18, 0x05, 0x19, 0x63, 0x00, 0xA4, 0x08, 0x6D, 0x6B, 0x71, 0x8C, 0x0C, 0x63, 0xAE, 0x73, 0xB2, 0x94, 0x9D,
+	0x00, 0x00, 0x83, 0x00, 0x00, 0x08, 0xF5, 0xBD, 0x71, 0x8C, 0x6A, 0x4A, 0x49, 0x4A, 0xE4, 0x18, 0x83, 0x10, 0x62, 0x10, 0x62, 0x08, 0x21, 0x00,
+	0x84, 0x01, 0x00, 0x83, 0x22, 0x00, 0x81, 0x42, 0x00, 0x02, 0x63, 0x00, 0x84, 0x00, 0x63, 0x00, 0x8B, 0x42, 0x00, 0x81, 0x43, 0x00, 0x07, 0x42,
+	0x00, 0x83, 0x08, 0x6A, 0x4A, 0x6D, 0x6B, 0xAB, 0x52, 0xA7, 0x31, 0x6E, 0x6B, 0x35, 0xA5, 0x9D, 0x00, 0x00, 0x83, 0x00, 0x00, 0x05, 0xF4, 0xDE,
+	0xCF, 0x7B, 0x0C, 0x63, 0x49, 0x4A, 0x66, 0x29, 0x83, 0x10, 0x81, 0x62, 0x08, 0x01, 0x41, 0x08, 0x00, 0x00, 0x83, 0x01, 0x00, 0x83, 0x21, 0x00,
+	0x81, 0x22, 0x00, 0x01, 0x63, 0x00, 0x64, 0x00, 0x82, 0x63, 0x00, 0x00, 0x42, 0x00, 0x81, 0x21, 0x00, 0x89, 0x42, 0x00, 0x08, 0x63, 0x08, 0x86,
+	0x31, 0xA7, 0x31, 0xA3, 0x10, 0xE8, 0x39, 0x2D, 0x63, 0x71, 0x8C, 0xF7, 0xBD, 0x9D, 0xF7, 0x9B, 0x00, 0x00, 0x84, 0x00, 0x00, 0x01, 0x71, 0x8C,
+	0x10, 0x84, 0x81, 0xE8, 0x41, 0x03, 0xA3, 0x10, 0x82, 0x08, 0x62, 0x08, 0x41, 0x08, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x82, 0x01, 0x00, 0x01,
+	0x22, 0x00, 0x21, 0x00, 0x81, 0x22, 0x00, 0x02, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x00, 0x42, 0x00, 0x81, 0x21, 0x00, 0x81,
+	0x22, 0x00, 0x81, 0x21, 0x00, 0x83, 0x42, 0x00, 0x00, 0x22, 0x00, 0x81, 0x42, 0x00, 0x82, 0x22, 0x00, 0x05, 0x66, 0x29, 0x86, 0x31, 0xA7, 0x31,
+	0x8E, 0x73, 0xD3, 0x9C, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08, 0x14, 0xA5, 0x10, 0x84, 0xEC, 0x5A, 0x4A, 0x4A, 0xE4, 0x18, 0x82,
+	0x10, 0x62, 0x08, 0x42, 0x08, 0x01, 0x00, 0x82, 0x00, 0x00, 0x82, 0x01, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x81, 0x21, 0x00, 0x81, 0x22, 0x00,
+	0x02, 0x42, 0x00, 0x63, 0x00, 0x42, 0x00, 0x86, 0x21, 0x00, 0x81, 0x22, 0x00, 0x81, 0x21, 0x00, 0x00, 0x22, 0x00, 0x84, 0x42, 0x00, 0x05, 0x83,
+	0x08, 0x62, 0x08, 0xC7, 0x39, 0x71, 0x8C, 0x38, 0xC6, 0x3C, 0xE7, 0x9A, 0x00, 0x00, 0x85, 0x00, 0x00, 0x09, 0x4D, 0x6B, 0xEC, 0x5A, 0x29, 0x4A,
+	0x66, 0x29, 0x82, 0x10, 0x62, 0x08, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x81, 0x00, 0x00, 0x84, 0x01, 0x00, 0x02, 0x21, 0x00, 0x22,
+	0x00, 0x21, 0x00, 0x84, 0x42, 0x00, 0x8C, 0x21, 0x00, 0x01, 0x41, 0x00, 0x42, 0x00, 0x81, 0x21, 0x00, 0x03, 0x08, 0x42, 0xAB, 0x52, 0xEB, 0x5A,
+	0x0C, 0x5B, 0x9A, 0x00, 0x00, 0x85, 0x00, 0x00, 0x08, 0xB3, 0x94, 0x10, 0x84, 0x09, 0x42, 0xE8, 0x39, 0x83, 0x10, 0x62, 0x08, 0x42, 0x08, 0x21,
+	0x08, 0x01, 0x00, 0x83, 0x00, 0x00, 0x83, 0x01, 0x00, 0x83, 0x21, 0x00, 0x04, 0x42, 0x00, 0x43, 0x00, 0x63, 0x00, 0x42, 0x00, 0x00, 0x00, 0x8F,
+	0x21, 0x00, 0x81, 0xE4, 0x18, 0x01, 0x69, 0x4A, 0x2C, 0x63, 0x9A, 0x00, 0x00, 0x85, 0x00, 0x00, 0x08, 0xD7, 0xBD, 0xF0, 0x7B, 0xCB, 0x5A, 0x29,
+	0x42, 0xE4, 0x18, 0x62, 0x08, 0x42, 0x08, 0x41, 0x08, 0x01, 0x00, 0x83, 0x00, 0x00, 0x85, 0x01, 0x00, 0x81, 0x21, 0x00, 0x00, 0x22, 0x00, 0x85,
+	0x42, 0x00, 0x8D, 0x21, 0x00, 0x05, 0x01, 0x00, 0x25, 0x21, 0x8A, 0x4A, 0xCF, 0x7B, 0x51, 0x8C, 0x71, 0x8C, 0x98, 0x00, 0x00, 0x86, 0x00, 0x00,
+	0x03, 0x51, 0x8C, 0xCF, 0x7B, 0x09, 0x42, 0x66, 0x31, 0x81, 0x62, 0x08, 0x00, 0x41, 0x08, 0x85, 0x00, 0x00, 0x81, 0x01, 0x00, 0x81, 0x21, 0x00,
+	0x00, 0x01, 0x00, 0x84, 0x21, 0x00, 0x82, 0x42, 0x00, 0x81, 0x21, 0x00, 0x00, 0x01, 0x00, 0x82, 0x00, 0x00, 0x81, 0x21, 0x00, 0x00, 0x01, 0x00,
+	0x84, 0x21, 0x00, 0x81, 0x01, 0x00, 0x04, 0x82, 0x10, 0x24, 0x21, 0x8A, 0x52, 0x6D, 0x6B, 0x92, 0x94, 0x98, 0x00, 0x00, 0x86, 0x00, 0x00, 0x07,
+	0x97, 0xB5, 0x71, 0x8C, 0x8A, 0x52, 0xE8, 0x39, 0x82, 0x10, 0x62, 0x08, 0x41, 0x08, 0x01, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x81, 0x00,
+	0x00, 0x01, 0x01, 0x00, 0x21, 0x00, 0x83, 0x01, 0x00, 0x85, 0x21, 0x00, 0x86, 0x00, 0x00, 0x83, 0x21, 0x00, 0x84, 0x00, 0x00, 0x05, 0x04, 0x21,
+	0x0C, 0x63, 0x6D, 0x6B, 0xAE, 0x73, 0x30, 0x84, 0xB2, 0x94, 0x97, 0x00, 0x00, 0x86, 0x00, 0x00, 0x06, 0xB5, 0x94, 0x30, 0x84, 0x4D, 0x6B, 0x08,
+	0x42, 0x04, 0x21, 0x62, 0x08, 0x41, 0x08, 0x81, 0x01, 0x00, 0x86, 0x00, 0x00, 0x84, 0x01, 0x00, 0x82, 0x21, 0x00, 0x00, 0x01, 0x00, 0x90, 0x00,
+	0x00, 0x05, 0x61, 0x08, 0x86, 0x29, 0x86, 0x31, 0x28, 0x42, 0xEB, 0x5A, 0x71, 0x8C, 0x87, 0x00, 0x00, 0x07, 0x82, 0x10, 0x00, 0x00, 0x44, 0xA5,
+	0x2B, 0xCE, 0x70, 0x9E, 0x93, 0x9E, 0xD4, 0xA5, 0x54, 0xA5, 0x87, 0x00, 0x00, 0x87, 0x00, 0x00, 0x06, 0x34, 0xA5, 0x51, 0x8C, 0x8A, 0x52, 0xA7,
+	0x31, 0x62, 0x08, 0x41, 0x08, 0x21, 0x00, 0x87, 0x00, 0x00, 0x84, 0x01, 0x00, 0x81, 0x00, 0x00, 0x81, 0x01, 0x00, 0x01, 0x21, 0x00, 0x20, 0x00,
+	0x91, 0x00, 0x00, 0x02, 0xEB, 0x5A, 0xCF, 0x7B, 0x8E, 0x73, 0x86, 0x00, 0x00, 0x09, 0x20, 0x00, 0x24, 0x29, 0xD1, 0xA4, 0x70, 0x84, 0x94, 0xA5,
+	0x4F, 0x8C, 0xD6, 0xB5, 0x54, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0x86, 0x00, 0x00, 0x87, 0x00, 0x00, 0x06, 0x14, 0xA5, 0xCF, 0x7B, 0xEB, 0x5A, 0x08,
+	0x42, 0xA3, 0x18, 0x41, 0x08, 0x21, 0x00, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x82, 0x21, 0x00, 0x92, 0x00,
+	0x00, 0x02, 0x24, 0x21, 0x49, 0x4A, 0xAA, 0x52, 0x86, 0x00, 0x00, 0x09, 0x8E, 0x73, 0x2D, 0x63, 0x14, 0x9D, 0xEF, 0x7B, 0xAF, 0x73, 0x4A, 0x42,
+	0xE9, 0x31, 0x4A, 0x42, 0xB3, 0x94, 0x35, 0xA5, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x05, 0x71, 0x8C, 0x8E, 0x73, 0x29, 0x42, 0x87, 0x31, 0x62,
+	0x08, 0x21, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x21, 0x00, 0x95, 0x00, 0x00, 0x01, 0x08, 0x42, 0xEB, 0x5A, 0x81, 0x00, 0x00, 0x10, 0x21, 0x08, 0x84,
+	0x85, 0xB1, 0x84, 0x75, 0x94, 0x91, 0x94, 0xCF, 0x7B, 0xEC, 0x5A, 0xE8, 0x39, 0x88, 0x29, 0xA8, 0x29, 0x48, 0x21, 0xE9, 0x31, 0x6A, 0x4A, 0x30,
+	0x84, 0xF2, 0x94, 0x51, 0x86, 0x0E, 0xA7, 0x84, 0x00, 0x00, 0x88, 0x00, 0x00, 0x05, 0x18, 0xC6, 0xF0, 0x7B, 0x4D, 0x6B, 0x08, 0x42, 0xA3, 0x10,
+	0x21, 0x08, 0xA5, 0x00, 0x00, 0x02, 0xE3, 0x18, 0xEF, 0x7B, 0x14, 0xA5, 0x81, 0x00, 0x00, 0x0F, 0xB7, 0xBD, 0xCD, 0x7B, 0x92, 0x8C, 0x2C, 0x63,
+	0xC8, 0x39, 0x26, 0x21, 0xC5, 0x10, 0xA6, 0x08, 0xC6, 0x08, 0x4A, 0x4A, 0x31, 0x84, 0x8F, 0x73, 0xAC, 0x52, 0x10, 0x7C, 0x71, 0x8C, 0xB0, 0x94,
+	0x84, 0x00, 0x00, 0x89, 0x00, 0x00, 0x04, 0x55, 0xAD, 0x72, 0x8C, 0x08, 0x42, 0x25, 0x29, 0x41, 0x08, 0xA5, 0x00, 0x00, 0x09, 0x61, 0x08, 0x8A,
+	0x52, 0x8E, 0x73, 0x00, 0x00, 0xAE, 0x73, 0xF7, 0xBD, 0x4D, 0x6B, 0xE8, 0x39, 0x46, 0x21, 0xC4, 0x10, 0x82, 0x84, 0x00, 0x07, 0xA5, 0x08, 0x26,
+	0x21, 0xC9, 0x31, 0x89, 0x29, 0x48, 0x19, 0xA9, 0x29, 0xCC, 0x52, 0x2D, 0x5B, 0x84, 0x00, 0x00, 0x89, 0x00, 0x00, 0x05, 0x15, 0xC6, 0xF0, 0x7B,
+	0x0C, 0x63, 0xC8, 0x39, 0x42, 0x08, 0x01, 0x00, 0xA4, 0x00, 0x00, 0x07, 0x86, 0x31, 0xAE, 0x73, 0x96, 0xB5, 0xEB, 0x5A, 0x10, 0x7C, 0xAA, 0x52,
+	0x45, 0x29, 0xA3, 0x08, 0x82, 0x63, 0x00, 0x04, 0x84, 0x00, 0x84, 0x08, 0xA5, 0x08, 0xA6, 0x08, 0xC6, 0x08, 0x81, 0xE7, 0x08, 0x04, 0x28, 0x11,
+	0x8B, 0x4A, 0x0F, 0x7C, 0x33, 0xCF, 0xEE, 0xE6, 0x82, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x04, 0x92, 0x94, 0xCF, 0x7B, 0x08, 0x42, 0xC4, 0x18, 0x21,
+	0x00, 0xA4, 0x00, 0x00, 0x06, 0x41, 0x08, 0xEB, 0x5A, 0x10, 0x84, 0x4D, 0x6B, 0xC7, 0x39, 0xC3, 0x10, 0x62, 0x00, 0x82, 0x42, 0x00, 0x02, 0x63,
+	0x00, 0x64, 0x00, 0x84, 0x08, 0x81, 0xA5, 0x08, 0x07, 0xC6, 0x08, 0xC7, 0x08, 0xE7, 0x08, 0x28, 0x19, 0x51, 0x84, 0xB3, 0x94, 0x56, 0xAC, 0xCF,
+	0xBD, 0x82, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x04, 0x54, 0xA5, 0xCE, 0x7B, 0xEB, 0x5A, 0x87, 0x31, 0x21, 0x08, 0xA5, 0x00, 0x00, 0x03, 0xE3, 0x18,
+	0x65, 0x29, 0x24, 0x21, 0x62, 0x08, 0x82, 0x21, 0x00, 0x01, 0x22, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x01, 0x84, 0x00, 0x85, 0x08, 0x82, 0xA5,
+	0x08, 0x05, 0xC6, 0x08, 0x07, 0x11, 0xAC, 0x52, 0xF0, 0x7B, 0x92, 0x8C, 0x11, 0xA5, 0x82, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x70, 0x8C, 0x8D,
+	0x73, 0xC7, 0x39, 0xC4, 0x18, 0x20, 0x00, 0xA5, 0x00, 0x00, 0x81, 0x20, 0x00, 0x82, 0x00, 0x00, 0x81, 0x21, 0x00, 0x81, 0x42, 0x00, 0x81, 0x63,
+	0x00, 0x02, 0x64, 0x00, 0x84, 0x00, 0xA5, 0x08, 0x81, 0xC6, 0x08, 0x04, 0xE7, 0x08, 0x28, 0x19, 0xC9, 0x29, 0x31, 0x7C, 0x13, 0x9D, 0x82, 0x00,
+	0x00, 0x8B, 0x00, 0x00, 0x04, 0xF7, 0xBD, 0xCF, 0x7B, 0xEB, 0x5A, 0x45, 0x29, 0x21, 0x00, 0xAB, 0x00, 0x00, 0x81, 0x21, 0x00, 0x81, 0x42, 0x00,
+	0x05, 0x63, 0x00, 0x64, 0x00, 0x84, 0x08, 0xA5, 0x08, 0xA6, 0x08, 0xC6, 0x08, 0x81, 0xE7, 0x08, 0x02, 0x69, 0x21, 0x72, 0x8C, 0x33, 0xA5, 0x82,
+	0x00, 0x00, 0x8C, 0x00, 0x00, 0x03, 0xB2, 0x94, 0xCF, 0x7B, 0x66, 0x29, 0x62, 0x08, 0xAB, 0x00, 0x00, 0x01, 0x20, 0x00, 0x21, 0x00, 0x81, 0x42,
+	0x00, 0x02, 0x63, 0x00, 0x64, 0x00, 0x84, 0x08, 0x81, 0xA5, 0x08, 0x05, 0xC6, 0x08, 0xC7, 0x08, 0x07, 0x11, 0x4A, 0x42, 0x51, 0x8C, 0xD3, 0xBD,
+	0x82, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x04, 0xB1, 0x94, 0xAF, 0x73, 0x0C, 0x63, 0xE4, 0x18, 0x21, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x21, 0x00, 0x84,
+	0x01, 0x00, 0x00, 0x21, 0x00, 0x81, 0x01, 0x00, 0x88, 0x00, 0x00, 0x01, 0x21, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x81, 0x84, 0x00, 0x06, 0xA5,
+	0x00, 0xA5, 0x08, 0xC6, 0x08, 0x47, 0x21, 0x6E, 0x6B, 0x50, 0x84, 0x72, 0xBD, 0x82, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x03, 0x14, 0xA5, 0xEF, 0x7B,
+	0x45, 0x29, 0x62, 0x08, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x81, 0x22, 0x00, 0x82, 0x21, 0x00, 0x83, 0x22, 0x00, 0x00, 0x21, 0x00, 0x83, 0x00,
+	0x00, 0x02, 0x20, 0x00, 0x61, 0x08, 0x41, 0x08, 0x81, 0x21, 0x00, 0x81, 0x42, 0x00, 0x02, 0x63, 0x00, 0x84, 0x00, 0x84, 0x08, 0x81, 0xA5, 0x08,
+	0x05, 0xC6, 0x08, 0x27, 0x19, 0xCC, 0x52, 0x8E, 0x6B, 0x10, 0x7C, 0x71, 0x84, 0x81, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x02, 0x4C, 0x6B, 0x69, 0x4A,
+	0x61, 0x08, 0x9A, 0x00, 0x00, 0x00, 0x21, 0x00, 0x85, 0x22, 0x00, 0x82, 0x43, 0x00, 0x00, 0x01, 0x00, 0x81, 0x00, 0x00, 0x00, 0x20, 0x00, 0x82,
+	0x21, 0x00, 0x07, 0x00, 0x00, 0x21, 0x00, 0x42, 0x00, 0x43, 0x00, 0x64, 0x00, 0x84, 0x00, 0xA4, 0x08, 0xA5, 0x08, 0x81, 0xC6, 0x08, 0x06, 0xE7,
+	0x08, 0x28, 0x19, 0x89, 0x21, 0x8F, 0x73, 0xD4, 0x9C, 0x18, 0xC6, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x02, 0xB2, 0x94, 0xAE, 0x73, 0xA3, 0x10, 0x9C,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x83, 0x22, 0x00, 0x82, 0x43, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x81, 0x00, 0x00, 0x83, 0x01, 0x00,
+	0x05, 0x22, 0x00, 0x43, 0x00, 0x63, 0x00, 0x84, 0x00, 0xA4, 0x08, 0xA5, 0x08, 0x81, 0xC6, 0x08, 0x81, 0xE7, 0x08, 0x04, 0x08, 0x11, 0xC9, 0x31,
+	0xD7, 0xBD, 0x59, 0xCE, 0x61, 0x08, 0x8E, 0x00, 0x00, 0x05, 0x59, 0xCE, 0x30, 0x84, 0x28, 0x42, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x9B, 0x00,
+	0x00, 0x83, 0x01, 0x00, 0x81, 0x02, 0x00, 0x01, 0x01, 0x00, 0x20, 0x00, 0x81, 0x41, 0x08, 0x81, 0x21, 0x00, 0x83, 0x01, 0x00, 0x0D, 0x42, 0x00,
+	0x63, 0x00, 0x84, 0x00, 0x84, 0x08, 0xA5, 0x08, 0xA6, 0x08, 0xC6, 0x08, 0xC7, 0x08, 0x07, 0x11, 0xA9, 0x29, 0xAC, 0x52, 0xCF, 0x73, 0x30, 0x84,
+	0x00, 0x00, 0x8F, 0x00, 0x00, 0x07, 0x6E, 0x6B, 0xCB, 0x5A, 0x42, 0x08, 0x21, 0x00, 0x41, 0x08, 0x21, 0x08, 0x21, 0x00, 0x20, 0x00, 0x99, 0x00,
+	0x00, 0x85, 0x01, 0x00, 0x05, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x82, 0x10, 0xA2, 0x10, 0x61, 0x08, 0x82, 0x01, 0x00, 0x00, 0x42, 0x00, 0x81,
+	0x63, 0x00, 0x02, 0x84, 0x00, 0xA4, 0x00, 0xA5, 0x08, 0x81, 0xC6, 0x08, 0x03, 0xA8, 0x29, 0x10, 0x84, 0x92, 0x94, 0x52, 0x8C, 0x81, 0x00, 0x00,
+	0x8F, 0x00, 0x00, 0x08, 0x2C, 0x63, 0x49, 0x4A, 0x41, 0x08, 0x62, 0x08, 0x42, 0x08, 0x41, 0x08, 0x41, 0x00, 0x21, 0x00, 0x20, 0x00, 0x99, 0x00,
+	0x00, 0x84, 0x01, 0x00, 0x03, 0x21, 0x00, 0x41, 0x08, 0x21, 0x00, 0x82, 0x10, 0x81, 0xC3, 0x18, 0x00, 0x21, 0x00, 0x81, 0x01, 0x00, 0x02, 0x42,
+	0x00, 0x63, 0x00, 0x84, 0x00, 0x81, 0xA5, 0x08, 0x06, 0xC6, 0x08, 0xE7, 0x08, 0x08, 0x09, 0x68, 0x21, 0xF0, 0x7B, 0xB2, 0x94, 0x13, 0x9D, 0x81,
+	0x00, 0x00, 0x8F, 0x00, 0x00, 0x06, 0x54, 0xAD, 0x10, 0x84, 0x63, 0x08, 0xA4, 0x10, 0x83, 0x10, 0x62, 0x08, 0x41, 0x08, 0x81, 0x21, 0x00, 0x00,
+	0x20, 0x00, 0x95, 0x00, 0x00, 0x87, 0x01, 0x00, 0x05, 0x21, 0x00, 0x61, 0x08, 0x21, 0x00, 0x01, 0x00, 0x62, 0x08, 0x21, 0x00, 0x81, 0x01, 0x00,
+	0x01, 0x21, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x03, 0x84, 0x08, 0xA5, 0x08, 0xC6, 0x08, 0xE7, 0x08, 0x81, 0x08, 0x09, 0x02, 0x89, 0x29, 0x30,
+	0x84, 0xB2, 0x94, 0x81, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0A, 0x59, 0xCE, 0xF3, 0x9C, 0x42, 0x08, 0xC4, 0x18, 0x83, 0x10, 0x63, 0x08, 0x62, 0x08,
+	0x41, 0x08, 0x21, 0x08, 0x21, 0x00, 0x20, 0x00, 0x89, 0x00, 0x00, 0x82, 0x01, 0x00, 0x89, 0x00, 0x00, 0x85, 0x01, 0x00, 0x02, 0x21, 0x00, 0x61,
+	0x08, 0x21, 0x00, 0x84, 0x01, 0x00, 0x01, 0x22, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x81, 0x84, 0x00, 0x06, 0xA5, 0x08, 0xC6, 0x08, 0xE8, 0x08,
+	0x08, 0x09, 0x28, 0x19, 0x2D, 0x63, 0x31, 0x84, 0x81, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0B, 0xF7, 0xBD, 0xB2, 0x94, 0x42, 0x08, 0xA3, 0x10, 0xA4,
+	0x10, 0x83, 0x10, 0x63, 0x08, 0x62, 0x08, 0x41, 0x08, 0x21, 0x08, 0x21, 0x00, 0x20, 0x00, 0x8A, 0x00, 0x00, 0x82, 0x01, 0x00, 0x86, 0x00, 0x00,
+	0x85, 0x01, 0x00, 0x02, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x21, 0x00, 0x81, 0x42, 0x00, 0x00, 0x63, 0x00, 0x81, 0x84,
+	0x00, 0x00, 0xA5, 0x08, 0x82, 0xC6, 0x08, 0x03, 0xE7, 0x10, 0xEA, 0x31, 0x4E, 0x6B, 0x92, 0x8C, 0x81, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x08, 0x51,
+	0x8C, 0x6E, 0x6B, 0xC4, 0x18, 0xE5, 0x18, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x63, 0x08, 0x62, 0x08, 0x81, 0x41, 0x08, 0x01, 0x21, 0x00, 0x20,
+	0x00, 0x87, 0x00, 0x00, 0x83, 0x01, 0x00, 0x82, 0x00, 0x00, 0x8B, 0x01, 0x00, 0x05, 0x21, 0x00, 0xA3, 0x10, 0x04, 0x21, 0x25, 0x21, 0x62, 0x08,
+	0x01, 0x00, 0x81, 0x21, 0x00, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x02, 0x84, 0x00, 0x84, 0x08, 0xA5, 0x08, 0x81, 0xC6, 0x08, 0x04, 0xE7, 0x08,
+	0x48, 0x19, 0xF0, 0x7B, 0x30, 0x8C, 0xB1, 0xA4, 0x81, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x31, 0x84, 0x4D, 0x6B, 0xC4, 0x18, 0x81, 0xE5, 0x18,
+	0x08, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x63, 0x08, 0x62, 0x08, 0x41, 0x08, 0x21, 0x08, 0x21, 0x00, 0x20, 0x00, 0x81, 0x00, 0x00, 0x81, 0x21,
+	0x00, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x00, 0x00, 0x01, 0x01, 0x00, 0x22, 0x00, 0x84, 0x21, 0x00, 0x00, 0x22, 0x00, 0x81, 0x02, 0x00,
+	0x0A, 0x22, 0x00, 0x45, 0x29, 0x66, 0x29, 0x69, 0x4A, 0x0C, 0x63, 0xCB, 0x5A, 0x24, 0x21, 0xC3, 0x18, 0x62, 0x08, 0x22, 0x00, 0x42, 0x00, 0x81,
+	0x63, 0x00, 0x00, 0x84, 0x00, 0x81, 0xA5, 0x08, 0x05, 0xC6, 0x08, 0xE6, 0x08, 0xE7, 0x08, 0x48, 0x19, 0x8F, 0x6B, 0x4F, 0x84, 0x82, 0x00, 0x00,
+	0x8E, 0x00, 0x00, 0x13, 0x76, 0xAD, 0xAF, 0x73, 0xE8, 0x39, 0xC4, 0x18, 0x06, 0x21, 0x06, 0x19, 0xE5, 0x18, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10,
+	0x82, 0x10, 0x62, 0x08, 0x41, 0x08, 0x21, 0x08, 0x21, 0x00, 0x20, 0x00, 0x61, 0x18, 0xE2, 0x38, 0xE2, 0x30, 0x21, 0x00, 0x82, 0x00, 0x00, 0x81,
+	0x01, 0x00, 0x82, 0x00, 0x00, 0x01, 0x01, 0x00, 0x21, 0x00, 0x86, 0x22, 0x00, 0x02, 0x23, 0x00, 0x22, 0x00, 0x83, 0x08, 0x81, 0xAB, 0x52, 0x08,
+	0xEF, 0x7B, 0x6D, 0x6B, 0x08, 0x42, 0x86, 0x31, 0x49, 0x4A, 0xE8, 0x39, 0x66, 0x29, 0xA4, 0x08, 0x63, 0x00, 0x81, 0x84, 0x00, 0x81, 0xA5, 0x08,
+	0x05, 0xA6, 0x00, 0xC7, 0x08, 0xE7, 0x08, 0x69, 0x21, 0xF0, 0x7B, 0x91, 0x8C, 0x82, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x03, 0x6E, 0x6B, 0x6A, 0x4A,
+	0xA3, 0x10, 0xC5, 0x18, 0x81, 0x06, 0x21, 0x11, 0x06, 0x19, 0xE5, 0x18, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x62, 0x10, 0x42, 0x08, 0x41, 0x08,
+	0x21, 0x08, 0x21, 0x00, 0xC1, 0x30, 0xC1, 0x69, 0xC2, 0x71, 0xE2, 0x38, 0x21, 0x00, 0x20, 0x08, 0x21, 0x08, 0x20, 0x00, 0x83, 0x00, 0x00, 0x81,
+	0x01, 0x00, 0x00, 0x02, 0x00, 0x84, 0x22, 0x00, 0x00, 0x23, 0x00, 0x81, 0x43, 0x00, 0x03, 0x21, 0x00, 0x41, 0x08, 0x45, 0x29, 0xEB, 0x5A, 0x81,
+	0xAA, 0x52, 0x0F, 0x6D, 0x6B, 0x51, 0x8C, 0xB2, 0x94, 0x4D, 0x6B, 0x09, 0x42, 0x67, 0x29, 0x06, 0x19, 0xA5, 0x08, 0xA5, 0x00, 0xC5, 0x10, 0xE9,
+	0x39, 0x0A, 0x3A, 0x2A, 0x42, 0x2A, 0x3A, 0x11, 0x7C, 0xD2, 0x8C, 0x82, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x04, 0xD6, 0xBD, 0xCF, 0x7B, 0x29, 0x42,
+	0x83, 0x10, 0xA4, 0x10, 0x82, 0x06, 0x21, 0x07, 0x06, 0x19, 0xE5, 0x18, 0xC5, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x62, 0x10, 0x62, 0x08, 0x41, 0x08,
+	0x81, 0x21, 0x08, 0x04, 0xA2, 0x28, 0xE2, 0x69, 0xE2, 0x71, 0x01, 0x00, 0x21, 0x00, 0x81, 0x41, 0x08, 0x01, 0x21, 0x08, 0x20, 0x00, 0x81, 0x01,
+	0x00, 0x81, 0x22, 0x00, 0x81, 0x02, 0x00, 0x81, 0x01, 0x00, 0x83, 0x22, 0x00, 0x05, 0x23, 0x00, 0x62, 0x08, 0x21, 0x00, 0x69, 0x4A, 0xAE, 0x73,
+	0xB2, 0x94, 0x81, 0x55, 0xAD, 0x0E, 0x15, 0x9D, 0x4D, 0xA5, 0x33, 0xA5, 0xF4, 0x9C, 0x2D, 0x63, 0x2A, 0x42, 0x09, 0x3A, 0x88, 0x29, 0x67, 0x21,
+	0x8F, 0x73, 0x72, 0x8C, 0x92, 0x8C, 0xB3, 0x94, 0x32, 0x9D, 0x4F, 0x96, 0x82, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x04, 0xB2, 0x9C, 0xCF, 0x7B, 0xE4,
+	0x18, 0x82, 0x10, 0xA3, 0x10, 0x84, 0x06, 0x21, 0x03, 0xE5, 0x18, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x81, 0x62, 0x08, 0x07, 0x41, 0x08, 0x21,
+	0x08, 0x21, 0x00, 0x81, 0x28, 0xA1, 0x30, 0x20, 0x08, 0x00, 0x00, 0x21, 0x08, 0x81, 0x82, 0x10, 0x01, 0x62, 0x08, 0x41, 0x08, 0x81, 0x62, 0x08,
+	0x02, 0xA3, 0x10, 0x82, 0x10, 0x21, 0x00, 0x85, 0x00, 0x00, 0x07, 0x62, 0x08, 0xA6, 0x31, 0x04, 0x21, 0x24, 0x21, 0x49, 0x4A, 0x4D, 0x6B, 0x30,
+	0x84, 0x71, 0x8C, 0x82, 0x00, 0x00, 0x09, 0xF7, 0xC3, 0xD7, 0xBD, 0xD3, 0x94, 0x72, 0x8C, 0x2D, 0x63, 0x2A, 0x42, 0x6B, 0x4A, 0xF3, 0x9C, 0x96,
+	0xAD, 0x51, 0x9D, 0x84, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x09, 0x79, 0xEF, 0x10, 0x84, 0x2C, 0x63, 0xE4, 0x18, 0x62, 0x08, 0x83, 0x10, 0xA4, 0x10,
+	0xC5, 0x18, 0xE5, 0x18, 0xE6, 0x18, 0x81, 0x06, 0x21, 0x06, 0xE5, 0x18, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x62, 0x10, 0x62, 0x08, 0x41, 0x08,
+	0x81, 0x21, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x62, 0x08, 0xA3, 0x18, 0x81, 0xC3, 0x18, 0x06, 0xA3, 0x18, 0x82, 0x10, 0xA2, 0x10,
+	0x04, 0x21, 0xE4, 0x20, 0x82, 0x10, 0x20, 0x00, 0x84, 0x00, 0x00, 0x08, 0x04, 0x21, 0x4D, 0x6B, 0x28, 0x42, 0xEB, 0x5A, 0x28, 0x42, 0x24, 0x21,
+	0x0C, 0x63, 0xEF, 0x7B, 0x92, 0x94, 0x82, 0x00, 0x00, 0x08, 0xB3, 0x73, 0x4E, 0xC6, 0x70, 0xBE, 0x1B, 0xDF, 0xD3, 0x94, 0xF0, 0x7B, 0x92, 0x94,
+	0xF3, 0x9C, 0x0C, 0xB7, 0x84, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x05, 0xE0, 0x9C, 0x75, 0xAD, 0xF0, 0x7B, 0xE8, 0x39, 0xA3, 0x10, 0x21, 0x08, 0x81,
+	0x00, 0x00, 0x02, 0x01, 0x00, 0x62, 0x08, 0xA4, 0x10, 0x81, 0xE5, 0x18, 0x07, 0xE5, 0x20, 0xE5, 0x18, 0xC4, 0x18, 0xA4, 0x10, 0x83, 0x10, 0x62,
+	0x10, 0x42, 0x08, 0x41, 0x08, 0x81, 0x21, 0x00, 0x06, 0x41, 0x08, 0x62, 0x08, 0x83, 0x10, 0xC3, 0x18, 0x04, 0x21, 0x25, 0x29, 0x24, 0x21, 0x82,
+	0x04, 0x21, 0x01, 0xE3, 0x18, 0x82, 0x10, 0x84, 0x00, 0x00, 0x09, 0x20, 0x00, 0x49, 0x4A, 0xAE, 0x73, 0x49, 0x4A, 0x30, 0x84, 0x4D, 0x6B, 0x45,
+	0x29, 0xE3, 0x18, 0x0C, 0x63, 0x51, 0x8C, 0x81, 0x00, 0x00, 0x08, 0xC4, 0xC6, 0xF9, 0x8B, 0x5E, 0xD2, 0x96, 0xD5, 0x16, 0xCE, 0xF1, 0x96, 0x4F,
+	0xAF, 0x8F, 0xAD, 0xAB, 0xC6, 0x85, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x03, 0x30, 0x84, 0x6D, 0x6B, 0x04, 0x21, 0x41, 0x08, 0x84, 0x00, 0x00, 0x03,
+	0x01, 0x00, 0x21, 0x00, 0x83, 0x08, 0xC4, 0x18, 0x81, 0xE5, 0x18, 0x04, 0xC4, 0x18, 0xA3, 0x10, 0x83, 0x10, 0x62, 0x10, 0x42, 0x08, 0x81, 0x41,
+	0x08, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x08, 0x83, 0x10, 0xC7, 0x39, 0x49, 0x4A, 0xC7, 0x39, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xC3, 0x18,
+	0x41, 0x08, 0x84, 0x00, 0x00, 0x09, 0x82, 0x10, 0xEF, 0x7B, 0x30, 0x84, 0x28, 0x42, 0x6D, 0x6B, 0xCF, 0x7B, 0x86, 0x31, 0x08, 0x42, 0x69, 0x4A,
+	0xAA, 0x52, 0x90, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x51, 0x8C, 0x0C, 0x63, 0x08, 0x42, 0x04, 0x21, 0x20, 0x00, 0x85, 0x00, 0x00, 0x03, 0x01,
+	0x00, 0x21, 0x00, 0x42, 0x08, 0xA4, 0x10, 0x81, 0xC5, 0x18, 0x06, 0xC4, 0x18, 0xA3, 0x10, 0x83, 0x10, 0x62, 0x08, 0x42, 0x08, 0x41, 0x08, 0x42,
+	0x08, 0x81, 0x62, 0x08, 0x07, 0x82, 0x10, 0x08, 0x42, 0xAA, 0x5A, 0xE8, 0x41, 0x24, 0x21, 0xC3, 0x18, 0x82, 0x10, 0x20, 0x00, 0x85, 0x00, 0x00,
+	0x08, 0x24, 0x21, 0x0C, 0x63, 0x4D, 0x6B, 0xAA, 0x52, 0x6D, 0x6B, 0x55, 0xAD, 0x08, 0x42, 0x30, 0x84, 0x14, 0xA5, 0x91, 0x00, 0x00, 0x8B, 0x00,
+	0x00, 0x04, 0x4D, 0x6B, 0x8A, 0x52, 0x25, 0x21, 0x82, 0x10, 0x20, 0x00, 0x85, 0x00, 0x00, 0x82, 0x01, 0x00, 0x02, 0x21, 0x00, 0x83, 0x08, 0xA4,
+	0x10, 0x81, 0xC4, 0x18, 0x04, 0x83, 0x10, 0x62, 0x08, 0x42, 0x08, 0x42, 0x00, 0x21, 0x00, 0x81, 0x41, 0x00, 0x00, 0x62, 0x08, 0x81, 0x45, 0x29,
+	0x00, 0x82, 0x10, 0x89, 0x00, 0x00, 0x00, 0x08, 0x42, 0x81, 0x10, 0x84, 0x05, 0x71, 0x8C, 0xFF, 0xFF, 0x00, 0x00, 0x0C, 0x63, 0x14, 0xA5, 0x75,
+	0xAD, 0x91, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x04, 0xEF, 0x7B, 0x0C, 0x63, 0x08, 0x42, 0x45, 0x29, 0x21, 0x00, 0x85, 0x00, 0x00, 0x85, 0x01, 0x00,
+	0x01, 0x21, 0x00, 0x42, 0x00, 0x81, 0x42, 0x08, 0x81, 0x41, 0x00, 0x81, 0x22, 0x00, 0x81, 0x21, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x86, 0x31, 0x28,
+	0x42, 0x6D, 0x6B, 0x14, 0xA5, 0x34, 0xA5, 0x82, 0x00, 0x00, 0x01, 0x1C, 0xE7, 0xDB, 0xDE, 0x91, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x04, 0x0C, 0x63,
+	0xAB, 0x52, 0x66, 0x31, 0x04, 0x21, 0x21, 0x00, 0x85, 0x00, 0x00, 0x01, 0x01, 0x00, 0x22, 0x00, 0x83, 0x01, 0x00, 0x83, 0x21, 0x00, 0x82, 0x42,
+	0x00, 0x81, 0x21, 0x00, 0x81, 0x00, 0x00, 0x87, 0x21, 0x00, 0x00, 0x01, 0x00, 0x81, 0x21, 0x00, 0x06, 0x00, 0x00, 0x69, 0x4A, 0x2D, 0x63, 0x6D,
+	0x6B, 0xB6, 0xB5, 0xF7, 0xBD, 0xBA, 0xD6, 0x83, 0x00, 0x00, 0x00, 0xA2, 0x10, 0x90, 0x00, 0x00, 0x89, 0x00, 0x00, 0x05, 0x12, 0xA5, 0x8E, 0x73,
+	0x28, 0x42, 0x87, 0x31, 0x83, 0x10, 0x21, 0x00, 0x81, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x21, 0x00, 0x81, 0x01, 0x00, 0x84, 0x21, 0x00, 0x01,
+	0x42, 0x00, 0x22, 0x00, 0x82, 0x42, 0x00, 0x00, 0x21, 0x00, 0x81, 0x01, 0x00, 0x8A, 0x21, 0x00, 0x04, 0x65, 0x29, 0xE7, 0x39, 0xC7, 0x39, 0x69,
+	0x4A, 0x2C, 0x63, 0x85, 0x00, 0x00, 0x00, 0x61, 0x08, 0x91, 0x00, 0x00, 0x89, 0x00, 0x00, 0x06, 0x71, 0x8C, 0xCF, 0x7B, 0x66, 0x29, 0x45, 0x29,
+	0x21, 0x08, 0x01, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x84, 0x21, 0x00, 0x02, 0x22, 0x00, 0x21, 0x00, 0x42, 0x00, 0x81, 0x43, 0x00, 0x02, 0x42,
+	0x00, 0x21, 0x00, 0x01, 0x00, 0x8C, 0x21, 0x00, 0x05, 0x01, 0x00, 0x08, 0x42, 0x0C, 0x63, 0x6D, 0x6B, 0xAE, 0x73, 0x10, 0x84, 0x98, 0x00, 0x00,
+	0x88, 0x00, 0x00, 0x06, 0x96, 0xB5, 0xF0, 0x7B, 0xCB, 0x5A, 0xA7, 0x31, 0xC3, 0x18, 0x21, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x81, 0x22, 0x00,
+	0x00, 0x42, 0x00, 0x84, 0x43, 0x00, 0x00, 0x42, 0x00, 0x8D, 0x21, 0x00, 0x04, 0x00, 0x00, 0x28, 0x42, 0x0C, 0x63, 0x10, 0x84, 0x92, 0x94, 0x99,
+	0x00, 0x00, 0x88, 0x00, 0x00, 0x01, 0x10, 0x84, 0x8E, 0x73, 0x81, 0x86, 0x31, 0x02, 0x41, 0x08, 0x21, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x82,
+	0x21, 0x00, 0x81, 0x22, 0x00, 0x02, 0x21, 0x00, 0x22, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x00, 0x22, 0x00, 0x8B, 0x21, 0x00, 0x83, 0x22, 0x00,
+	0x05, 0xC4, 0x18, 0x66, 0x29, 0x69, 0x4A, 0x51, 0x8C, 0x9A, 0xD6, 0xFB, 0xDE, 0x99, 0x00, 0x00, 0x87, 0x00, 0x00, 0x05, 0x38, 0xC6, 0xB2, 0x94,
+	0xEC, 0x5A, 0xA7, 0x31, 0xE4, 0x18, 0x41, 0x08, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x21, 0x00, 0x82, 0x22, 0x00, 0x02,
+	0x42, 0x00, 0x63, 0x00, 0x62, 0x00, 0x81, 0x42, 0x00, 0x82, 0x21, 0x00, 0x04, 0x41, 0x00, 0x42, 0x00, 0x22, 0x00, 0x21, 0x00, 0x22, 0x00, 0x86,
+	0x42, 0x00, 0x05, 0x01, 0x00, 0xE4, 0x18, 0x8A, 0x52, 0xAA, 0x52, 0x30, 0x84, 0x38, 0xC6, 0x9A, 0x00, 0x00, 0x87, 0x00, 0x00, 0x05, 0x34, 0xA5,
+	0x92, 0x94, 0x49, 0x4A, 0x87, 0x31, 0x62, 0x08, 0x21, 0x00, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x21, 0x00, 0x83, 0x22,
+	0x00, 0x81, 0x42, 0x00, 0x02, 0x63, 0x00, 0x84, 0x00, 0x63, 0x00, 0x81, 0x21, 0x00, 0x00, 0x41, 0x00, 0x81, 0x42, 0x00, 0x00, 0x22, 0x00, 0x87,
+	0x42, 0x00, 0x81, 0x22, 0x00, 0x05, 0x04, 0x19, 0xC7, 0x39, 0x08, 0x42, 0x2D, 0x63, 0x92, 0x94, 0x79, 0xCE, 0x9B, 0x00, 0x00, 0x86, 0x00, 0x00,
+	0x05, 0xD1, 0x9C, 0x30, 0x84, 0x4D, 0x6B, 0xA7, 0x39, 0xE4, 0x18, 0x41, 0x08, 0x82, 0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x21, 0x00, 0x81, 0x22, 0x00, 0x02, 0x42, 0x00, 0x63, 0x00, 0x84, 0x00, 0x81, 0x64, 0x00, 0x02, 0x63, 0x00, 0x42, 0x00, 0x21, 0x00, 0x87,
+	0x42, 0x00, 0x00, 0x62, 0x00, 0x81, 0x42, 0x00, 0x08, 0x04, 0x19, 0x45, 0x21, 0xA3, 0x10, 0x05, 0x19, 0xEB, 0x5A, 0x8E, 0x73, 0xAE, 0x73, 0xB3,
+	0x94, 0x18, 0xC6, 0x9B, 0x00, 0x00, 0x86, 0x00, 0x00, 0x05, 0xF0, 0x7B, 0x8E, 0x73, 0x08, 0x42, 0x66, 0x29, 0x62, 0x08, 0x21, 0x00, 0x84, 0x01,
+	0x00, 0x83, 0x22, 0x00, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00, 0x01, 0x84, 0x00, 0x63, 0x00, 0x86, 0x42, 0x00, 0x81, 0x62, 0x00, 0x82, 0x42, 0x00,
+	0x08, 0x63, 0x00, 0x43, 0x00, 0x22, 0x00, 0x25, 0x21, 0xCB, 0x5A, 0x2C, 0x63, 0x8A, 0x4A, 0x0C, 0x63, 0xAE, 0x73, 0x9E, 0x00, 0x00, 0x85, 0x00,
+	0x00, 0x05, 0xAA, 0x52, 0x0C, 0x63, 0xAB, 0x52, 0xA7, 0x31, 0xA3, 0x10, 0x41, 0x08, 0x83, 0x01, 0x00, 0x00, 0x02, 0x00, 0x83, 0x22, 0x00, 0x01,
+	0x42, 0x00, 0x63, 0x00, 0x81, 0x84, 0x00, 0x00, 0x43, 0x00, 0x83, 0x42, 0x00, 0x00, 0x43, 0x00, 0x82, 0x42, 0x00, 0x85, 0x63, 0x00, 0x07, 0x86,
+	0x31, 0x66, 0x29, 0x02, 0x00, 0xAA, 0x52, 0x10, 0x84, 0x71, 0x8C, 0x8E, 0x73, 0xEC, 0x5A, 0x9E, 0x00, 0x00, 0x83, 0x00, 0x00, 0x06, 0xAA, 0x73,
+	0x32, 0xA5, 0x51, 0x8C, 0x6A, 0x52, 0xA7, 0x31, 0xE4, 0x20, 0x62, 0x08, 0x84, 0x01, 0x00, 0x83, 0x22, 0x00, 0x00, 0x42, 0x00, 0x81, 0x63, 0x00,
+	0x01, 0x84, 0x00, 0x63, 0x00, 0x84, 0x42, 0x00, 0x00, 0x62, 0x00, 0x85, 0x63, 0x00, 0x09, 0x64, 0x00, 0x63, 0x00, 0x43, 0x00, 0x6A, 0x4A, 0x4D,
+	0x6B, 0xCB, 0x5A, 0xC8, 0x39, 0x8A, 0x52, 0xCF, 0x7B, 0x75, 0xAD, 0x9F, 0x00, 0x00, 0x83, 0x00, 0x00, 0x06, 0x94, 0x94, 0x72, 0x8C, 0x2D, 0x6B,
+	0xC7, 0x39, 0x25, 0x21, 0x62, 0x10, 0x42, 0x08, 0x83, 0x01, 0x00, 0x82, 0x22, 0x00, 0x02, 0x42, 0x00, 0x43, 0x00, 0x63, 0x00, 0x81, 0x84, 0x00,
+	0x00, 0x63, 0x00, 0x83, 0x42, 0x00, 0x00, 0x43, 0x00, 0x81, 0x42, 0x00, 0x81, 0x63, 0x00, 0x00, 0x83, 0x00, 0x82, 0x63, 0x00, 0x81, 0x84, 0x00,
+	0x07, 0x64, 0x00, 0xC8, 0x39, 0x4D, 0x6B, 0x31, 0x84, 0xCF, 0x7B, 0x0C, 0x63, 0x8E, 0x6B, 0x71, 0x8C, 0x9F, 0x00, 0x00, 0x82, 0x00, 0x00, 0x05,
+	0x59, 0xBE, 0x71, 0x8C, 0x0C, 0x63, 0xC8, 0x39, 0x45, 0x29, 0x83, 0x10, 0x81, 0x62, 0x08, 0x02, 0x21, 0x00, 0x01, 0x00, 0x02, 0x00, 0x82, 0x22,
+	0x00, 0x00, 0x42, 0x00, 0x82, 0x63, 0x00, 0x02, 0x84, 0x00, 0x85, 0x00, 0x84, 0x00, 0x83, 0x42, 0x00, 0x84, 0x63, 0x00, 0x85, 0x84, 0x00, 0x07,
+	0x05, 0x19, 0xE5, 0x10, 0x05, 0x19, 0x2D, 0x63, 0x55, 0xAD, 0x1B, 0xDF, 0x58, 0xC6, 0x7A, 0xCE, 0x9F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00,
+	0x00, 0x00, 0x92, 0x8C, 0x10, 0x7C, 0xE8, 0x39, 0x66, 0x29, 0xA3, 0x10, 0x83, 0x10, 0x81, 0x62, 0x08, 0x81, 0x21, 0x00, 0x82, 0x22, 0x00, 0x02,
+	0x42, 0x00, 0x43, 0x00, 0x64, 0x00, 0x81, 0xA5, 0x08, 0x00, 0x84, 0x00, 0x82, 0x63, 0x00, 0x83, 0x42, 0x00, 0x83, 0x63, 0x00, 0x02, 0x83, 0x00,
+	0x64, 0x00, 0x44, 0x00, 0x81, 0x84, 0x00, 0x05, 0x64, 0x00, 0x29, 0x42, 0x2D, 0x63, 0xCF, 0x7B, 0x31, 0x84, 0x51, 0x8C, 0xA2, 0x00, 0x00, 0x81,
+	0x00, 0x00, 0x06, 0x6D, 0x6B, 0xCF, 0x7B, 0x2D, 0x63, 0x66, 0x29, 0xA3, 0x10, 0x83, 0x10, 0x82, 0x08, 0x81, 0x41, 0x08, 0x82, 0x22, 0x00, 0x81,
+	0x42, 0x00, 0x81, 0x63, 0x00, 0x03, 0x64, 0x00, 0xA5, 0x00, 0xA5, 0x08, 0x84, 0x00, 0x81, 0x42, 0x00, 0x85, 0x63, 0x00, 0x00, 0x83, 0x00, 0x81,
+	0x84, 0x00, 0x0A, 0x43, 0x00, 0x49, 0x42, 0xEC, 0x5A, 0xC8, 0x31, 0xE5, 0x10, 0x44, 0x00, 0xE8, 0x39, 0x4D, 0x6B, 0xB6, 0xB5, 0x5D, 0xE7, 0xB9,
+	0xD6, 0xA2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x84, 0x30, 0x84, 0xAE, 0x73, 0xC8, 0x39, 0xC4, 0x18, 0xA3, 0x10, 0x83, 0x10, 0x62, 0x08, 0x82,
+	0x21, 0x00, 0x01, 0x22, 0x00, 0x42, 0x00, 0x82, 0x63, 0x00, 0x02, 0xA5, 0x08, 0xA5, 0x00, 0x84, 0x00, 0x81, 0x63, 0x00, 0x82, 0x42, 0x00, 0x00,
+	0x63, 0x00, 0x81, 0x64, 0x00, 0x82, 0x63, 0x00, 0x0A, 0x64, 0x00, 0x84, 0x00, 0x44, 0x00, 0x8A, 0x4A, 0xCF, 0x7B, 0x6E, 0x6B, 0x0C, 0x63, 0x8A,
+	0x4A, 0xA8, 0x29, 0x8B, 0x4A, 0x2D, 0x63, 0xA4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x60, 0xCE, 0x2C, 0x63, 0xCB, 0x5A, 0xC4, 0x18, 0x83, 0x10, 0x81,
+	0x62, 0x08, 0x83, 0x42, 0x00, 0x01, 0x22, 0x00, 0x42, 0x00, 0x81, 0x84, 0x00, 0x04, 0x83, 0x00, 0x84, 0x00, 0xA5, 0x00, 0x84, 0x00, 0x42, 0x00,
+	0x83, 0x43, 0x00, 0x00, 0x63, 0x00, 0x82, 0x84, 0x00, 0x0C, 0x64, 0x00, 0x66, 0x29, 0x6A, 0x4A, 0x09, 0x3A, 0x85, 0x00, 0x26, 0x21, 0xAB, 0x52,
+	0xB3, 0x94, 0x35, 0xA5, 0xF0, 0x7B, 0x8B, 0x52, 0xAF, 0x73, 0xB2, 0x94, 0xA4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xC6, 0x6D, 0x6B, 0x2C, 0x63,
+	0xA3, 0x10, 0x42, 0x08, 0x81, 0x42, 0x00, 0x83, 0x63, 0x00, 0x05, 0x43, 0x00, 0x21, 0x00, 0x63, 0x00, 0xA5, 0x00, 0x84, 0x00, 0x42, 0x00, 0x81,
+	0x63, 0x00, 0x01, 0x42, 0x00, 0x43, 0x00, 0x84, 0x63, 0x00, 0x81, 0x84, 0x08, 0x08, 0x84, 0x00, 0x67, 0x29, 0x2D, 0x63, 0xCF, 0x7B, 0x4A, 0x42,
+	0x47, 0x21, 0x87, 0x29, 0x0C, 0x5B, 0xD3, 0x94, 0xA8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x8D, 0x9E, 0x6E, 0x73, 0x4D, 0x6B, 0xA3, 0x10, 0x81, 0x62,
+	0x00, 0x05, 0x63, 0x00, 0x84, 0x00, 0x64, 0x00, 0x84, 0x00, 0x84, 0x08, 0x84, 0x00, 0x81, 0x21, 0x00, 0x03, 0x63, 0x00, 0x84, 0x08, 0x42, 0x00,
+	0x63, 0x00, 0x81, 0x62, 0x00, 0x81, 0x63, 0x00, 0x00, 0x64, 0x00, 0x82, 0x63, 0x00, 0x0C, 0x64, 0x00, 0x85, 0x00, 0xA5, 0x08, 0xC5, 0x08, 0x29,
+	0x42, 0x71, 0x8C, 0x8E, 0x6B, 0x8A, 0x4A, 0x8B, 0x52, 0x8F, 0x73, 0x72, 0x8C, 0x00, 0x00, 0xEB, 0x8D, 0xA6, 0x00, 0x00, 0x04, 0x00, 0x00, 0x30,
+	0x96, 0xCF, 0x83, 0xEB, 0x5A, 0xC4, 0x10, 0x81, 0x63, 0x00, 0x03, 0x85, 0x08, 0xA5, 0x08, 0x84, 0x00, 0x64, 0x00, 0x81, 0xA5, 0x08, 0x82, 0x21,
+	0x00, 0x81, 0x42, 0x00, 0x84, 0x63, 0x00, 0x82, 0x84, 0x00, 0x0B, 0x63, 0x00, 0xC7, 0x31, 0x49, 0x42, 0x45, 0x00, 0x85, 0x00, 0x8B, 0x4A, 0x31,
+	0x84, 0x00, 0x00, 0xEF, 0x7B, 0xAF, 0x73, 0x92, 0x94, 0x34, 0xA5, 0xA8, 0x00, 0x00, 0x08, 0x00, 0x00, 0xD2, 0x84, 0x0F, 0x84, 0xEB, 0x5A, 0xE5,
+	0x10, 0x84, 0x08, 0x63, 0x00, 0x85, 0x08, 0xC6, 0x08, 0x81, 0x63, 0x00, 0x81, 0xA5, 0x08, 0x83, 0x21, 0x00, 0x81, 0x42, 0x00, 0x01, 0x63, 0x00,
+	0x64, 0x00, 0x82, 0x63, 0x00, 0x81, 0x84, 0x00, 0x06, 0x44, 0x00, 0x4A, 0x4A, 0xCF, 0x7B, 0xEC, 0x5A, 0x65, 0x00, 0xAB, 0x52, 0x31, 0x84, 0x82,
+	0x00, 0x00, 0x02, 0xFE, 0xFF, 0x3B, 0xE7, 0xA0, 0xBC, 0xA7, 0x00, 0x00, 0x08, 0x00, 0x00, 0xB6, 0xB4, 0xF0, 0x83, 0x08, 0x42, 0xE6, 0x10, 0xA5,
+	0x08, 0x42, 0x00, 0x63, 0x00, 0x84, 0x08, 0x81, 0x42, 0x00, 0x81, 0x63, 0x00, 0x03, 0x21, 0x00, 0x41, 0x00, 0x22, 0x00, 0x41, 0x00, 0x81, 0x42,
+	0x00, 0x00, 0x63, 0x00, 0x84, 0x84, 0x00, 0x07, 0xA5, 0x08, 0x85, 0x00, 0x87, 0x29, 0x6E, 0x6B, 0xF0, 0x7B, 0x27, 0x21, 0x8B, 0x4A, 0xF0, 0x7B,
+	0x81, 0x00, 0x00, 0x00, 0x52, 0x94, 0xAA, 0x00, 0x00, 0x05, 0x00, 0x00, 0x55, 0xB5, 0xB3, 0x94, 0x05, 0x19, 0xC6, 0x08, 0x64, 0x00, 0x8B, 0x42,
+	0x00, 0x02, 0x63, 0x00, 0x62, 0x00, 0x63, 0x00, 0x83, 0x84, 0x00, 0x07, 0x85, 0x00, 0xA5, 0x08, 0x85, 0x00, 0x6A, 0x4A, 0xF0, 0x7B, 0xCC, 0x52,
+	0xD0, 0x7B, 0x92, 0x8C, 0xAD, 0x00, 0x00, 0x09, 0x00, 0x00, 0x30, 0x84, 0xAF, 0x73, 0xA3, 0x10, 0x84, 0x00, 0x63, 0x00, 0x42, 0x00, 0x22, 0x00,
+	0x42, 0x00, 0x43, 0x00, 0x86, 0x42, 0x00, 0x83, 0x63, 0x00, 0x00, 0x84, 0x00, 0x81, 0x84, 0x08, 0x81, 0x84, 0x00, 0x06, 0xA5, 0x08, 0xA6, 0x00,
+	0xA8, 0x31, 0x0D, 0x63, 0x59, 0xCE, 0xD3, 0x94, 0xD3, 0x9C, 0xAD, 0x00, 0x00, 0x03, 0x00, 0x00, 0x8D, 0x73, 0x0C, 0x63, 0xA4, 0x10, 0x81, 0x63,
+	0x00, 0x02, 0xE4, 0x18, 0x29, 0x42, 0x83, 0x08, 0x81, 0x63, 0x00, 0x81, 0x42, 0x00, 0x81, 0x63, 0x00, 0x81, 0x62, 0x00, 0x83, 0x63, 0x00, 0x00,
+	0x84, 0x00, 0x82, 0xA5, 0x08, 0x81, 0xA5, 0x00, 0x03, 0xC6, 0x00, 0x06, 0x11, 0xAB, 0x52, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x08, 0x00, 0x00, 0x30,
+	0x84, 0xCF, 0x7B, 0x05, 0x19, 0x63, 0x00, 0x63, 0x08, 0x66, 0x29, 0x4D, 0x63, 0xC4, 0x10, 0x88, 0x63, 0x00, 0x83, 0x84, 0x00, 0x82, 0xA5, 0x08,
+	0x05, 0x06, 0x19, 0xA8, 0x29, 0x47, 0x21, 0x07, 0x11, 0xAB, 0x52, 0x59, 0xCE, 0xAF, 0x00, 0x00, 0x08, 0x00, 0x00, 0xAE, 0x73, 0x6E, 0x6B, 0x26,
+	0x21, 0x84, 0x00, 0x84, 0x08, 0x86, 0x29, 0x0C, 0x63, 0xA4, 0x10, 0x88, 0x63, 0x00, 0x83, 0x84, 0x00, 0x03, 0xA5, 0x08, 0xC6, 0x08, 0xA6, 0x00,
+	0x88, 0x29, 0x81, 0xEC, 0x5A, 0x02, 0x07, 0x19, 0xAC, 0x52, 0xD7, 0xBD, 0xAF, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2B, 0x63, 0xAB, 0x52, 0x26, 0x19,
+	0x84, 0x08, 0x26, 0x21, 0xCB, 0x5A, 0x29, 0x42, 0x83, 0x08, 0x83, 0x63, 0x00, 0x82, 0x84, 0x08, 0x81, 0x64, 0x00, 0x00, 0x84, 0x08, 0x81, 0xA4,
+	0x08, 0x09, 0x84, 0x08, 0xA5, 0x08, 0xC6, 0x08, 0xA6, 0x00, 0xC8, 0x31, 0x2D, 0x63, 0x6E, 0x6B, 0x8B, 0x4A, 0x4E, 0x6B, 0x99, 0xD6, 0xAF, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x2B, 0x5B, 0x8A, 0x4A, 0x67, 0x21, 0xA4, 0x08, 0x87, 0x29, 0x10, 0x84, 0xAB, 0x52, 0xA4, 0x10, 0x81, 0x84, 0x00, 0x03,
+	0x63, 0x00, 0x43, 0x00, 0x64, 0x00, 0x84, 0x00, 0x81, 0x84, 0x08, 0x81, 0x84, 0x00, 0x84, 0xA5, 0x08, 0x05, 0xA6, 0x00, 0x4A, 0x42, 0xCF, 0x73,
+	0xB3, 0x94, 0xD3, 0x9C, 0x34, 0xA5, 0xB0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x5B, 0xCB, 0x52, 0x88, 0x29, 0xA5, 0x08, 0x26, 0x19, 0x4D, 0x6B,
+	0x8E, 0x73, 0xE5, 0x18, 0x84, 0x08, 0x84, 0x00, 0x05, 0x19, 0x8A, 0x4A, 0xCB, 0x5A, 0xA4, 0x10, 0x83, 0x84, 0x00, 0x0A, 0xA5, 0x08, 0xA6, 0x08,
+	0xA5, 0x08, 0x47, 0x21, 0xE9, 0x31, 0x07, 0x11, 0xE9, 0x39, 0x6E, 0x6B, 0xFE, 0xFF, 0x7B, 0xE7, 0x3C, 0xE7, 0xB0, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0xCF, 0x73, 0x8E, 0x6B, 0xC9, 0x29, 0xA5, 0x08, 0x26, 0x19, 0xCF, 0x7B, 0xD3, 0x94, 0x26, 0x21, 0x84, 0x08, 0x84, 0x00, 0xE5, 0x18, 0x29, 0x42,
+	0xAF, 0x73, 0xCC, 0x5A, 0x82, 0xA5, 0x08, 0x08, 0x85, 0x08, 0xA5, 0x08, 0xC6, 0x08, 0xA6, 0x00, 0xA8, 0x29, 0x0C, 0x5B, 0xCC, 0x5A, 0x2A, 0x42,
+	0x10, 0x84, 0xB3, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x7C, 0xAF, 0x73, 0xA8, 0x29, 0xA5, 0x08, 0x67, 0x29, 0x14, 0xA5, 0x75, 0xAD, 0x66, 0x29,
+	0xA4, 0x08, 0x84, 0x00, 0x66, 0x29, 0x2C, 0x63, 0x18, 0xC6, 0xAF, 0x73, 0x8B, 0x52, 0x83, 0xA5, 0x08, 0x81, 0xC6, 0x08, 0x04, 0x27, 0x19, 0x4A,
+	0x4A, 0x4E, 0x6B, 0xCC, 0x5A, 0xF0, 0x7B, 0xB3, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x13, 0x9D, 0x51, 0x84, 0x88, 0x29, 0xC6, 0x08, 0x26, 0x19, 0xEF,
+	0x7B, 0x30, 0x84, 0x87, 0x29, 0xA5, 0x08, 0x84, 0x00, 0x66, 0x29, 0x0C, 0x63, 0xB6, 0xB5, 0x8D, 0x6B, 0xAB, 0x52, 0x81, 0xA6, 0x08, 0x81, 0xC5,
+	0x08, 0x81, 0xC6, 0x08, 0x04, 0xE6, 0x08, 0x27, 0x19, 0x6D, 0x6B, 0xCF, 0x7B, 0xF4, 0x9C, 0xB3, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x95, 0xAD, 0x92,
+	0x8C, 0x0A, 0x3A, 0xE6, 0x10, 0x06, 0x19, 0x29, 0x42, 0xEC, 0x5A, 0x8B, 0x52, 0xE6, 0x10, 0xA5, 0x08, 0x26, 0x21, 0xAB, 0x52, 0xF3, 0x9C, 0xEF,
+	0x7B, 0x0C, 0x63, 0x81, 0xC6, 0x08, 0x08, 0x47, 0x19, 0xE9, 0x39, 0x47, 0x21, 0xC7, 0x08, 0x07, 0x11, 0x47, 0x21, 0x4B, 0x63, 0xD3, 0x9C, 0xF8,
+	0xC5, 0xB3, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0xC5, 0x31, 0x84, 0xCC, 0x5A, 0x27, 0x19, 0x47, 0x21, 0xEC, 0x52, 0x10, 0x84, 0xAF, 0x73, 0x26,
+	0x19, 0xA5, 0x08, 0x26, 0x19, 0x6A, 0x4A, 0x92, 0x94, 0x71, 0x8C, 0x4D, 0x63, 0x06, 0x19, 0xC6, 0x08, 0x07, 0x19, 0x6A, 0x4A, 0x0D, 0x5B, 0xC7,
+	0x00, 0xC9, 0x31, 0xEC, 0x5A, 0x95, 0xB5, 0xB5, 0x00, 0x00, 0x18, 0x00, 0x00, 0xD6, 0xB4, 0x50, 0x8C, 0x8F, 0x6B, 0x27, 0x19, 0x88, 0x29, 0x8E,
+	0x6B, 0x4C, 0x6B, 0xAB, 0x52, 0x06, 0x11, 0xA5, 0x08, 0x26, 0x19, 0x6A, 0x4A, 0x71, 0x8C, 0x78, 0xCE, 0x51, 0x84, 0x67, 0x29, 0xC6, 0x08, 0x27,
+	0x19, 0x4A, 0x42, 0x6E, 0x6B, 0x4B, 0x42, 0xA9, 0x29, 0xEC, 0x5A, 0xBA, 0xEF, 0xB5, 0x00, 0x00, 0x81, 0x00, 0x00, 0x15, 0x75, 0xAD, 0xB3, 0x94,
+	0x68, 0x29, 0x09, 0x3A, 0x71, 0x8C, 0xF0, 0x7B, 0x4E, 0x6B, 0x27, 0x19, 0xA5, 0x08, 0x06, 0x19, 0x29, 0x42, 0x10, 0x7C, 0xFC, 0xFF, 0xF0, 0x7B,
+	0xEC, 0x5A, 0xE7, 0x08, 0xA8, 0x29, 0x2C, 0x5B, 0xB2, 0x94, 0x8F, 0x73, 0x8B, 0x4A, 0xD0, 0x7B, 0xB6, 0x00, 0x00, 0x81, 0x00, 0x00, 0x16, 0xF3,
+	0x9C, 0xF0, 0x7B, 0x6A, 0x4A, 0xAB, 0x52, 0x96, 0xB5, 0x34, 0xA5, 0x31, 0x84, 0x47, 0x19, 0xC6, 0x08, 0x06, 0x11, 0xC8, 0x31, 0x6E, 0x6B, 0x00,
+	0x00, 0xF0, 0x83, 0x4E, 0x63, 0xE7, 0x08, 0xE9, 0x39, 0x10, 0x84, 0xB6, 0xCD, 0x71, 0x8C, 0xEF, 0x7B, 0xD5, 0x94, 0x8E, 0x6F, 0xB5, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x81, 0x2D, 0x63, 0x13, 0xCC, 0x52, 0x58, 0xC6, 0x74, 0xA5, 0xCF, 0x73, 0x88, 0x29, 0xE7, 0x10, 0xE6, 0x10, 0x87, 0x29, 0xEC,
+	0x5A, 0x80, 0xAC, 0xB7, 0xBD, 0x72, 0x8C, 0x09, 0x3A, 0x2A, 0x3A, 0x13, 0x9D, 0x2A, 0xDE, 0x52, 0xC6, 0xB4, 0xB5, 0x38, 0x94, 0xEA, 0xA4, 0xB5,
+	0x00, 0x00, 0x82, 0x00, 0x00, 0x0D, 0xD3, 0x94, 0x92, 0x8C, 0xEC, 0x5A, 0x13, 0x9D, 0xB9, 0xCE, 0xF3, 0x9C, 0x2A, 0x42, 0x07, 0x11, 0xE6, 0x10,
+	0x67, 0x29, 0xEC, 0x52, 0x4A, 0xCE, 0x9B, 0xCE, 0xF4, 0x9C, 0x81, 0x72, 0x8C, 0x01, 0x34, 0xA5, 0x05, 0x84, 0xB9, 0x00, 0x00, 0x82, 0x00, 0x00,
+	0x11, 0xF5, 0xB5, 0x95, 0xAD, 0x34, 0xAD, 0x12, 0x9D, 0x96, 0xAF, 0xCF, 0x73, 0x8B, 0x4A, 0x27, 0x19, 0xE6, 0x10, 0x87, 0x29, 0xEC, 0x52, 0x2A,
+	0xDE, 0xD9, 0x5D, 0x14, 0x95, 0x55, 0xA5, 0x55, 0x9D, 0x62, 0x18, 0x01, 0x00, 0xB9, 0x00, 0x00, 0x83, 0x00, 0x00, 0x0F, 0xF9, 0xD5, 0xF7, 0xBD,
+	0xB4, 0xB5, 0x15, 0xB6, 0xEF, 0x7B, 0x6E, 0x6B, 0x48, 0x19, 0x07, 0x11, 0xC8, 0x31, 0x4D, 0x6B, 0xC9, 0xDD, 0x00, 0x00, 0xC9, 0x69, 0x2F, 0xC4,
+	0x8D, 0xC4, 0x41, 0x08, 0xBA, 0x00, 0x00, 0x86, 0x00, 0x00, 0x07, 0xF7, 0xF5, 0xAD, 0x6B, 0xCC, 0x52, 0x28, 0x19, 0x47, 0x19, 0x4A, 0x4A, 0x51,
+	0x8C, 0x10, 0xAD, 0xBF, 0x00, 0x00, 0x86, 0x00, 0x00, 0x06, 0x04, 0x60, 0x14, 0xA5, 0x51, 0x8C, 0x48, 0x19, 0x68, 0x21, 0xEC, 0x5A, 0xB6, 0xB5,
+	0xC0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x05, 0x76, 0xB5, 0x51, 0x8C, 0x68, 0x19, 0x28, 0x19, 0x4A, 0x42, 0x72, 0x8C, 0xC0, 0x00, 0x00, 0x87, 0x00,
+	0x00, 0x03, 0xB2, 0x94, 0x4D, 0x63, 0xEA, 0x31, 0x88, 0x29, 0x81, 0x6E, 0x6B, 0xC0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x05, 0x59, 0xCE, 0x51, 0x8C,
+	0xCC, 0x5A, 0xE9, 0x31, 0xF3, 0x9C, 0x14, 0x9D, 0xC0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xF4, 0x9C, 0x4E, 0x6B, 0xAC, 0x52, 0x33,
+	0xA5, 0xC1, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0xCC, 0x52, 0x6A, 0x42, 0x6E, 0x6B, 0xD0, 0x9C, 0xC1, 0x00, 0x00, 0x88, 0x00, 0x00, 0x03, 0xAF,
+	0x73, 0xCF, 0x7B, 0x96, 0xB5, 0x12, 0xBE, 0xC1, 0x00, 0x00,
+};
+
+const CrowOs::Core::Asset res_logo = {"res_logo", 79, 144, CrowOs::Core::ASSET_FORMAT_RLE, NULL, 0, res_logo_data, 8602};
+
+static const uint16_t res_battery_10_palette[7] PROGMEM = {
+	0x07FF, 0x0000, 0x45F7, 0xF800, 0xC986, 0x2EBA, 0x177D,
+};
+
+static const uint8_t res_battery_10_data[80] PROGMEM = {
+	0x8E, 0x00, 0x00, 0x01, 0x03, 0x00, 0x06, 0x02, 0x05, 0x8A, 0x00, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x04, 0x87, 0x01, 0x83, 0x00, 0x03, 0x00,
+	0x02, 0x03, 0x04, 0x87, 0x01, 0x83, 0x00, 0x03, 0x00, 0x02, 0x03, 0x04, 0x87, 0x01, 0x83, 0x00, 0x03, 0x00, 0x02, 0x03, 0x04, 0x87, 0x01, 0x83,
+	0x00, 0x03, 0x00, 0x02, 0x03, 0x04, 0x87, 0x01, 0x83, 0x00, 0x03, 0x00, 0x02, 0x03, 0x04, 0x87, 0x01, 0x83, 0x00, 0x03, 0x00, 0x06, 0x02, 0x05,
+	0x8A, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x01,
+};
+
+const CrowOs::Core::Asset res_battery_10 = {"res_battery_10", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_battery_10_palette, 7, res_battery_10_data, 94};
+
+static const uint16_t res_battery_35_palette[10] PROGMEM = {
+	0x07FF, 0x0000, 0xFBE0, 0xFC00, 0x46D7, 0x56B5, 0x4ED6, 0x46F7, 0x1F9C, 0x17BD,
+};
+
+static const uint8_t res_battery_35_data[96] PROGMEM = {
+	0x8E, 0x00, 0x00, 0x01, 0x05, 0x00, 0x09, 0x07, 0x06, 0x05, 0x08, 0x88, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x82, 0x02, 0x00, 0x03, 0x85, 0x01,
+	0x83, 0x00, 0x01, 0x00, 0x04, 0x82, 0x02, 0x00, 0x03, 0x85, 0x01, 0x83, 0x00, 0x01, 0x00, 0x04, 0x82, 0x02, 0x00, 0x03, 0x85, 0x01, 0x83, 0x00,
+	0x01, 0x00, 0x04, 0x82, 0x02, 0x00, 0x03, 0x85, 0x01, 0x83, 0x00, 0x01, 0x00, 0x04, 0x82, 0x02, 0x00, 0x03, 0x85, 0x01, 0x83, 0x00, 0x01, 0x00,
+	0x04, 0x82, 0x02, 0x00, 0x03, 0x85, 0x01, 0x83, 0x00, 0x05, 0x00, 0x09, 0x07, 0x06, 0x05, 0x08, 0x88, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x01,
+};
+
+const CrowOs::Core::Asset res_battery_35 = {"res_battery_35", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_battery_35_palette, 10, res_battery_35_data, 116};
+
+static const uint16_t res_battery_50_palette[9] PROGMEM = {
+	0x07FF, 0xF7E0, 0x0000, 0x47F7, 0x4FF5, 0x4FF6, 0x3FF7, 0x0FFD, 0x0FFE,
+};
+
+static const uint8_t res_battery_50_data[88] PROGMEM = {
+	0x8E, 0x00, 0x00, 0x02, 0x03, 0x00, 0x07, 0x06, 0x05, 0x82, 0x04, 0x00, 0x08, 0x86, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x85, 0x01, 0x83, 0x02,
+	0x83, 0x00, 0x01, 0x00, 0x03, 0x85, 0x01, 0x83, 0x02, 0x83, 0x00, 0x01, 0x00, 0x03, 0x85, 0x01, 0x83, 0x02, 0x83, 0x00, 0x01, 0x00, 0x03, 0x85,
+	0x01, 0x83, 0x02, 0x83, 0x00, 0x01, 0x00, 0x03, 0x85, 0x01, 0x83, 0x02, 0x83, 0x00, 0x01, 0x00, 0x03, 0x85, 0x01, 0x83, 0x02, 0x83, 0x00, 0x03,
+	0x00, 0x07, 0x06, 0x05, 0x82, 0x04, 0x00, 0x08, 0x86, 0x00, 0x00, 0x02, 0x8E, 0x00, 0x00, 0x02,
+};
+
+const CrowOs::Core::Asset res_battery_50 = {"res_battery_50", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_battery_50_palette, 9, res_battery_50_data, 106};
+
+static const uint16_t res_battery_65_palette[7] PROGMEM = {
+	0x07FF, 0x97E0, 0x0000, 0x2FF5, 0x27F7, 0x2FF6, 0x0FFD,
+};
+
+static const uint8_t res_battery_65_data[88] PROGMEM = {
+	0x8E, 0x00, 0x00, 0x02, 0x03, 0x00, 0x06, 0x04, 0x05, 0x83, 0x03, 0x00, 0x05, 0x85, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x86, 0x01, 0x82, 0x02,
+	0x83, 0x00, 0x01, 0x00, 0x04, 0x86, 0x01, 0x82, 0x02, 0x83, 0x00, 0x01, 0x00, 0x04, 0x86, 0x01, 0x82, 0x02, 0x83, 0x00, 0x01, 0x00, 0x04, 0x86,
+	0x01, 0x82, 0x02, 0x83, 0x00, 0x01, 0x00, 0x04, 0x86, 0x01, 0x82, 0x02, 0x83, 0x00, 0x01, 0x00, 0x04, 0x86, 0x01, 0x82, 0x02, 0x83, 0x00, 0x03,
+	0x00, 0x06, 0x04, 0x05, 0x83, 0x03, 0x00, 0x05, 0x85, 0x00, 0x00, 0x02, 0x8E, 0x00, 0x00, 0x02,
+};
+
+const CrowOs::Core::Asset res_battery_65 = {"res_battery_65", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_battery_65_palette, 7, res_battery_65_data, 102};
+
+static const uint16_t res_battery_80_palette[6] PROGMEM = {
+	0x07FF, 0x07F7, 0x07FD, 0x0000, 0x07F8, 0x07FE,
+};
+
+static const uint8_t res_battery_80_data[90] PROGMEM = {
+	0x8E, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x87, 0x02, 0x00, 0x05, 0x83, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02, 0x87, 0x01, 0x01, 0x04, 0x03, 0x83,
+	0x00, 0x01, 0x00, 0x02, 0x87, 0x01, 0x01, 0x04, 0x03, 0x83, 0x00, 0x01, 0x00, 0x02, 0x87, 0x01, 0x01, 0x04, 0x03, 0x83, 0x00, 0x01, 0x00, 0x02,
+	0x87, 0x01, 0x01, 0x04, 0x03, 0x83, 0x00, 0x01, 0x00, 0x02, 0x87, 0x01, 0x01, 0x04, 0x03, 0x83, 0x00, 0x01, 0x00, 0x02, 0x87, 0x01, 0x01, 0x04,
+	0x03, 0x83, 0x00, 0x01, 0x00, 0x00, 0x87, 0x02, 0x00, 0x05, 0x83, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x03,
+};
+
+const CrowOs::Core::Asset res_battery_80 = {"res_battery_80", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_battery_80_palette, 6, res_battery_80_data, 102};
+
+static const uint16_t res_battery_100_palette[2] PROGMEM = {
+	0x07FF, 0x0000,
+};
+
+static const uint8_t res_battery_100_data[28] PROGMEM = {
+	0x8E, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8E, 0x00, 0x00, 0x01,
+	0x8E, 0x00, 0x00, 0x01,
+};
+
+const CrowOs::Core::Asset res_battery_100 = {"res_battery_100", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_battery_100_palette, 2, res_battery_100_data, 32};
+
+static const uint16_t res_wifi_connected_palette[55] PROGMEM = {
+	0x0000, 0x075F, 0x0800, 0x02CC, 0x071D, 0x03B0, 0x05D8, 0x0801, 0x0081, 0x0493, 0x069D, 0x0821, 0x071E, 0x067D, 0x0125, 0x09A7,
+	0x0539, 0x01C8, 0x0453, 0x04D3, 0x0269, 0x0987, 0x028D, 0x038F, 0x0390, 0x061A, 0x079F, 0x0F1F, 0x01A7, 0x0A2A, 0x022A, 0x0AAD,
+	0x02AE, 0x03AF, 0x06FF, 0x0DB8, 0x073D, 0x00C1, 0x0145, 0x0147, 0x0249, 0x034E, 0x06DE, 0x00E1, 0x0062, 0x0166, 0x0167, 0x026A,
+	0x026D, 0x036E, 0x05F9, 0x0DFC, 0x15FD, 0x06FE, 0x077F,
+};
+
+static const uint8_t res_wifi_connected_data[145] PROGMEM = {
+	0x0F, 0x00, 0x0B, 0x00, 0x2E, 0x31, 0x09, 0x10, 0x06, 0x06, 0x10, 0x09, 0x29, 0x27, 0x00, 0x0B, 0x00, 0x0F, 0x2B, 0x17, 0x0A, 0x1A, 0x04, 0x01,
+	0x33, 0x32, 0x19, 0x34, 0x01, 0x04, 0x36, 0x0A, 0x21, 0x25, 0x0F, 0x1F, 0x35, 0x0D, 0x18, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x0F, 0x05,
+	0x0D, 0x2A, 0x20, 0x0F, 0x00, 0x15, 0x00, 0x02, 0x00, 0x14, 0x05, 0x12, 0x12, 0x05, 0x14, 0x2C, 0x02, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x00, 0x08,
+	0x13, 0x22, 0x83, 0x01, 0x03, 0x1B, 0x01, 0x01, 0x13, 0x82, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x03, 0x06, 0x03, 0x0E, 0x08, 0x00, 0x26, 0x03, 0x23,
+	0x03, 0x00, 0x00, 0x02, 0x84, 0x00, 0x04, 0x02, 0x2D, 0x1D, 0x1E, 0x0E, 0x85, 0x00, 0x82, 0x00, 0x09, 0x02, 0x00, 0x11, 0x0C, 0x01, 0x01, 0x0C,
+	0x11, 0x00, 0x02, 0x82, 0x00, 0x83, 0x00, 0x07, 0x02, 0x00, 0x28, 0x04, 0x24, 0x2F, 0x00, 0x02, 0x83, 0x00, 0x86, 0x00, 0x01, 0x16, 0x30, 0x86,
+	0x00,
+};
+
+const CrowOs::Core::Asset res_wifi_connected = {"res_wifi_connected", 16, 10, CrowOs::Core::ASSET_FORMAT_PALETTE, res_wifi_connected_palette, 55, res_wifi_connected_data, 255};
+
+static const uint8_t res_wifi_disconnected_data[277] PROGMEM = {
+	0x0D, 0x2D, 0x03, 0xAF, 0x0B, 0x00, 0x00, 0x05, 0x01, 0x2E, 0x03, 0x94, 0x04, 0x78, 0x05, 0xDA, 0x05, 0xFA, 0x05, 0xB9, 0x05, 0x16, 0x05, 0x12,
+	0x04, 0x8C, 0x02, 0xE5, 0x00, 0x81, 0x00, 0x00, 0x0F, 0x09, 0x02, 0xD8, 0x5D, 0xD4, 0x4C, 0x46, 0x01, 0xED, 0x02, 0x1A, 0x46, 0xFA, 0x35, 0x98,
+	0x25, 0x78, 0x1D, 0xB8, 0x1D, 0x3A, 0x36, 0x5B, 0x46, 0x5B, 0x56, 0x98, 0x55, 0x6E, 0x2B, 0x00, 0x00, 0x05, 0x4A, 0x02, 0xD8, 0x5D, 0xB8, 0x55,
+	0xB8, 0x4D, 0x6B, 0x02, 0x05, 0x01, 0x81, 0xA3, 0x00, 0x00, 0xC4, 0x00, 0x81, 0x00, 0x00, 0x04, 0xA7, 0x01, 0x2E, 0x13, 0x56, 0x55, 0xD8, 0x6D,
+	0x00, 0x00, 0x0F, 0x00, 0x00, 0x67, 0x01, 0x26, 0x01, 0x8B, 0x02, 0x19, 0x4E, 0xD0, 0x13, 0x00, 0x00, 0x87, 0x01, 0x8F, 0x33, 0x2D, 0x23, 0x6A,
+	0x0A, 0x25, 0x01, 0xA3, 0x00, 0xC4, 0x00, 0x87, 0x01, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0A, 0xB0, 0x1B, 0x19, 0x36, 0x7B, 0x36, 0x36, 0x2D, 0x67,
+	0x01, 0xAB, 0x02, 0xB8, 0x55, 0x5A, 0x4E, 0x1A, 0x46, 0x52, 0x34, 0xC4, 0x00, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0A, 0x29, 0x02, 0x76, 0x3D,
+	0x8F, 0x03, 0x52, 0x04, 0x1A, 0x36, 0x8C, 0x02, 0xC8, 0x01, 0x0E, 0x03, 0x16, 0x2D, 0xEC, 0x12, 0x62, 0x00, 0x81, 0x00, 0x00, 0x83, 0x00, 0x00,
+	0x07, 0x62, 0x00, 0xC4, 0x00, 0xC9, 0x01, 0xD5, 0x04, 0x9C, 0x2E, 0x12, 0x04, 0x26, 0x01, 0xA3, 0x00, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x06,
+	0x46, 0x01, 0xF9, 0x55, 0x7B, 0x3E, 0x9C, 0x2E, 0x9B, 0x3E, 0xB4, 0x3C, 0x05, 0x01, 0x83, 0x00, 0x00, 0x85, 0x00, 0x00, 0x06, 0x4A, 0x02, 0xF9,
+	0x4D, 0x3A, 0x46, 0x8F, 0x03, 0xD1, 0x1B, 0x97, 0x65, 0x08, 0x0A, 0x82, 0x00, 0x00, 0x85, 0x00, 0x00, 0x07, 0xA3, 0x00, 0x8B, 0x02, 0x2D, 0x03,
+	0x05, 0x01, 0xE6, 0x00, 0x4A, 0x02, 0x8F, 0x33, 0x82, 0x00, 0x81, 0x00, 0x00,
+};
+
+const CrowOs::Core::Asset res_wifi_disconnected = {"res_wifi_disconnected", 16, 10, CrowOs::Core::ASSET_FORMAT_RLE, NULL, 0, res_wifi_disconnected_data, 277};
+
+static const uint8_t res_wifi_connecting_data[256] PROGMEM = {
+	0x82, 0x00, 0x00, 0x0A, 0x08, 0x02, 0x6E, 0x03, 0x72, 0x04, 0x37, 0x05, 0xD9, 0x05, 0x99, 0x05, 0x36, 0x05, 0x33, 0x04, 0x6F, 0x03, 0xC7, 0x01,
+	0x02, 0x08, 0x81, 0x00, 0x00, 0x0A, 0x66, 0x11, 0x73, 0x04, 0x5F, 0x07, 0x9F, 0x0E, 0xFF, 0x06, 0xB9, 0x05, 0xD8, 0x04, 0x32, 0x0C, 0x93, 0x04,
+	0x15, 0x05, 0xFB, 0x0D, 0x81, 0x1E, 0x07, 0x02, 0xDD, 0x06, 0x52, 0x04, 0x44, 0x01, 0x04, 0x47, 0x01, 0x3B, 0x06, 0x32, 0x04, 0xA6, 0x01, 0x41,
+	0x08, 0x85, 0x00, 0x00, 0x04, 0x22, 0x08, 0x28, 0x0A, 0xB6, 0x04, 0x99, 0x05, 0xC2, 0x08, 0x82, 0x00, 0x00, 0x09, 0x05, 0x01, 0x8E, 0x03, 0x97,
+	0x05, 0x9E, 0x06, 0xFD, 0x06, 0xBE, 0x06, 0x7D, 0x0E, 0x37, 0x05, 0x6E, 0x03, 0xA3, 0x00, 0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0x09, 0x79, 0x05,
+	0x5F, 0x07, 0x77, 0x05, 0x12, 0x04, 0x2E, 0x0B, 0x30, 0x03, 0x12, 0x04, 0xBB, 0x05, 0x1F, 0x0F, 0x71, 0x04, 0x82, 0x00, 0x00, 0x86, 0x00, 0x00,
+	0x01, 0x04, 0x01, 0xC1, 0x00, 0x81, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x81, 0x00, 0x00, 0x83, 0x00, 0x00, 0x02, 0x00, 0x08,
+	0x08, 0x02, 0xBE, 0x0E, 0x81, 0x5F, 0x07, 0x06, 0x00, 0x00, 0x25, 0x01, 0x36, 0x05, 0x58, 0x05, 0xDB, 0x05, 0x9D, 0x06, 0x09, 0x02, 0x85, 0x00,
+	0x00, 0x09, 0xCC, 0x02, 0x5F, 0x07, 0x16, 0x05, 0x60, 0x00, 0x02, 0x08, 0x6C, 0x02, 0x88, 0x02, 0x0D, 0x03, 0x0F, 0x03, 0x00, 0x00, 0x86, 0x00,
+	0x00, 0x08, 0xA6, 0x11, 0x45, 0x01, 0x00, 0x00, 0x0D, 0x03, 0x5F, 0x07, 0x5B, 0x06, 0x9A, 0x06, 0x59, 0x06, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x85, 0x00, 0x00, 0x01, 0xAD, 0x02, 0x66, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x10,
+};
+
+const CrowOs::Core::Asset res_wifi_connecting = {"res_wifi_connecting", 16, 10, CrowOs::Core::ASSET_FORMAT_RLE, NULL, 0, res_wifi_connecting_data, 256};
+
+static const uint8_t res_wifi_connfiguring_data[261] PROGMEM = {
+	0x81, 0x00, 0x00, 0x0A, 0xA1, 0x00, 0xAA, 0x02, 0xB3, 0x03, 0x16, 0x0D, 0x96, 0x05, 0xB9, 0x05, 0xDA, 0x05, 0xF6, 0x04, 0x31, 0x04, 0xEC, 0x02,
+	0xC3, 0x00, 0x82, 0x00, 0x00, 0x01, 0xEA, 0x01, 0x37, 0x05, 0x81, 0xFF, 0x06, 0x0B, 0x3C, 0x0E, 0x75, 0x05, 0x53, 0x04, 0x33, 0x04, 0xF2, 0x03,
+	0xF6, 0x04, 0x1B, 0x0E, 0x5F, 0x07, 0xFF, 0x06, 0xD9, 0x05, 0xAA, 0x02, 0x00, 0x00, 0x03, 0x26, 0x01, 0x98, 0x0D, 0xAE, 0x03, 0x63, 0x01, 0x84,
+	0x00, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x82, 0x00, 0xCC, 0x02, 0x98, 0x05, 0x2B, 0x02, 0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0xE9, 0x01, 0xB5,
+	0x0C, 0x7C, 0x06, 0xFF, 0x06, 0x81, 0x5F, 0x07, 0x04, 0x9B, 0x06, 0x37, 0x05, 0xCC, 0x02, 0x80, 0x00, 0x00, 0x00, 0x81, 0x00, 0x08, 0x06, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x0D, 0xDC, 0x06, 0x52, 0x04, 0xCD, 0x02, 0x81, 0xAB, 0x02, 0x03, 0xB2, 0x03, 0x12, 0x04, 0xED, 0x0A, 0xA3,
+	0x00, 0x82, 0x00, 0x00, 0x85, 0x00, 0x00, 0x09, 0x46, 0x01, 0x08, 0x02, 0xC3, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2A, 0x02, 0x94, 0x04, 0xC6, 0x01,
+	0x00, 0x08, 0x00, 0x00, 0x81, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x2E, 0x0B, 0x5F, 0x07, 0x3B, 0x06, 0x00, 0x00, 0xCE, 0x03, 0x5A, 0x06, 0xBF,
+	0x0E, 0x81, 0xBE, 0x06, 0x01, 0x9C, 0x06, 0xED, 0x02, 0x85, 0x00, 0x00, 0x09, 0x0E, 0x0B, 0xD5, 0x04, 0x00, 0x00, 0x25, 0x01, 0x5F, 0x07, 0xD2,
+	0x03, 0x00, 0x00, 0x16, 0x05, 0x1E, 0x07, 0x00, 0x00, 0x86, 0x00, 0x00, 0x08, 0xA2, 0x08, 0x00, 0x00, 0xF2, 0x03, 0xFF, 0x06, 0x1E, 0x0F, 0x1C,
+	0x06, 0x1E, 0x07, 0x5F, 0x07, 0x0E, 0x03, 0x8A, 0x00, 0x00, 0x01, 0x0F, 0x03, 0xB8, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x08,
+};
+
+const CrowOs::Core::Asset res_wifi_connfiguring = {"res_wifi_connfiguring", 16, 10, CrowOs::Core::ASSET_FORMAT_RLE, NULL, 0, res_wifi_connfiguring_data, 261};
+
+static const uint8_t res_wifi_error_data[271] PROGMEM = {
+	0x82, 0x00, 0x00, 0x0C, 0x27, 0x09, 0x2C, 0x03, 0x52, 0x04, 0x3A, 0x0D, 0xD9, 0x05, 0xB9, 0x0D, 0x77, 0x05, 0xB5, 0x04, 0x2F, 0x04, 0x0A, 0x0A,
+	0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x02, 0xC1, 0x00, 0x6F, 0x03, 0x9C, 0x0E, 0x82, 0x5F, 0x07, 0x09, 0x3C, 0x0E, 0xF9, 0x05, 0x99, 0x05, 0x3C,
+	0x0E, 0xBF, 0x06, 0x5F, 0x07, 0xFA, 0x05, 0xC8, 0x09, 0x00, 0x00, 0x01, 0x08, 0x04, 0x6C, 0x02, 0x5F, 0x07, 0x9C, 0x06, 0xF2, 0x03, 0xE9, 0x01,
+	0x85, 0x00, 0x00, 0x04, 0x05, 0x01, 0xE9, 0x19, 0x00, 0x00, 0x2E, 0x03, 0xB0, 0x03, 0x0A, 0x00, 0x00, 0x66, 0x01, 0x21, 0x08, 0x00, 0x00, 0x21,
+	0x08, 0xC7, 0x01, 0x90, 0x03, 0xD1, 0x03, 0x32, 0x04, 0x6F, 0x03, 0xEC, 0x0A, 0x82, 0x00, 0x00, 0x01, 0x36, 0x05, 0xD9, 0x05, 0x82, 0x00, 0x00,
+	0x03, 0x32, 0x04, 0xDE, 0x06, 0x5F, 0x07, 0xFF, 0x16, 0x83, 0x5F, 0x07, 0x04, 0x1F, 0x0F, 0x35, 0x05, 0x00, 0x00, 0xF5, 0x04, 0x78, 0x05, 0x82,
+	0x00, 0x00, 0x0C, 0xE8, 0x01, 0x39, 0x06, 0x8E, 0x03, 0x66, 0x01, 0xE3, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x08, 0x02, 0xB4, 0x04, 0x94, 0x04, 0x01,
+	0x08, 0xEC, 0x02, 0xEE, 0x02, 0x01, 0x00, 0x00, 0x01, 0x10, 0x81, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0xA3, 0x00, 0x29, 0x02, 0x6C, 0x02,
+	0xC7, 0x01, 0x60, 0x00, 0x82, 0x00, 0x00, 0x01, 0xE7, 0x01, 0x6B, 0x02, 0x84, 0x00, 0x00, 0x01, 0x63, 0x08, 0xBC, 0x06, 0x82, 0x5F, 0x07, 0x00,
+	0x34, 0x04, 0x82, 0x00, 0x00, 0x01, 0xCD, 0x03, 0x90, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x04, 0x00, 0x08, 0x66, 0x01, 0x99,
+	0x06, 0x5F, 0x07, 0x33, 0x0D, 0x81, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x84, 0x00, 0x00, 0x03, 0x20, 0x08, 0x00, 0x00,
+	0x49, 0x01, 0xD3, 0x03, 0x86, 0x00, 0x00,
+};
+
+const CrowOs::Core::Asset res_wifi_error = {"res_wifi_error", 16, 10, CrowOs::Core::ASSET_FORMAT_RLE, NULL, 0, res_wifi_error_data, 271};
+
+static const uint16_t rotate_left_palette[19] PROGMEM = {
+	0x0000, 0x24BE, 0x1CBE, 0x249F, 0x041F, 0x24DE, 0x249E, 0x1CDF, 0x2D5F, 0x055F, 0x249D, 0x1C9E, 0x247D, 0x441F, 0x07FF, 0x145D,
+	0x1CDE, 0x1CFE, 0x1C7F,
+};
+
+static const uint8_t rotate_left_data[353] PROGMEM = {
+	0x9F, 0x00, 0x9F, 0x00, 0x8C, 0x00, 0x05, 0x02, 0x01, 0x01, 0x02, 0x06, 0x02, 0x8C, 0x00, 0x89, 0x00, 0x00, 0x02, 0x89, 0x01, 0x00, 0x02, 0x89,
+	0x00, 0x83, 0x00, 0x03, 0x02, 0x01, 0x00, 0x00, 0x8E, 0x01, 0x00, 0x06, 0x87, 0x00, 0x83, 0x00, 0x82, 0x01, 0x00, 0x02, 0x90, 0x01, 0x86, 0x00,
+	0x83, 0x00, 0x87, 0x01, 0x00, 0x0D, 0x85, 0x00, 0x00, 0x08, 0x85, 0x01, 0x85, 0x00, 0x83, 0x00, 0x85, 0x01, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03,
+	0x84, 0x01, 0x84, 0x00, 0x83, 0x00, 0x85, 0x01, 0x8C, 0x00, 0x83, 0x01, 0x00, 0x05, 0x83, 0x00, 0x83, 0x00, 0x86, 0x01, 0x8C, 0x00, 0x83, 0x01,
+	0x83, 0x00, 0x83, 0x00, 0x86, 0x01, 0x00, 0x0A, 0x8B, 0x00, 0x00, 0x03, 0x82, 0x01, 0x00, 0x0B, 0x82, 0x00, 0x98, 0x00, 0x83, 0x01, 0x82, 0x00,
+	0x98, 0x00, 0x00, 0x03, 0x82, 0x01, 0x82, 0x00, 0x99, 0x00, 0x82, 0x01, 0x02, 0x11, 0x00, 0x00, 0x99, 0x00, 0x83, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x82, 0x01, 0x00, 0x02, 0x93, 0x00, 0x83, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x83, 0x01, 0x93, 0x00, 0x83, 0x01, 0x01, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x07, 0x0A, 0x97, 0x00, 0x03, 0x07, 0x08, 0x00, 0x00, 0x9F, 0x00, 0x82, 0x00, 0x03, 0x08, 0x05, 0x01, 0x03, 0x91, 0x00,
+	0x01, 0x09, 0x04, 0x84, 0x00, 0x82, 0x00, 0x83, 0x01, 0x91, 0x00, 0x83, 0x01, 0x82, 0x00, 0x82, 0x00, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x90, 0x00,
+	0x00, 0x07, 0x82, 0x01, 0x00, 0x05, 0x82, 0x00, 0x83, 0x00, 0x03, 0x04, 0x00, 0x00, 0x09, 0x8F, 0x00, 0x83, 0x01, 0x83, 0x00, 0x85, 0x00, 0x02,
+	0x02, 0x01, 0x01, 0x8F, 0x00, 0x02, 0x01, 0x01, 0x02, 0x83, 0x00, 0x84, 0x00, 0x00, 0x03, 0x82, 0x01, 0x00, 0x0E, 0x8A, 0x00, 0x01, 0x12, 0x10,
+	0x82, 0x00, 0x00, 0x04, 0x84, 0x00, 0x85, 0x00, 0x06, 0x01, 0x01, 0x0F, 0x00, 0x00, 0x01, 0x03, 0x85, 0x00, 0x00, 0x09, 0x83, 0x01, 0x87, 0x00,
+	0x86, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x05, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x05, 0x00, 0x04, 0x83, 0x01, 0x87, 0x00, 0x89, 0x00, 0x82, 0x01,
+	0x01, 0x00, 0x00, 0x82, 0x01, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x0C, 0x87, 0x00, 0x89, 0x00, 0x04, 0x01, 0x01, 0x0C, 0x00, 0x00, 0x82, 0x01,
+	0x03, 0x00, 0x00, 0x06, 0x01, 0x89, 0x00, 0x8E, 0x00, 0x82, 0x01, 0x8D, 0x00, 0x9F, 0x00, 0x9F, 0x00,
+};
+
+const CrowOs::Core::Asset rotate_left = {"rotate_left", 32, 32, CrowOs::Core::ASSET_FORMAT_PALETTE, rotate_left_palette, 19, rotate_left_data, 391};
+
+static const uint16_t rotate_right_palette[20] PROGMEM = {
+	0x0000, 0x24BE, 0x1CBE, 0x24DE, 0x1CDE, 0x2D5F, 0x041F, 0x249E, 0x249F, 0x055F, 0x249D, 0x1CDF, 0x1C7F, 0x1C9E, 0x441F, 0x07FF,
+	0x145D, 0x24DD, 0x34DF, 0x247D,
+};
+
+static const uint8_t rotate_right_data[362] PROGMEM = {
+	0x9F, 0x00, 0x9F, 0x00, 0x8C, 0x00, 0x05, 0x02, 0x07, 0x03, 0x01, 0x01, 0x02, 0x8C, 0x00, 0x89, 0x00, 0x00, 0x02, 0x89, 0x01, 0x00, 0x0D, 0x89,
+	0x00, 0x87, 0x00, 0x00, 0x07, 0x8D, 0x01, 0x04, 0x03, 0x00, 0x00, 0x04, 0x01, 0x83, 0x00, 0x86, 0x00, 0x00, 0x04, 0x90, 0x01, 0x02, 0x04, 0x01,
+	0x01, 0x83, 0x00, 0x85, 0x00, 0x85, 0x01, 0x00, 0x05, 0x85, 0x00, 0x00, 0x0E, 0x87, 0x01, 0x83, 0x00, 0x84, 0x00, 0x00, 0x04, 0x83, 0x01, 0x00,
+	0x05, 0x89, 0x00, 0x00, 0x08, 0x85, 0x01, 0x83, 0x00, 0x83, 0x00, 0x00, 0x07, 0x83, 0x01, 0x8C, 0x00, 0x00, 0x04, 0x84, 0x01, 0x83, 0x00, 0x83,
+	0x00, 0x83, 0x01, 0x8C, 0x00, 0x00, 0x04, 0x85, 0x01, 0x83, 0x00, 0x82, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x05, 0x8B, 0x00, 0x00, 0x0A, 0x86,
+	0x01, 0x83, 0x00, 0x82, 0x00, 0x83, 0x01, 0x98, 0x00, 0x82, 0x00, 0x82, 0x01, 0x00, 0x05, 0x98, 0x00, 0x02, 0x00, 0x00, 0x02, 0x82, 0x01, 0x99,
+	0x00, 0x01, 0x00, 0x00, 0x83, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x83, 0x01, 0x93, 0x00, 0x00, 0x02, 0x82, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x83, 0x01, 0x93, 0x00, 0x83, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x0B, 0x97, 0x00, 0x03, 0x0A, 0x0B, 0x00, 0x00, 0x9F, 0x00,
+	0x84, 0x00, 0x01, 0x06, 0x09, 0x91, 0x00, 0x03, 0x08, 0x01, 0x03, 0x05, 0x82, 0x00, 0x82, 0x00, 0x83, 0x01, 0x91, 0x00, 0x83, 0x01, 0x82, 0x00,
+	0x82, 0x00, 0x00, 0x03, 0x82, 0x01, 0x00, 0x0C, 0x90, 0x00, 0x03, 0x12, 0x01, 0x01, 0x07, 0x82, 0x00, 0x83, 0x00, 0x83, 0x01, 0x8F, 0x00, 0x03,
+	0x09, 0x00, 0x00, 0x06, 0x83, 0x00, 0x83, 0x00, 0x02, 0x11, 0x01, 0x02, 0x8F, 0x00, 0x02, 0x01, 0x01, 0x03, 0x85, 0x00, 0x84, 0x00, 0x00, 0x06,
+	0x82, 0x00, 0x01, 0x04, 0x0C, 0x8A, 0x00, 0x00, 0x0F, 0x82, 0x01, 0x00, 0x08, 0x84, 0x00, 0x87, 0x00, 0x83, 0x01, 0x00, 0x09, 0x85, 0x00, 0x06,
+	0x08, 0x01, 0x00, 0x00, 0x10, 0x01, 0x01, 0x85, 0x00, 0x87, 0x00, 0x83, 0x01, 0x0C, 0x06, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03,
+	0x00, 0x00, 0x06, 0x86, 0x00, 0x87, 0x00, 0x00, 0x02, 0x82, 0x01, 0x01, 0x00, 0x00, 0x82, 0x01, 0x01, 0x00, 0x00, 0x82, 0x01, 0x89, 0x00, 0x89,
+	0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x82, 0x01, 0x04, 0x00, 0x00, 0x13, 0x01, 0x01, 0x89, 0x00, 0x8D, 0x00, 0x82, 0x01, 0x8E, 0x00, 0x9F, 0x00,
+	0x9F, 0x00,
+};
+
+const CrowOs::Core::Asset rotate_right = {"rotate_right", 32, 32, CrowOs::Core::ASSET_FORMAT_PALETTE, rotate_right_palette, 20, rotate_right_data, 402};
+
+static const uint16_t thumbs_up_palette[44] PROGMEM = {
+	0xA5E3, 0x0000, 0xFE11, 0x5A89, 0xA603, 0x9DE3, 0x9E03, 0x8485, 0x9DE2, 0xC608, 0xA5C2, 0xEE0F, 0xFE10, 0xBE07, 0xEE0E, 0xF60F,
+	0xD56E, 0xB606, 0xDE0C, 0x84A5, 0xD56D, 0xA602, 0xCE0A, 0xE60D, 0xBE06, 0x9E22, 0x9DC3, 0xAE04, 0xCE09, 0xB605, 0xD60B, 0xA5A2,
+	0x9584, 0xA5C4, 0xC607, 0xAE05, 0xA5E2, 0xADE4, 0xB5E6, 0xADE5, 0xBD69, 0xB5E5, 0xADE2, 0x9D83,
+};
+
+static const uint8_t thumbs_up_data[467] PROGMEM = {
+	0x8B, 0x01, 0x07, 0x1A, 0x05, 0x05, 0x00, 0x00, 0x05, 0x05, 0x15, 0x8B, 0x01, 0x88, 0x01, 0x00, 0x08, 0x8A, 0x00, 0x01, 0x06, 0x0A, 0x88, 0x01,
+	0x86, 0x01, 0x02, 0x0A, 0x00, 0x04, 0x8C, 0x00, 0x01, 0x05, 0x1F, 0x86, 0x01, 0x85, 0x01, 0x01, 0x24, 0x04, 0x91, 0x00, 0x85, 0x01, 0x84, 0x01,
+	0x8C, 0x00, 0x01, 0x09, 0x1B, 0x86, 0x00, 0x84, 0x01, 0x83, 0x01, 0x00, 0x06, 0x8B, 0x00, 0x03, 0x11, 0x02, 0x0F, 0x04, 0x85, 0x00, 0x00, 0x05,
+	0x83, 0x01, 0x82, 0x01, 0x01, 0x00, 0x04, 0x8B, 0x00, 0x03, 0x0D, 0x02, 0x02, 0x09, 0x87, 0x00, 0x82, 0x01, 0x03, 0x01, 0x01, 0x19, 0x04, 0x8C,
+	0x00, 0x03, 0x16, 0x02, 0x02, 0x1C, 0x87, 0x00, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x8D, 0x00, 0x03, 0x0B, 0x02, 0x02, 0x11, 0x87,
+	0x00, 0x02, 0x06, 0x01, 0x01, 0x01, 0x01, 0x08, 0x8C, 0x00, 0x04, 0x04, 0x12, 0x02, 0x02, 0x0E, 0x89, 0x00, 0x01, 0x0A, 0x01, 0x00, 0x01, 0x8D,
+	0x00, 0x00, 0x12, 0x82, 0x02, 0x00, 0x0D, 0x8A, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8C, 0x00, 0x04, 0x1D, 0x0C, 0x02, 0x02, 0x0C, 0x8B, 0x00, 0x00,
+	0x01, 0x00, 0x1A, 0x8C, 0x00, 0x00, 0x1E, 0x83, 0x02, 0x00, 0x0F, 0x83, 0x0B, 0x00, 0x16, 0x85, 0x00, 0x00, 0x08, 0x8C, 0x00, 0x01, 0x25, 0x0C,
+	0x89, 0x02, 0x00, 0x26, 0x84, 0x00, 0x00, 0x05, 0x00, 0x06, 0x85, 0x00, 0x06, 0x20, 0x13, 0x13, 0x07, 0x21, 0x27, 0x17, 0x8A, 0x02, 0x00, 0x18,
+	0x85, 0x00, 0x86, 0x00, 0x00, 0x07, 0x82, 0x03, 0x00, 0x10, 0x8B, 0x02, 0x00, 0x0E, 0x86, 0x00, 0x86, 0x00, 0x00, 0x07, 0x82, 0x03, 0x00, 0x10,
+	0x8C, 0x02, 0x00, 0x11, 0x85, 0x00, 0x00, 0x06, 0x85, 0x00, 0x00, 0x07, 0x82, 0x03, 0x00, 0x10, 0x8B, 0x02, 0x00, 0x0E, 0x86, 0x00, 0x86, 0x00,
+	0x00, 0x07, 0x82, 0x03, 0x00, 0x10, 0x8B, 0x02, 0x00, 0x12, 0x85, 0x00, 0x00, 0x05, 0x00, 0x15, 0x85, 0x00, 0x00, 0x07, 0x82, 0x03, 0x00, 0x14,
+	0x8B, 0x02, 0x00, 0x0F, 0x85, 0x00, 0x00, 0x08, 0x01, 0x01, 0x04, 0x84, 0x00, 0x00, 0x07, 0x82, 0x03, 0x00, 0x14, 0x8A, 0x02, 0x01, 0x0C, 0x0D,
+	0x84, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x06, 0x84, 0x00, 0x00, 0x07, 0x82, 0x03, 0x00, 0x14, 0x8A, 0x02, 0x00, 0x0E, 0x85, 0x00, 0x01, 0x04,
+	0x01, 0x02, 0x01, 0x06, 0x04, 0x83, 0x00, 0x00, 0x13, 0x82, 0x03, 0x02, 0x28, 0x17, 0x0F, 0x87, 0x02, 0x01, 0x0C, 0x09, 0x85, 0x00, 0x01, 0x08,
+	0x01, 0x01, 0x01, 0x01, 0x8B, 0x00, 0x03, 0x04, 0x29, 0x18, 0x22, 0x82, 0x09, 0x01, 0x0D, 0x23, 0x86, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x2A, 0x98, 0x00, 0x03, 0x04, 0x0A, 0x01, 0x01, 0x82, 0x01, 0x01, 0x05, 0x04, 0x97, 0x00, 0x82, 0x01, 0x83, 0x01, 0x00, 0x05, 0x96, 0x00, 0x83,
+	0x01, 0x84, 0x01, 0x01, 0x00, 0x04, 0x92, 0x00, 0x00, 0x06, 0x84, 0x01, 0x85, 0x01, 0x00, 0x06, 0x90, 0x00, 0x01, 0x04, 0x00, 0x85, 0x01, 0x86,
+	0x01, 0x00, 0x2B, 0x8E, 0x00, 0x01, 0x05, 0x19, 0x86, 0x01, 0x88, 0x01, 0x00, 0x0A, 0x89, 0x00, 0x02, 0x04, 0x00, 0x06, 0x88, 0x01, 0x8B, 0x01,
+	0x07, 0x08, 0x05, 0x06, 0x00, 0x00, 0x06, 0x05, 0x08, 0x8B, 0x01,
+};
+
+const CrowOs::Core::Asset thumbs_up = {"thumbs_up", 32, 32, CrowOs::Core::ASSET_FORMAT_PALETTE, thumbs_up_palette, 44, thumbs_up_data, 555};
+
+static const uint16_t res_circle_palette[191] PROGMEM = {
+	0x0000, 0x0AF1, 0x0B12, 0x0B53, 0x0B74, 0x028F, 0x0AD0, 0x026E, 0x02B0, 0x02AF, 0x0B32, 0x1418, 0x1438, 0x0B33, 0x0BD6, 0x0BF7,
+	0xFFFF, 0x0B94, 0x0BB5, 0xC639, 0x1459, 0xDEFB, 0x6518, 0x8D78, 0x1439, 0x024E, 0x0A6E, 0xCE9A, 0x0B95, 0x13D6, 0x2C78, 0x0AB0,
+	0xD6BA, 0x22CF, 0x7CD5, 0x3CD9, 0x54F9, 0x0148, 0x7D58, 0x7473, 0x1479, 0xCE7A, 0x0A8E, 0x0A8F, 0xD69A, 0x1ACF, 0x34DA, 0x12F0,
+	0x84F5, 0x1B94, 0x09CA, 0xA5D8, 0x020C, 0x5C12, 0x2417, 0xB619, 0x022D, 0x0A2D, 0x6433, 0x1C37, 0xBE39, 0x2437, 0x0A4D, 0x0A4E,
+	0x2458, 0xAE5B, 0xC659, 0xCE59, 0x13F7, 0x1C79, 0x2479, 0xCE79, 0xC67A, 0x2C99, 0xBE9B, 0x74B4, 0x34B9, 0x44D9, 0xD6DB, 0x3CDA,
+	0x2AEF, 0x8515, 0x9536, 0xDF3D, 0xADF8, 0x1353, 0x1B53, 0xA576, 0x8578, 0x0189, 0x4391, 0xA597, 0x01A9, 0x0BB6, 0xADB7, 0xEFBE,
+	0xF7BF, 0x4BD2, 0xF7DF, 0x43F4, 0x23F6, 0x3415, 0x3C15, 0x1417, 0xBE18, 0x2416, 0x4B91, 0x5433, 0x5434, 0xC638, 0x4455, 0xB65A,
+	0x6474, 0x4C77, 0x128E, 0x6C94, 0x6C95, 0x7494, 0x4C97, 0x1C9A, 0xADD7, 0xADD8, 0x7CB4, 0x6CB6, 0x44B8, 0x12CF, 0x12D0, 0x84D5,
+	0x4CD8, 0x22EF, 0x1AF0, 0x64F8, 0x5CF8, 0x5CF9, 0x330F, 0x1B10, 0x1311, 0x1B11, 0x7D17, 0x6D18, 0x3330, 0x2331, 0x1332, 0x1B32,
+	0x7D37, 0x7538, 0x6D38, 0x43D3, 0x3350, 0x2351, 0x3B50, 0x9556, 0x8558, 0x8D58, 0x3B71, 0x2B72, 0x1373, 0x1B73, 0x2B73, 0x9D76,
+	0xE77E, 0x3392, 0x2B93, 0x1395, 0x1394, 0x9598, 0x2393, 0x3B92, 0xEF9E, 0x43B2, 0x2BB4, 0x13B5, 0x23B5, 0x95B9, 0xA5B7, 0x9DB8,
+	0xA5B8, 0xBDF8, 0x3BD3, 0x33D3, 0x23D4, 0x13D5, 0x23D5, 0x2BD5, 0x9DD9, 0x33D4, 0xB5D7, 0xFFDF, 0xB5D8, 0xB5F8, 0xA5F9,
+};
+
+static const uint8_t res_circle_data[560] PROGMEM = {
+	0x88, 0x00, 0x0A, 0x32, 0x0D, 0x1D, 0x0B, 0x28, 0x14, 0x28, 0x0B, 0x1D, 0x0D, 0x32, 0x88, 0x00, 0x86, 0x00, 0x04, 0x19, 0x1D, 0x14, 0x0C, 0x0C,
+	0x83, 0x0B, 0x05, 0x67, 0x0B, 0x0C, 0x18, 0x1D, 0x19, 0x86, 0x00, 0x84, 0x00, 0x07, 0x25, 0x12, 0x18, 0x0C, 0x0C, 0x0F, 0x0E, 0x5D, 0x82, 0x12,
+	0x07, 0x5D, 0x0E, 0x0F, 0x0B, 0x0B, 0x0C, 0x12, 0x25, 0x84, 0x00, 0x83, 0x00, 0x06, 0x34, 0x0B, 0x18, 0x0C, 0x0E, 0xB5, 0xAB, 0x86, 0x11, 0x06,
+	0x1C, 0x12, 0x0E, 0x0B, 0x0C, 0x0B, 0x34, 0x83, 0x00, 0x82, 0x00, 0x08, 0x38, 0x14, 0x14, 0x0F, 0xB6, 0x91, 0x41, 0x26, 0xAC, 0x88, 0x04, 0x04,
+	0x1C, 0x0F, 0x0C, 0x18, 0x38, 0x82, 0x00, 0x0B, 0x00, 0x00, 0x59, 0x0C, 0x18, 0x0E, 0x65, 0x41, 0x60, 0x10, 0xA8, 0x26, 0x89, 0x04, 0x06, 0x11,
+	0x0E, 0x0C, 0x0C, 0x59, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1D, 0x0C, 0x0E, 0xB7, 0x4A, 0x82, 0x10, 0x01, 0x62, 0xAD, 0x8A, 0x03, 0x05, 0x04, 0x0E,
+	0x0B, 0x1D, 0x00, 0x00, 0x0B, 0x00, 0x1F, 0x14, 0x0F, 0x04, 0x98, 0x62, 0x10, 0x10, 0x5F, 0xB8, 0xAA, 0x8B, 0x03, 0x04, 0x04, 0x0F, 0x0C, 0x1F,
+	0x00, 0x0A, 0x00, 0x0B, 0x0C, 0x1C, 0x9C, 0x4A, 0x10, 0x10, 0x5F, 0x17, 0x9D, 0x8C, 0x0D, 0x04, 0x03, 0x1C, 0x0F, 0x0B, 0x00, 0x09, 0x3F, 0x18,
+	0x0F, 0x03, 0xA2, 0x53, 0x10, 0x60, 0xA5, 0x55, 0x8E, 0x0A, 0x03, 0x03, 0x0E, 0x0C, 0x3F, 0x08, 0x04, 0x0B, 0x1C, 0x0A, 0x63, 0xA0, 0xBB, 0xBE,
+	0x56, 0x8F, 0x02, 0x03, 0x0A, 0x1C, 0x0F, 0x04, 0x07, 0x44, 0x0E, 0x03, 0x02, 0xB2, 0x53, 0x6F, 0x9E, 0x91, 0x02, 0x02, 0x03, 0x12, 0x44, 0x06,
+	0x14, 0x12, 0x0D, 0x01, 0x8F, 0x7B, 0x9B, 0x92, 0x01, 0x02, 0x03, 0xA3, 0x14, 0x02, 0x28, 0xA4, 0x8E, 0x96, 0x01, 0x02, 0x56, 0x31, 0x45, 0x03,
+	0x45, 0xB4, 0xA6, 0x88, 0x94, 0x06, 0x03, 0x89, 0xB3, 0xB9, 0x77, 0x04, 0x46, 0x66, 0x63, 0x95, 0x06, 0x92, 0x08, 0x04, 0x2F, 0xA1, 0x6C, 0x6E,
+	0x46, 0x05, 0x3B, 0x71, 0x70, 0x93, 0x87, 0x1F, 0x90, 0x09, 0x05, 0x1F, 0x8D, 0x6B, 0x4B, 0x76, 0x3B, 0x05, 0x31, 0x7C, 0x22, 0x74, 0xA7, 0x7E,
+	0x8F, 0x05, 0x06, 0x2B, 0x82, 0x61, 0x22, 0x51, 0x80, 0x31, 0x07, 0x1A, 0x23, 0x8A, 0x52, 0x73, 0x9A, 0x7D, 0x2B, 0x85, 0x05, 0x86, 0x07, 0x07,
+	0x2B, 0x2D, 0xA9, 0x22, 0x57, 0x90, 0x23, 0x1A, 0x08, 0x00, 0x40, 0x83, 0x5B, 0x57, 0x4B, 0x5A, 0x2D, 0x2A, 0x8A, 0x07, 0x08, 0x2A, 0x81, 0x61,
+	0x30, 0x5E, 0xAE, 0x16, 0x40, 0x00, 0x0B, 0x00, 0x2F, 0x4D, 0x99, 0xBD, 0xBA, 0x51, 0x35, 0x94, 0x2D, 0x2A, 0x1A, 0x83, 0x19, 0x0C, 0x07, 0x1A,
+	0x72, 0x21, 0x96, 0x3A, 0x52, 0xB1, 0x68, 0x17, 0x4D, 0x2F, 0x00, 0x0C, 0x00, 0x00, 0x36, 0x84, 0xAF, 0x13, 0x6D, 0x5B, 0x22, 0x35, 0x5A, 0x86,
+	0x50, 0x82, 0x21, 0x0C, 0x50, 0x8C, 0x6A, 0x3A, 0x30, 0x5E, 0x42, 0x42, 0x33, 0x85, 0x36, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x5C, 0x49, 0x16, 0x33,
+	0x47, 0x1B, 0x13, 0x78, 0x97, 0x7F, 0x75, 0x82, 0x27, 0x0C, 0x7A, 0x30, 0x9F, 0xBC, 0x43, 0x2C, 0x29, 0x79, 0x16, 0x49, 0x5C, 0x00, 0x00, 0x82,
+	0x00, 0x08, 0x3E, 0x4C, 0x16, 0xB0, 0x48, 0x20, 0x20, 0x2C, 0x43, 0x84, 0x13, 0x08, 0x47, 0x2C, 0x20, 0x20, 0x48, 0x33, 0x16, 0x4C, 0x3E, 0x82,
+	0x00, 0x83, 0x00, 0x06, 0x39, 0x1E, 0x24, 0x17, 0x37, 0x1B, 0x4E, 0x86, 0x15, 0x06, 0x4E, 0x1B, 0x37, 0x17, 0x24, 0x1E, 0x39, 0x83, 0x00, 0x84,
+	0x00, 0x07, 0x25, 0x64, 0x23, 0x16, 0x17, 0x54, 0x3C, 0x29, 0x82, 0x1B, 0x07, 0x29, 0x3C, 0x54, 0x17, 0x16, 0x23, 0x64, 0x25, 0x84, 0x00, 0x86,
+	0x00, 0x0E, 0x1A, 0x3D, 0x4F, 0x24, 0x92, 0x26, 0x58, 0x17, 0x58, 0x26, 0x8B, 0x24, 0x4F, 0x3D, 0x1A, 0x86, 0x00, 0x88, 0x00, 0x03, 0x32, 0x55,
+	0x69, 0x1E, 0x82, 0x2E, 0x00, 0x1E, 0x8B, 0x00,
+};
+
+const CrowOs::Core::Asset res_circle = {"res_circle", 29, 28, CrowOs::Core::ASSET_FORMAT_PALETTE, res_circle_palette, 191, res_circle_data, 942};
+
+const CrowOs::Core::Asset* const ASSETS[] = {
+	&res_logo,
+	&res_battery_10,
+	&res_battery_35,
+	&res_battery_50,
+	&res_battery_65,
+	&res_battery_80,
+	&res_battery_100,
+	&res_wifi_connected,
+	&res_wifi_disconnected,
+	&res_wifi_connecting,
+	&res_wifi_connfiguring,
+	&res_wifi_error,
+	&rotate_left,
+	&rotate_right,
+	&thumbs_up,
+	&res_circle,
+};
+
+const short ASSETS_COUNT = sizeof(ASSETS) / sizeof(ASSETS[0]);
@@ -0,0 +1,113 @@
+/**
+ * FeatureRegistry unit tests
+ * @author error23
+ */
+
+// Lib includes
+#include <Arduino.h>
+#include <unity.h>
+
+// local Includes
+#include "core/FeatureFactory.hpp"
+#include "core/FeatureRegistry.hpp"
+#include "core/Hash.hpp"
+
+using namespace CrowOs::Core;
+
+static_assert(FeatureRegistry::hashName("") == 2166136261u, "empty name hashes to FNV-1a offset basis");
+static_assert(FeatureRegistry::hashName("a") == 0xE40C292Cu, "name hash is FNV-1a");
+
+/**
+ * Called before each test
+ */
+void setUp() {
+}
+
+/**
+ * Called after each test
+ */
+void tearDown() {
+}
+
+/**
+ * Registries hold every descriptor in table order
+ */
+void test_registry_follows_descriptors() {
+
+	TEST_ASSERT_EQUAL(FEATURE_DESCRIPTORS_SIZE, FeatureFactory::featureFactories.size());
+	TEST_ASSERT_EQUAL(PERMANENT_FEATURE_DESCRIPTORS_SIZE, FeatureFactory::permanentFactories.size());
+
+	for(size_t i = 0; i < FEATURE_DESCRIPTORS_SIZE; i++) {
+		FeatureRegistry::Entry& featureFactorySavedDataPair = FeatureFactory::featureFactories[i];
+		TEST_ASSERT_TRUE(featureFactorySavedDataPair.first == FEATURE_DESCRIPTORS[i].factory);
+		TEST_ASSERT_EQUAL(i, FeatureFactory::featureFactories.indexOf(&featureFactorySavedDataPair));
+	}
+}
+
+/**
+ * Factories are found by name and by pointer, unknown ones are not found
+ */
+void test_find_by_name() {
+
+	for(size_t i = 0; i < FEATURE_DESCRIPTORS_SIZE; i++) {
+		FeatureRegistry::Entry* featureFactorySavedDataPair = FeatureFactory::featureFactories.find(FEATURE_DESCRIPTORS[i].name);
+		TEST_ASSERT_TRUE(featureFactorySavedDataPair == &FeatureFactory::featureFactories[i]);
+		TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find(FEATURE_DESCRIPTORS[i].factory) == featureFactorySavedDataPair);
+	}
+
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find("UnknownFactory") == NULL);
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find(PERMANENT_FEATURE_DESCRIPTORS[0].name) == NULL);
+}
+
+/**
+ * Factories are found by database id once it is set, and no longer by their previous id
+ */
+void test_find_by_id() {
+
+	for(size_t i = 0; i < FEATURE_DESCRIPTORS_SIZE; i++) {
+		FeatureFactory::featureFactories.setFeatureFactoryId(&FeatureFactory::featureFactories[i], 100 + i);
+	}
+	for(size_t i = 0; i < FEATURE_DESCRIPTORS_SIZE; i++) {
+		TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find(100L + (long)i) == &FeatureFactory::featureFactories[i]);
+		TEST_ASSERT_EQUAL(100 + i, FeatureFactory::featureFactories[i].first->getFeatureFactoryId());
+	}
+
+	FeatureFactory::featureFactories.setFeatureFactoryId(&FeatureFactory::featureFactories[0], 42);
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find(42L) == &FeatureFactory::featureFactories[0]);
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find(100L) == NULL);
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories.find(-1L) == NULL);
+}
+
+/**
+ * Compile time name hashes of descriptors match runtime FNV-1a of their names and of their saved data hash
+ */
+void test_name_hash_matches_fnv1a() {
+
+	for(size_t i = 0; i < FEATURE_DESCRIPTORS_SIZE; i++) {
+		const char* name = FEATURE_DESCRIPTORS[i].name;
+		TEST_ASSERT_EQUAL(FEATURE_DESCRIPTORS[i].nameHash, Hash::fnv1a(name, strlen(name)));
+		TEST_ASSERT_EQUAL(FEATURE_DESCRIPTORS[i].nameHash, FeatureFactory::hashSavedData(name));
+	}
+
+	// hashing in parts gives the hash of the whole
+	TEST_ASSERT_EQUAL(FeatureRegistry::hashName("ab"), Hash::fnv1a("b", 1, Hash::fnv1a("a", 1)));
+}
+
+/**
+ * Runs tests
+ */
+void setup() {
+
+	UNITY_BEGIN();
+	RUN_TEST(test_registry_follows_descriptors);
+	RUN_TEST(test_find_by_name);
+	RUN_TEST(test_find_by_id);
+	RUN_TEST(test_name_hash_matches_fnv1a);
+	exit(UNITY_END());
+}
+
+/**
+ * Never reached, setup exits
+ */
+void loop() {
+}
@@ -0,0 +1,148 @@
+/**
+ * HttpCache unit tests
+ * @author error23
+ */
+
+// Lib includes
+#include <Arduino.h>
+#include <unity.h>
+
+// local Includes
+#include "core/HttpCache.hpp"
+
+using namespace CrowOs::Core;
+
+/**
+ * Called before each test
+ */
+void setUp() {
+}
+
+/**
+ * Called after each test
+ */
+void tearDown() {
+}
+
+/**
+ * Validators of a full response are returned by next get of the same uri only
+ */
+void test_validators_are_kept() {
+
+	HttpCache cache;
+
+	HttpCache::Entry entry = cache.get("/printer");
+	TEST_ASSERT_EQUAL('\0', entry.etag[0]);
+
+	HttpCache::update(entry, 200, "\"v1\"", "Wed, 21 Oct 2015 07:28:00 GMT", "");
+	cache.store(entry);
+
+	entry = cache.get("/printer");
+	TEST_ASSERT_EQUAL(0, strcmp(entry.etag, "\"v1\""));
+	TEST_ASSERT_EQUAL(0, strcmp(entry.lastModified, "Wed, 21 Oct 2015 07:28:00 GMT"));
+	TEST_ASSERT_FALSE(HttpCache::isFresh(entry));
+
+	TEST_ASSERT_EQUAL('\0', cache.get("/featureData").etag[0]);
+}
+
+/**
+ * Not modified response without validators keeps previous ones
+ */
+void test_not_modified_keeps_validators() {
+
+	HttpCache cache;
+
+	HttpCache::Entry entry = cache.get("/printer");
+	HttpCache::update(entry, 200, "\"v1\"", "", "");
+	cache.store(entry);
+
+	entry = cache.get("/printer");
+	HttpCache::update(entry, HttpCache::NOT_MODIFIED, "", "", "");
+	cache.store(entry);
+
+	TEST_ASSERT_EQUAL(0, strcmp(cache.get("/printer").etag, "\"v1\""));
+}
+
+/**
+ * Error and no-store responses remove uri so that next request is not conditional
+ */
+void test_uncacheable_response_removes_uri() {
+
+	HttpCache cache;
+
+	HttpCache::Entry entry = cache.get("/printer");
+	HttpCache::update(entry, 200, "\"v1\"", "", "");
+	cache.store(entry);
+
+	entry = cache.get("/printer");
+	HttpCache::update(entry, 500, "", "", "");
+	cache.store(entry);
+	TEST_ASSERT_EQUAL('\0', cache.get("/printer").etag[0]);
+
+	entry = cache.get("/printer");
+	HttpCache::update(entry, 200, "\"v2\"", "", "no-store");
+	cache.store(entry);
+	TEST_ASSERT_EQUAL('\0', cache.get("/printer").etag[0]);
+}
+
+/**
+ * Response with max-age is fresh, no-cache always revalidates
+ */
+void test_max_age_is_fresh() {
+
+	HttpCache::Entry entry = HttpCache::Entry();
+
+	HttpCache::update(entry, 200, "", "", "max-age=60");
+	TEST_ASSERT_TRUE(HttpCache::isFresh(entry));
+
+	HttpCache::update(entry, 200, "", "", "no-cache, max-age=60");
+	TEST_ASSERT_FALSE(HttpCache::isFresh(entry));
+}
+
+/**
+ * Least recently used uri is evicted when cache is full
+ */
+void test_least_recently_used_is_evicted() {
+
+	HttpCache cache;
+	char uri[16];
+
+	// more uris than cache holds, the first one is read back each time so that it stays recently used
+	for(uint8_t i = 0; i < 8; i++) {
+		cache.get("/kept");
+		snprintf(uri, sizeof uri, "/uri%d", i);
+		HttpCache::Entry entry = cache.get(uri);
+		HttpCache::update(entry, 200, "\"v\"", "", "");
+		cache.store(entry);
+
+		if(i == 0) {
+			entry = cache.get("/kept");
+			HttpCache::update(entry, 200, "\"kept\"", "", "");
+			cache.store(entry);
+		}
+	}
+
+	TEST_ASSERT_EQUAL(0, strcmp(cache.get("/kept").etag, "\"kept\""));
+	TEST_ASSERT_EQUAL(0, strcmp(cache.get("/uri7").etag, "\"v\""));
+	TEST_ASSERT_EQUAL('\0', cache.get("/uri0").etag[0]);
+}
+
+/**
+ * Runs tests
+ */
+void setup() {
+
+	UNITY_BEGIN();
+	RUN_TEST(test_validators_are_kept);
+	RUN_TEST(test_not_modified_keeps_validators);
+	RUN_TEST(test_uncacheable_response_removes_uri);
+	RUN_TEST(test_max_age_is_fresh);
+	RUN_TEST(test_least_recently_used_is_evicted);
+	exit(UNITY_END());
+}
+
+/**
+ * Never reached, setup exits
+ */
+void loop() {
+}
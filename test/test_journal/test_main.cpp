@@ -0,0 +1,208 @@
+/**
+ * Journal unit tests
+ * @author error23
+ */
+
+// Lib includes
+#include <Arduino.h>
+#include <unity.h>
+
+// local Includes
+#include "core/FeatureDataStore.hpp"
+#include "core/FeatureFactory.hpp"
+#include "core/Journal.hpp"
+#include "core/SavedDataRecord.hpp"
+
+using namespace CrowOs::Core;
+
+/** Storage key prefix of FeatureDataStore local copies */
+const char LOCAL_COPY_PREFIX = 'm';
+
+/** Replay client, requests are only queued since NetworkTask is not started nor polled */
+WebClient journalWebClient("127.0.0.1", 8080, "", "", "/");
+
+/**
+ * Resets saved data of every factory as if it was never changed nor synced
+ */
+void resetFeatureFactories() {
+
+	for(auto& featureFactorySavedDataPair : FeatureFactory::featureFactories) {
+		featureFactorySavedDataPair.second = "";
+		featureFactorySavedDataPair.first->setSavedData(featureFactorySavedDataPair.second);
+		featureFactorySavedDataPair.first->markSynced();
+		FeatureFactory::featureFactories.setFeatureFactoryId(&featureFactorySavedDataPair, -1);
+	}
+}
+
+/**
+ * Restarts from an empty storage, every test starts without local copy nor pending saved data
+ */
+void setUp() {
+
+	Hal::Storage::clear();
+	resetFeatureFactories();
+	FeatureDataStore::load();
+	Journal::begin(&journalWebClient);
+}
+
+/**
+ * Leaves no local copy behind
+ */
+void tearDown() {
+	Hal::Storage::clear();
+}
+
+/**
+ * Builds saved data of given length
+ *
+ * @param length of saved data
+ * @return json string of given length
+ */
+String buildSavedData(const size_t length) {
+
+	String savedData = "\"";
+	while(savedData.length() < length - 1) {
+		savedData += 'x';
+	}
+	savedData += "\"";
+	return savedData;
+}
+
+/**
+ * Journals saved data of registered factory
+ *
+ * @param index     of factory in FeatureFactory::featureFactories
+ * @param savedData to journal
+ */
+void recordSavedData(const size_t index, const String& savedData) {
+
+	FeatureRegistry::Entry& featureFactorySavedDataPair = FeatureFactory::featureFactories[index];
+	featureFactorySavedDataPair.second = savedData;
+	featureFactorySavedDataPair.first->setSavedData(featureFactorySavedDataPair.second);
+	Journal::record(featureFactorySavedDataPair.first, featureFactorySavedDataPair.second);
+}
+
+/**
+ * Reads local copy of registered factory
+ *
+ * @param index     of factory in FeatureFactory::featureFactories
+ * @param version   filled with stored synced hash
+ * @param id        filled with stored id
+ * @param savedData filled with stored saved data
+ * @return true if a valid local copy was read
+ */
+bool readLocalCopy(const size_t index, uint32_t& version, int32_t& id, String& savedData) {
+
+	char key[SavedDataRecord::KEY_SIZE + 1];
+	SavedDataRecord::getKey(LOCAL_COPY_PREFIX, FeatureFactory::featureFactories[index].first, key);
+	return SavedDataRecord::read(key, version, id, savedData);
+}
+
+/**
+ * Recorded saved data is pending and its local copy keeps the synced stamp it is based on
+ */
+void test_record_writes_local_copy() {
+
+	TEST_ASSERT_EQUAL(0, Journal::getPendingCount());
+
+	recordSavedData(1, "{\"a\":1}");
+	TEST_ASSERT_EQUAL(1, Journal::getPendingCount());
+
+	uint32_t version;
+	int32_t id;
+	String savedData;
+	TEST_ASSERT_TRUE(readLocalCopy(1, version, id, savedData));
+	TEST_ASSERT_EQUAL(FeatureFactory::hashSavedData(""), version);
+	TEST_ASSERT_EQUAL(-1, id);
+	TEST_ASSERT_EQUAL_STRING("{\"a\":1}", savedData.c_str());
+
+	// same saved data is neither journaled twice nor written again
+	Journal::record(FeatureFactory::featureFactories[1].first, FeatureFactory::featureFactories[1].second);
+	TEST_ASSERT_EQUAL(1, Journal::getPendingCount());
+}
+
+/**
+ * Pending saved data is restored and pending again after a restart
+ */
+void test_pending_saved_data_survives_restart() {
+
+	recordSavedData(2, "{\"b\":2}");
+
+	resetFeatureFactories();
+	TEST_ASSERT_EQUAL(FEATURE_DESCRIPTORS_SIZE, FeatureDataStore::load());
+	Journal::begin(&journalWebClient);
+
+	TEST_ASSERT_EQUAL(1, Journal::getPendingCount());
+	TEST_ASSERT_EQUAL_STRING("{\"b\":2}", FeatureFactory::featureFactories[2].second.c_str());
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories[2].first->isDirty());
+	TEST_ASSERT_FALSE(FeatureFactory::featureFactories[1].first->isDirty());
+}
+
+/**
+ * Saved data larger than a replay is dropped once instead of holding back later saved data or being journaled on each save
+ */
+void test_oversized_saved_data_is_dropped() {
+
+	String oversized = buildSavedData(JsonPool::DOCUMENT_SIZE - 8);
+	recordSavedData(0, oversized);
+	TEST_ASSERT_EQUAL(0, Journal::getPendingCount());
+
+	recordSavedData(1, buildSavedData(16));
+	TEST_ASSERT_EQUAL(1, Journal::getPendingCount());
+
+	Journal::record(FeatureFactory::featureFactories[0].first, FeatureFactory::featureFactories[0].second);
+	TEST_ASSERT_EQUAL(1, Journal::getPendingCount());
+
+	// replay sends the small one and keeps it pending until server answers
+	Journal::replay();
+	TEST_ASSERT_EQUAL(1, Journal::getPendingCount());
+
+	// dropped saved data stays dirty in its local copy
+	uint32_t version;
+	int32_t id;
+	String savedData;
+	TEST_ASSERT_TRUE(readLocalCopy(0, version, id, savedData));
+	TEST_ASSERT_EQUAL_STRING(oversized.c_str(), savedData.c_str());
+	TEST_ASSERT_TRUE(FeatureFactory::featureFactories[0].first->isDirty());
+}
+
+/**
+ * Local copy longer than any record is removed without being read
+ */
+void test_corrupted_local_copy_is_removed() {
+
+	char key[SavedDataRecord::KEY_SIZE + 1];
+	SavedDataRecord::getKey(LOCAL_COPY_PREFIX, FeatureFactory::featureFactories[1].first, key);
+
+	static uint8_t foreign[4 * MAX_JSON_DOCUMENT_SIZE];
+	memset(foreign, 0xA5, sizeof foreign);
+	TEST_ASSERT_TRUE(Hal::Storage::write(key, foreign, sizeof foreign));
+
+	resetFeatureFactories();
+	FeatureDataStore::load();
+
+	TEST_ASSERT_EQUAL(0, Hal::Storage::getLength(key));
+	TEST_ASSERT_EQUAL_STRING("", FeatureFactory::featureFactories[1].second.c_str());
+}
+
+/**
+ * Runs tests
+ */
+void setup() {
+
+	Hal::begin();
+	Hal::Storage::begin();
+
+	UNITY_BEGIN();
+	RUN_TEST(test_record_writes_local_copy);
+	RUN_TEST(test_pending_saved_data_survives_restart);
+	RUN_TEST(test_oversized_saved_data_is_dropped);
+	RUN_TEST(test_corrupted_local_copy_is_removed);
+	exit(UNITY_END());
+}
+
+/**
+ * Never reached, setup exits
+ */
+void loop() {
+}
@@ -0,0 +1,152 @@
+/**
+ * Scheduler unit tests
+ * @author error23
+ */
+
+// Lib includes
+#include <Arduino.h>
+#include <unity.h>
+
+// local Includes
+#include "core/Scheduler.hpp"
+
+using namespace CrowOs::Core;
+
+/** Indicates if test timer fired, outlives tests so that a timer left by a failed test never writes into a dead frame */
+bool fired = false;
+
+/** Test timer, canceled after each test */
+TimerId timer = Scheduler::NO_TIMER;
+
+/** One scheduler wheel turn in ms, 64 slots of 10 ms ticks */
+const uint32_t WHEEL_TURN = 640;
+
+/**
+ * Marks timer as fired
+ *
+ * @param context fired flag
+ */
+void onTimer(void* context) {
+	*(bool*)context = true;
+}
+
+/**
+ * Schedules test timer without delay from a callback
+ *
+ * @param context fired flag
+ */
+void onRescheduleTimer(void* context) {
+	timer = Scheduler::schedule(0, onTimer, context);
+}
+
+/**
+ * Resets fired flag before each test
+ */
+void setUp() {
+	fired = false;
+}
+
+/**
+ * Cancels test timer after each test
+ */
+void tearDown() {
+	Scheduler::cancel(timer);
+}
+
+/**
+ * Waits until the first scheduled timer is due
+ */
+void waitNextDeadline() {
+
+	while(Hal::Clock::getMicroseconds() / 1000 < Scheduler::getNextDeadline()) {
+		delay(1);
+	}
+}
+
+/**
+ * Timer without delay scheduled in processed tick fires on next tick instead of one wheel turn later
+ */
+void test_zero_delay_runs_on_next_tick() {
+
+	Scheduler::run();
+
+	timer = Scheduler::schedule(0, onTimer, &fired);
+	TEST_ASSERT_TRUE(Scheduler::isScheduled(timer));
+
+	waitNextDeadline();
+	Scheduler::run();
+
+	TEST_ASSERT_TRUE(fired);
+	TEST_ASSERT_FALSE(Scheduler::isScheduled(timer));
+}
+
+/**
+ * Timer does not fire before its deadline
+ */
+void test_timer_runs_at_deadline() {
+
+	timer = Scheduler::schedule(50, onTimer, &fired);
+	Scheduler::run();
+	TEST_ASSERT_FALSE(fired);
+
+	waitNextDeadline();
+	Scheduler::run();
+
+	TEST_ASSERT_TRUE(fired);
+}
+
+/**
+ * Timer scheduled without delay by a callback of a stalled run fires on next tick instead of one wheel turn later
+ */
+void test_stalled_run_reschedules_on_next_tick() {
+
+	Scheduler::run();
+	Scheduler::schedule(0, onRescheduleTimer, &fired);
+
+	// run stalls exactly one wheel turn past the first timer so that the rescheduled one lands in the slot being processed
+	uint64_t stalledUntil = Scheduler::getNextDeadline() + WHEEL_TURN;
+	while(Hal::Clock::getMicroseconds() / 1000 < stalledUntil) {
+		delayMicroseconds(100);
+	}
+	Scheduler::run();
+	TEST_ASSERT_TRUE(Scheduler::isScheduled(timer));
+
+	waitNextDeadline();
+	Scheduler::run();
+
+	TEST_ASSERT_TRUE(fired);
+}
+
+/**
+ * Canceled timer never fires
+ */
+void test_cancelled_timer_does_not_run() {
+
+	timer = Scheduler::schedule(0, onTimer, &fired);
+	TEST_ASSERT_TRUE(Scheduler::cancel(timer));
+	TEST_ASSERT_EQUAL(Scheduler::NO_TIMER, timer);
+
+	delay(20);
+	Scheduler::run();
+
+	TEST_ASSERT_FALSE(fired);
+}
+
+/**
+ * Runs tests
+ */
+void setup() {
+
+	UNITY_BEGIN();
+	RUN_TEST(test_zero_delay_runs_on_next_tick);
+	RUN_TEST(test_timer_runs_at_deadline);
+	RUN_TEST(test_stalled_run_reschedules_on_next_tick);
+	RUN_TEST(test_cancelled_timer_does_not_run);
+	exit(UNITY_END());
+}
+
+/**
+ * Never reached, setup exits
+ */
+void loop() {
+}
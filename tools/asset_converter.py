@@ -0,0 +1,253 @@
+"""
+CrowOs asset converter
+
+Compresses the raw RGB565 images found in assets/ into include/resources/r_assets.hpp and src/resources/r_assets.cpp
+Each image is stored either as run length encoded RGB565 colors or as run length encoded indexes into a palette, whichever is smaller
+
+Rows are encoded independently as a list of runs, each run starts with a control byte :
+    1xxxxxxx : next value is repeated (x + 1) times
+    0xxxxxxx : (x + 1) literal values follow
+A value is a little endian RGB565 color (ASSET_FORMAT_RLE) or a one byte palette index (ASSET_FORMAT_PALETTE)
+
+Runs as PlatformIO pre script and only regenerates when an asset changed, it can also be run by hand :
+$ python3 tools/asset_converter.py
+
+@author error23
+"""
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0] if __name__ == "__main__" else __file__)))
+
+ASSETS_DIR = os.path.join(PROJECT_DIR, "assets")
+HEADER_PATH = os.path.join(PROJECT_DIR, "include", "resources", "r_assets.hpp")
+SOURCE_PATH = os.path.join(PROJECT_DIR, "src", "resources", "r_assets.cpp")
+
+# Asset table : source file, array name, width, height
+ASSETS = [
+    ("r_logo.hpp", "res_logo", 79, 144),
+    ("r_battery.hpp", "res_battery_10", 16, 10),
+    ("r_battery.hpp", "res_battery_35", 16, 10),
+    ("r_battery.hpp", "res_battery_50", 16, 10),
+    ("r_battery.hpp", "res_battery_65", 16, 10),
+    ("r_battery.hpp", "res_battery_80", 16, 10),
+    ("r_battery.hpp", "res_battery_100", 16, 10),
+    ("r_wifi.hpp", "res_wifi_connected", 16, 10),
+    ("r_wifi.hpp", "res_wifi_disconnected", 16, 10),
+    ("r_wifi.hpp", "res_wifi_connecting", 16, 10),
+    ("r_wifi.hpp", "res_wifi_connfiguring", 16, 10),
+    ("r_wifi.hpp", "res_wifi_error", 16, 10),
+    ("r_omni_level.hpp", "rotate_left", 32, 32),
+    ("r_omni_level.hpp", "rotate_right", 32, 32),
+    ("r_omni_level.hpp", "thumbs_up", 32, 32),
+    ("r_libelle.hpp", "res_circle", 29, 28),
+]
+
+# Longest run a control byte can describe
+MAX_RUN = 128
+
+
+def read_pixels(path, name, width, height):
+    """Reads RGB565 array from an ImageConverter 565 header, missing pixels are black like in the C initializer"""
+
+    with open(path) as file:
+        content = file.read()
+
+    match = re.search(r"\b%s\[\d+\]\s*PROGMEM\s*=\s*\{(.*?)\};" % re.escape(name), content, re.S)
+    if match is None:
+        raise ValueError("%s not found in %s" % (name, path))
+
+    values = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", re.sub(r"//.*", "", match.group(1)))]
+    size = width * height
+    if len(values) > size:
+        raise ValueError("%s has %d pixels, expected %d" % (name, len(values), size))
+
+    return values + [0] * (size - len(values))
+
+
+def encode_row(row, value_size, min_run):
+    """Run length encodes one row of values"""
+
+    def pack(value):
+        return [value & 0xFF, value >> 8] if value_size == 2 else [value]
+
+    encoded = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_RUN]
+            del literals[:MAX_RUN]
+            encoded.append(len(chunk) - 1)
+            for value in chunk:
+                encoded.extend(pack(value))
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and run < MAX_RUN and row[i + run] == row[i]:
+            run += 1
+
+        if run >= min_run:
+            flush_literals()
+            encoded.append(0x80 | (run - 1))
+            encoded.extend(pack(row[i]))
+        else:
+            literals.extend(row[i:i + run])
+        i += run
+
+    flush_literals()
+    return encoded
+
+
+def encode(pixels, width, value_size, min_run):
+    """Run length encodes all rows"""
+
+    encoded = []
+    for y in range(0, len(pixels), width):
+        encoded.extend(encode_row(pixels[y:y + width], value_size, min_run))
+    return encoded
+
+
+def convert(source, name, width, height):
+    """Compresses one asset keeping the smallest encoding"""
+
+    pixels = read_pixels(os.path.join(ASSETS_DIR, source), name, width, height)
+
+    best = {"format": "ASSET_FORMAT_RLE", "palette": [], "data": encode(pixels, width, 2, 2)}
+
+    colors = sorted(set(pixels), key=lambda color: -pixels.count(color))
+    if len(colors) <= 256:
+        indexes = {color: index for index, color in enumerate(colors)}
+        data = encode([indexes[pixel] for pixel in pixels], width, 1, 3)
+        if len(data) + 2 * len(colors) < len(best["data"]):
+            best = {"format": "ASSET_FORMAT_PALETTE", "palette": colors, "data": data}
+
+    best.update({"name": name, "source": source, "width": width, "height": height, "raw": 2 * width * height})
+    best["flash"] = len(best["data"]) + 2 * len(best["palette"])
+    return best
+
+
+def format_array(values, per_line, value_format):
+    """Formats values as C initializer lines"""
+
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("\t" + ", ".join(value_format % value for value in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_header(assets):
+    """Writes asset declarations"""
+
+    lines = [
+        "#ifndef R_ASSETS_H",
+        "#define R_ASSETS_H",
+        "",
+        "// Generated by   : tools/asset_converter.py, do not edit",
+        "// Generated from : assets/",
+        "// Memory usage   : %d bytes instead of %d bytes" % (sum(asset["flash"] for asset in assets), sum(asset["raw"] for asset in assets)),
+        "",
+        "// local Includes",
+        "#include \"core/Asset.hpp\"",
+        "",
+    ]
+
+    for asset in assets:
+        lines.append("/** %s %dx%d, %d bytes */" % (asset["source"], asset["width"], asset["height"], asset["flash"]))
+        lines.append("extern const CrowOs::Core::Asset %s;" % asset["name"])
+        lines.append("")
+
+    lines += [
+        "/** All assets */",
+        "extern const CrowOs::Core::Asset* const ASSETS[];",
+        "",
+        "/** Number of assets */",
+        "extern const short ASSETS_COUNT;",
+        "",
+        "#endif",
+        "",
+    ]
+
+    return "\n".join(lines)
+
+
+def write_source(assets):
+    """Writes asset definitions"""
+
+    lines = [
+        "/**",
+        " * Compressed assets",
+        " * Generated by tools/asset_converter.py, do not edit",
+        " */",
+        "#include \"resources/r_assets.hpp\"",
+        "",
+    ]
+
+    for asset in assets:
+
+        if asset["palette"]:
+            lines.append("static const uint16_t %s_palette[%d] PROGMEM = {" % (asset["name"], len(asset["palette"])))
+            lines.append(format_array(asset["palette"], 16, "0x%04X"))
+            lines.append("};")
+            lines.append("")
+
+        lines.append("static const uint8_t %s_data[%d] PROGMEM = {" % (asset["name"], len(asset["data"])))
+        lines.append(format_array(asset["data"], 24, "0x%02X"))
+        lines.append("};")
+        lines.append("")
+
+        palette = "%s_palette" % asset["name"] if asset["palette"] else "NULL"
+        lines.append("const CrowOs::Core::Asset %s = {\"%s\", %d, %d, CrowOs::Core::%s, %s, %d, %s_data, %d};" % (asset["name"], asset["name"], asset["width"], asset["height"], asset["format"], palette, len(asset["palette"]), asset["name"], asset["flash"]))
+        lines.append("")
+
+    lines.append("const CrowOs::Core::Asset* const ASSETS[] = {")
+    lines.append("\n".join("\t&%s," % asset["name"] for asset in assets))
+    lines.append("};")
+    lines.append("")
+    lines.append("const short ASSETS_COUNT = sizeof(ASSETS) / sizeof(ASSETS[0]);")
+    lines.append("")
+
+    return "\n".join(lines)
+
+
+def is_up_to_date():
+    """Indicates if generated files are newer than every asset and than this script"""
+
+    inputs = [os.path.join(ASSETS_DIR, source) for source in set(asset[0] for asset in ASSETS)]
+    inputs.append(os.path.join(PROJECT_DIR, "tools", "asset_converter.py"))
+    outputs = [HEADER_PATH, SOURCE_PATH]
+
+    if not all(os.path.exists(path) for path in outputs):
+        return False
+    return min(os.path.getmtime(path) for path in outputs) >= max(os.path.getmtime(path) for path in inputs)
+
+
+def main(force=False):
+
+    if not force and is_up_to_date():
+        return
+
+    assets = [convert(*asset) for asset in ASSETS]
+
+    for path, content in ((HEADER_PATH, write_header(assets)), (SOURCE_PATH, write_source(assets))):
+        if not os.path.isdir(os.path.dirname(path)):
+            os.makedirs(os.path.dirname(path))
+        with open(path, "w") as file:
+            file.write(content)
+
+    print("Asset converter :")
+    print("%-24s %-8s %-9s %8s %8s %6s" % ("asset", "size", "format", "raw", "flash", "ratio"))
+    for asset in assets:
+        print("%-24s %-8s %-9s %8d %8d %5.1f%%" % (asset["name"], "%dx%d" % (asset["width"], asset["height"]), asset["format"][13:].lower(), asset["raw"], asset["flash"], 100.0 * asset["flash"] / asset["raw"]))
+    raw = sum(asset["raw"] for asset in assets)
+    flash = sum(asset["flash"] for asset in assets)
+    print("%-24s %-8s %-9s %8d %8d %5.1f%%" % ("total", "", "", raw, flash, 100.0 * flash / raw))
+
+
+main(force=__name__ == "__main__" and "--force" in sys.argv)
@@ -0,0 +1,145 @@
+"""
+CrowOs tokenized log decoder
+
+Rebuilds human readable log lines from a firmware built with -D LOG_TOKENIZED
+Record layout, see Log.hpp : 0xA5, record length, token on 4 bytes little endian, arguments
+Arguments are decoded following the conversion specifiers of the format found in tools/log_tokens.json
+Bytes outside records, like boot messages, are passed through unchanged
+
+Reads a serial port (needs pyserial), a capture file or stdin :
+$ python3 tools/log_decoder.py /dev/ttyUSB0
+$ .pio/build/native/program | python3 tools/log_decoder.py
+
+@author error23
+"""
+import json
+import os
+import re
+import struct
+import sys
+
+TABLE_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), "log_tokens.json")
+
+# First byte of a record, must match Log::RECORD_MAGIC
+RECORD_MAGIC = 0xA5
+
+# Conversion specifier : flags, width, precision, length modifier and conversion
+SPECIFIER = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|L|z|j|t)?([diuxXoeEfgGcs%])")
+
+
+class Arguments:
+    """Reads encoded arguments of one record"""
+
+    def __init__(self, payload):
+        self.payload = payload
+        self.offset = 0
+
+    def integer(self):
+        """Reads zigzag varint"""
+
+        value = 0
+        shift = 0
+        while self.offset < len(self.payload):
+            byte = self.payload[self.offset]
+            self.offset += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        return (value >> 1) ^ -(value & 1)
+
+    def real(self):
+        """Reads 4 bytes float"""
+
+        value = struct.unpack_from("<f", self.payload, self.offset)[0] if self.offset + 4 <= len(self.payload) else 0.0
+        self.offset += 4
+        return value
+
+    def string(self):
+        """Reads length prefixed string"""
+
+        if self.offset >= len(self.payload):
+            return ""
+        length = self.payload[self.offset]
+        text = self.payload[self.offset + 1:self.offset + 1 + length].decode("utf-8", "replace")
+        self.offset += 1 + length
+        return text
+
+
+def format_record(table, token, payload):
+    """Rebuilds message text of one record"""
+
+    key = "%08x" % token
+    if key not in table:
+        return "Unknown : [Log] token = %s, arguments = %s\n" % (key, payload.hex())
+
+    arguments = Arguments(payload)
+
+    def convert(match):
+        flags, length, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if conversion == "s":
+            return ("%" + flags + "s") % arguments.string()
+        if conversion in "eEfgG":
+            return ("%" + flags + conversion) % arguments.real()
+
+        value = arguments.integer()
+        if conversion in "uxXo" and value < 0:
+            value &= 0xFFFFFFFFFFFFFFFF if length in ("ll", "j", "z", "t") else 0xFFFFFFFF
+        if conversion == "c":
+            return chr(value & 0xFF)
+        return ("%" + flags + ("d" if conversion in "iu" else conversion)) % value
+
+    return SPECIFIER.sub(convert, table[key])
+
+
+def decode(stream, table, output):
+    """Decodes stream until it ends"""
+
+    pending = bytearray()
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            break
+        pending += chunk
+
+        while pending:
+            if pending[0] != RECORD_MAGIC:
+                output.write(chr(pending.pop(0)) if pending[0] < 0x80 else "\\x%02x" % pending.pop(0))
+                continue
+            if len(pending) < 2 or len(pending) < 2 + pending[1]:
+                break
+            length = pending[1]
+            if length < 4:
+                output.write("\\x%02x" % pending.pop(0))
+                continue
+
+            token = struct.unpack_from("<I", pending, 2)[0]
+            output.write(format_record(table, token, bytes(pending[6:2 + length])))
+            del pending[:2 + length]
+
+        output.flush()
+
+
+def main():
+
+    with open(TABLE_PATH) as file:
+        table = json.load(file)
+
+    if len(sys.argv) < 2 or sys.argv[1] == "-":
+        stream = sys.stdin.buffer
+    elif sys.argv[1].startswith("/dev/"):
+        import serial
+        stream = serial.Serial(sys.argv[1], int(sys.argv[2]) if len(sys.argv) > 2 else 115200)
+    else:
+        stream = open(sys.argv[1], "rb")
+
+    try:
+        decode(stream, table, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,110 @@
+"""
+CrowOs log tokenizer
+
+Builds the string table used to decode tokenized logs into tools/log_tokens.json
+Every LOG_INFO(module, "format", ...) and LOG_DEBUG(module, "format", ...) call site is expanded into the literal the macro builds :
+    "Info : [module] format\\n" or "Debug : [module] format\\n"
+and indexed by its FNV-1a hash, the same token Log::hash computes at compile time
+Two different literals with the same token fail the build
+
+Runs as PlatformIO pre script and only regenerates when a source changed, it can also be run by hand :
+$ python3 tools/log_tokenizer.py
+
+@author error23
+"""
+import json
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0] if __name__ == "__main__" else __file__)))
+
+SOURCE_DIRS = [os.path.join(PROJECT_DIR, "src"), os.path.join(PROJECT_DIR, "include")]
+TABLE_PATH = os.path.join(PROJECT_DIR, "tools", "log_tokens.json")
+
+# Log call site : level, module and format literal
+CALL_SITE = re.compile(r'\bLOG_(INFO|DEBUG)\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"')
+
+# Message prefix of each level, must match Log.hpp
+PREFIXES = {"INFO": "Info", "DEBUG": "Debug"}
+
+# C escape sequences used in log formats
+ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "\\": "\\", '"': '"', "'": "'", "0": "\0"}
+
+
+def unescape(literal):
+    """Converts C literal body into the characters the compiler stores"""
+
+    return re.sub(r"\\(.)", lambda match: ESCAPES.get(match.group(1), match.group(1)), literal)
+
+
+def token(text):
+    """Computes FNV-1a hash of text, same as Log::hash"""
+
+    value = 2166136261
+    for byte in text.encode("utf-8"):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def source_files():
+    """Lists every C++ source and header of the project"""
+
+    for source_dir in SOURCE_DIRS:
+        for root, _, files in os.walk(source_dir):
+            for name in sorted(files):
+                if name.endswith((".cpp", ".hpp", ".h")):
+                    yield os.path.join(root, name)
+
+
+def build_table():
+    """Scans call sites and indexes their literal by token"""
+
+    table = {}
+    locations = {}
+    for path in source_files():
+        with open(path) as file:
+            content = file.read()
+
+        for match in CALL_SITE.finditer(content):
+            text = "%s : [%s] %s\n" % (PREFIXES[match.group(1)], match.group(2), unescape(match.group(3)))
+            key = "%08x" % token(text)
+            location = "%s:%d" % (os.path.relpath(path, PROJECT_DIR), content.count("\n", 0, match.start()) + 1)
+
+            if key in table and table[key] != text:
+                sys.exit("Log tokenizer : token %s collision between %s and %s" % (key, locations[key], location))
+            table[key] = text
+            locations[key] = location
+
+    return table
+
+
+def is_up_to_date():
+    """Indicates if string table is newer than every source and than this script"""
+
+    inputs = list(source_files())
+    inputs.append(os.path.join(PROJECT_DIR, "tools", "log_tokenizer.py"))
+
+    if not os.path.exists(TABLE_PATH):
+        return False
+    return os.path.getmtime(TABLE_PATH) >= max(os.path.getmtime(path) for path in inputs)
+
+
+def main(force=False):
+
+    if not force and is_up_to_date():
+        return
+
+    table = build_table()
+    with open(TABLE_PATH, "w") as file:
+        json.dump(table, file, indent=1, sort_keys=True)
+        file.write("\n")
+
+    print("Log tokenizer : %d messages written to %s" % (len(table), os.path.relpath(TABLE_PATH, PROJECT_DIR)))
+
+
+main(force=__name__ == "__main__" and "--force" in sys.argv)
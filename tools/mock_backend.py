@@ -0,0 +1,169 @@
+"""
+CrowOs mock backend
+
+Serves the REST resources CrowOs uses so that the native build can run without the real backend
+Connections are HTTP/1.1 keep alive by default, --close answers every request with Connection: close to compare both modes
+--latency delays every response to emulate a remote server
+GET responses carry an ETag and answer 304 to a matching If-None-Match, --max-age adds Cache-Control max-age
+
+Point the native build at it and watch HttpService connect and first byte timings :
+$ python3 tools/mock_backend.py --port 8080
+$ PLATFORMIO_BUILD_FLAGS='-D BACKEND_HOST=\\"127.0.0.1\\" -D BACKEND_PORT=8080' pio run -e native
+
+@author error23
+"""
+import argparse
+import hashlib
+import json
+import re
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+# Printers returned by GET /printer and GET /printer/<id>
+PRINTERS = [
+    {"id": 1, "machineName": "Prusa", "machineIp": "192.168.0.10", "machinePort": 80, "ledColor": "WHITE",
+     "x": 10, "maxX": 250, "y": 20, "maxY": 210, "z": 5, "maxZ": 200,
+     "temperatureExtruderLeft": 215, "temperatureExtruderRight": 0, "temperatureBed": 60, "printingProgress": 42},
+    {"id": 2, "machineName": "Ender", "machineIp": "192.168.0.11", "machinePort": 80, "ledColor": "RED",
+     "x": 0, "maxX": 220, "y": 0, "maxY": 220, "z": 0, "maxZ": 250,
+     "temperatureExtruderLeft": 25, "temperatureExtruderRight": 0, "temperatureBed": 24, "printingProgress": 0},
+]
+
+# Saved feature data, list of {id, featureFactoryName, savedData}
+featureData = []
+featureDataLock = threading.Lock()
+
+
+class Handler(BaseHTTPRequestHandler):
+    """Answers CrowOs REST requests"""
+
+    protocol_version = "HTTP/1.1"
+    # headers and body are written separately, Nagle would hold the body back until the client delayed ack
+    disable_nagle_algorithm = True
+    latency = 0.0
+    close = False
+    max_age = 0
+
+    def log_message(self, format, *args):
+        print("%s %s" % (self.address_string(), format % args), flush=True)
+
+    def respond(self, status, body):
+        """Sends json body with its length so that the connection can be kept alive"""
+
+        if self.latency > 0:
+            time.sleep(self.latency)
+
+        payload = json.dumps(body).encode() if body is not None else b""
+
+        etag = None
+        if self.command == "GET" and status == 200:
+            etag = '"%s"' % hashlib.sha1(payload).hexdigest()[:16]
+            if self.headers.get("If-None-Match") == etag:
+                status = 304
+                payload = b""
+
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json")
+        if etag is not None:
+            self.send_header("ETag", etag)
+            if self.max_age > 0:
+                self.send_header("Cache-Control", "max-age=%d" % self.max_age)
+        if status != 304:
+            self.send_header("Content-Length", str(len(payload)))
+        if self.close:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        self.end_headers()
+        self.wfile.write(payload)
+
+    def read_body(self):
+        """Reads json request body"""
+
+        length = int(self.headers.get("Content-Length", 0))
+        if length == 0:
+            return None
+        try:
+            return json.loads(self.rfile.read(length))
+        except ValueError:
+            return None
+
+    def find_printer(self, printer_id):
+        return next((printer for printer in PRINTERS if printer["id"] == printer_id), None)
+
+    def do_GET(self):
+        path = self.path.split("?")[0].strip("/")
+
+        if path == "printer":
+            self.respond(200, [{key: printer[key] for key in ("id", "machineName", "machineIp", "machinePort")} for printer in PRINTERS])
+            return
+
+        match = re.fullmatch(r"printer/(\d+)", path)
+        if match:
+            printer = self.find_printer(int(match.group(1)))
+            self.respond(200 if printer else 404, printer)
+            return
+
+        if path == "featureData":
+            with featureDataLock:
+                self.respond(200, featureData)
+            return
+
+        self.respond(404, None)
+
+    def do_PUT(self):
+        self.read_body_and_dispatch()
+
+    def do_PATCH(self):
+        self.read_body_and_dispatch()
+
+    def read_body_and_dispatch(self):
+        body = self.read_body()
+        path = self.path.split("?")[0].strip("/")
+
+        if self.command == "PUT" and path == "featureData":
+            with featureDataLock:
+                for dto in body or []:
+                    saved = next((saved for saved in featureData if saved["featureFactoryName"] == dto.get("featureFactoryName")), None)
+                    if saved is None:
+                        saved = {"id": len(featureData) + 1, "featureFactoryName": dto.get("featureFactoryName")}
+                        featureData.append(saved)
+                    saved["savedData"] = dto.get("savedData")
+                self.respond(202, featureData)
+            return
+
+        match = re.fullmatch(r"printer/(\d+)/color", path)
+        if self.command == "PATCH" and match:
+            printer = self.find_printer(int(match.group(1)))
+            color = re.search(r"color=(\w+)", self.path)
+            if printer and color:
+                printer["ledColor"] = color.group(1)
+            self.respond(202 if printer else 404, printer)
+            return
+
+        self.respond(404, None)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="CrowOs mock backend")
+    parser.add_argument("--host", default="127.0.0.1", help="address to listen on")
+    parser.add_argument("--port", type=int, default=8080, help="port to listen on")
+    parser.add_argument("--latency", type=float, default=0, help="delay added to every response in ms")
+    parser.add_argument("--close", action="store_true", help="close connection after every response")
+    parser.add_argument("--max-age", type=int, default=0, help="Cache-Control max-age of GET responses in s")
+    args = parser.parse_args()
+
+    Handler.latency = args.latency / 1000.0
+    Handler.close = args.close
+    Handler.max_age = args.max_age
+
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    print("mock backend listening on %s:%d, keep alive %s" % (args.host, args.port, "off" if args.close else "on"), flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()